@@ -58,6 +58,14 @@ public:
 	* @return true if the copy operation was made successfully, false otherwise */
 	bool getContentCopy(vectorUint8& vectorData);
 
+	/** Copies to the address given by the data parameter the range of the buffer given by offset and size. Only for
+	* buffers with host coherent memory, used to read back partially filled buffers without copying the whole content
+	* @param data   [out] pointer where to copy the data (must have at least size bytes)
+	* @param offset [in]  offset in bytes of the range to copy
+	* @param size   [in]  size in bytes of the range to copy
+	* @return true if the copy operation was made successfully, false otherwise */
+	bool getContentRange(void* data, VkDeviceSize offset, VkDeviceSize size);
+
 	/** Fills the memory of a buffer with the data present at dataPointer
 	* The range of mapped buffer memory is invalidated to make it visible to the host. If the memory property is set
 	* with VK_MEMORY_PROPERTY_HOST_COHERENT_BIT then the driver may take care of this, otherwise for non-coherent mapped memory
@@ -66,6 +74,23 @@ public:
 	* @return true if the set content was made successfully, false otherwise */
 	bool setContent(const void* dataPointer);
 
+	/** Fills the range of the memory of a buffer given by offset and size with the data present at dataPointer. Only for
+	* buffers with host coherent memory, used for small partial updates without any command buffer submission
+	* @param dataPointer [in] pointer to the data to fill the memory range with (must have at least size bytes)
+	* @param offset      [in] offset in bytes of the range to fill
+	* @param size        [in] size in bytes of the range to fill
+	* @return true if the set content was made successfully, false otherwise */
+	bool setContentRange(const void* dataPointer, VkDeviceSize offset, VkDeviceSize size);
+
+	/** Maps the whole memory of a buffer with host coherent memory, to read and write scattered elements without copying
+	* the whole content. Each call has to be followed by a call to unmapContent
+	* @return pointer to the mapped memory, nullptr if the buffer memory is not host coherent or could not be mapped */
+	void* mapContent();
+
+	/** Unmaps the memory previously mapped with mapContent
+	* @return nothing */
+	void unmapContent();
+
 	GET(VkDeviceSize, m_mappingSize, MappingSize)
 	GET(VkBufferUsageFlags, m_usage, Usage)
 	GET(VkFlags, m_requirementsMask, RequirementsMask)
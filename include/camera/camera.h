@@ -26,6 +26,7 @@ limitations under the License.
 #include "../../include/util/getsetmacros.h"
 #include "../../include/commonnamespace.h"
 #include "../../include/shader/resourceenum.h"
+#include "../../include/camera/camerapath.h"
 
 // CLASS FORWARDING
 
@@ -85,17 +86,31 @@ public:
 	* @return nothing */
 	void moveRight(float units);
 
-	/** Updates the position of the camera, allowing a smooth movment independent from the framerate
+	/** Updates the position of the camera, allowing a smooth movment independent from the framerate. Called once per
+	* frame, m_cameraStoppedSignal is emitted the first call the camera pose is the same as in the previous one after
+	* having changed
 	* @param deltaTime    [in] Elapsed time since last call to the funtion
 	* @param offsetFactor [in] Offset factor to scale the movement speed
 	* @return nothing */
 	void updateMovementState(float deltaTime, float offsetFactor);
 
-	/** Updates the position of the camera in case it is animated
+	/** Updates the position of the camera in case it is animated, following m_cameraPath. If the path has a fixed
+	* time step, the animation advances one frame per call and deltaTime is ignored
 	* @param deltaTime    [in] Elapsed time since last call to the funtion
 	* @return nothing */
 	void updateCameraAnimation(float deltaTime);
 
+	/** Loads the camera path file given as parameter, flagging the camera as animated if successful
+	* @param filePath [in] path to the camera path file (text or binary format, see CameraPath)
+	* @return true if the camera path was loaded, false otherwise */
+	bool loadCameraPath(const string& filePath);
+
+	/** Places the camera at the frame of the camera path given as parameter, the next call to updateCameraAnimation
+	* will evaluate this same frame when the path has a fixed time step
+	* @param frameIndex [in] camera path frame index
+	* @return nothing */
+	void setCameraPathFrame(uint frameIndex);
+
 	//REFCOPY_SET(vec3, m_vPosition, Position)
 	REFCOPY(vec3, m_position, Position)
 	GETCOPY(vec3, m_position, Position)
@@ -110,6 +125,7 @@ public:
 	GET(mat4, m_projection, Projection)
 	GET(mat4, m_viewProjection, ViewProjection)
 	REF(SignalCameraDirtyNotification, m_cameraDirtySignal, CameraDirtySignal)
+	REF(SignalCameraDirtyNotification, m_cameraStoppedSignal, CameraStoppedSignal)
 	GETCOPY_SET(bool, m_useRecordedCamera, UseRecordedCamera)
 	GETCOPY_SET(vec3, m_lookAtRecorded, LookAtRecorded)
 	GETCOPY_SET(vec3, m_upRecorded, UpRecorded)
@@ -117,6 +133,8 @@ public:
 	GETCOPY_SET(vec3, m_positionRecorded, PositionRecorded)
 	GET_ARRAY_AS_POINTER(vec4, m_arrayFrustumPlane, ArrayFrustumPlane)
 	GETCOPY_SET(bool, m_isAnimated, IsAnimated)
+	REF(CameraPath, m_cameraPath, CameraPath)
+	GETCOPY(uint, m_animationFrameIndex, AnimationFrameIndex)
 
 	vec4* get()
 	{
@@ -132,6 +150,11 @@ protected:
 	* @return nothing */
 	void slotDownKeyPressed();
 
+	/** Sets the camera position and orientation from m_cameraPath at the time given as parameter
+	* @param time [in] camera path time in milliseconds
+	* @return nothing */
+	void applyCameraPathTime(float time);
+
 	/** Slot for receiving signal from the input manager when the left key is being pressed
 	* @return nothing */
 	void slotLeftKeyPressed();
@@ -222,6 +245,12 @@ protected:
 	vec4                          m_arrayFrustumPlane[6];    //!< Frustum planes
 	bool                          m_isAnimated;              //!< Flag to know if the camera is animated
 	float                         m_animationElapsedTime;    //!< Animation's elapsed time
+	uint                          m_animationFrameIndex;     //!< Index of the next camera path frame to evaluate when the camera path has a fixed time step
+	CameraPath                    m_cameraPath;              //!< Camera path followed when the camera is animated
+	SignalCameraDirtyNotification m_cameraStoppedSignal;     //!< Signal for the camera stopping after having moved, emitted in updateMovementState
+	bool                          m_moving;                  //!< True if the camera pose changed between the last two calls to updateMovementState
+	vec3                          m_positionLastFrame;       //!< Value of m_position in the last call to updateMovementState
+	vec3                          m_lookAtLastFrame;         //!< Value of m_lookAt in the last call to updateMovementState
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
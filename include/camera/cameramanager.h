@@ -107,6 +107,21 @@ public:
 	* @return nothing */
 	void writeCameraRecordingData();
 
+	/** Look for a camera path file in data\scenes\temp with the same name as the scene loaded followed by "_camera_path" and,
+	* if it exists, loads it into the main camera, which is flagged as animated
+	* @return true if a camera path was loaded, false otherwise */
+	bool loadCameraPathData();
+
+	/** Places the main camera at the frame of its camera path given as parameter, meant to be used by benchmark loops to
+	* replay exactly the same camera frame sequence independently of the frame times
+	* @param frameIndex [in] camera path frame index
+	* @return true if the main camera has a camera path, false otherwise */
+	bool setCameraPathFrame(uint frameIndex);
+
+	/** Returns the number of frames needed by the main camera to go through its whole camera path with the path fixed time step
+	* @return number of frames, 0 if the main camera has no camera path or it has no fixed time step */
+	uint getCameraPathNumFrame();
+
 	/** Take all the information to fill a RecordedCamera struct and put it in the file with name the scene name in data\scenes\temp
 	* @param position   [in] Position of the camera
 	* @param lookAt     [in] Target point for the camera
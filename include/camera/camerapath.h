@@ -0,0 +1,122 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _CAMERAPATH_H_
+#define _CAMERAPATH_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+#define CAMERA_PATH_MAGIC              0x50435643   // "CVCP"
+#define CAMERA_PATH_VERSION            1            // Increase each time the layout of the binary camera path file changes
+#define CAMERA_PATH_DEFAULT_TIME_STEP  16.6666667f  // Default fixed time step in milliseconds (60 frames per second)
+
+/** Camera path control point */
+struct CameraPathKey
+{
+	float m_time;      // Time of the key in milliseconds since the beginning of the path
+	vec3  m_position;  // Camera position
+	vec3  m_direction; // Camera forward direction
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Camera path given by a set of keys interpolated with a Catmull-Rom spline, loaded from a text or binary file.
+*   The text format has one entry per line ('#' starts a comment):
+*     timestep <milliseconds>                        fixed time step used to advance the path each frame (0 to use the frame delta time)
+*     loop <0|1>                                     whether the path loops (the last key should then be equal to the first one)
+*     key <time> <px> <py> <pz> <dx> <dy> <dz>       key time in milliseconds, position and forward direction
+*   The binary format (written with save) starts with CAMERA_PATH_MAGIC and is detected automatically when loading.
+*   With a fixed time step the path time for frame i is i * timestep, so the same frame sequence is obtained regardless
+*   of the time spent rendering each frame */
+
+class CameraPath
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	CameraPath();
+
+	/** Loads the camera path file given as parameter, in text or binary format
+	* @param filePath [in] path to the camera path file
+	* @return true if the file was loaded and has at least two keys, false otherwise */
+	bool load(const string& filePath);
+
+	/** Saves the camera path in binary format in the file given as parameter
+	* @param filePath [in] path to the camera path file
+	* @return true if the file was saved, false otherwise */
+	bool save(const string& filePath) const;
+
+	/** Clears all the camera path content
+	* @return nothing */
+	void clear();
+
+	/** Evaluates the camera path at the time given as parameter, wrapping it if the path loops or clamping it otherwise
+	* @param time      [in]  time in milliseconds since the beginning of the path
+	* @param position  [out] camera position
+	* @param direction [out] camera forward direction (normalized)
+	* @return nothing */
+	void evaluate(float time, vec3& position, vec3& direction) const;
+
+	/** Returns the time of the frame given as parameter when advancing the path with a fixed time step
+	* @param frameIndex [in] frame index
+	* @return time in milliseconds of the frame */
+	float getFrameTime(uint frameIndex) const;
+
+	/** Returns the number of frames needed to go through the whole path with the fixed time step
+	* @return number of frames, 0 if the path has no fixed time step */
+	uint getNumFrame() const;
+
+	/** Returns the path duration (time of the last key)
+	* @return path duration in milliseconds */
+	float getDuration() const;
+
+	GET(vector<CameraPathKey>, m_vectorKey, VectorKey)
+	GETCOPY_SET(float, m_fixedTimeStep, FixedTimeStep)
+	GETCOPY_SET(bool, m_loop, Loop)
+
+protected:
+	/** Parses the camera path text format
+	* @param vectorData [in] file content
+	* @return true if the content was parsed without errors, false otherwise */
+	bool parseText(const vectorUint8& vectorData);
+
+	/** Parses the camera path binary format
+	* @param vectorData [in] file content
+	* @return true if the content was parsed without errors, false otherwise */
+	bool parseBinary(const vectorUint8& vectorData);
+
+	/** Returns the index of the key given as parameter, wrapping it if the path loops or clamping it otherwise
+	* @param index [in] key index, possibly out of range
+	* @return key index in range */
+	int getKeyIndex(int index) const;
+
+	vector<CameraPathKey> m_vectorKey;     //!< Path keys, sorted by time
+	float                 m_fixedTimeStep; //!< Fixed time step in milliseconds used to advance the path each frame, 0 to use the frame delta time
+	bool                  m_loop;          //!< Whether the path loops once the last key is reached
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _CAMERAPATH_H_
@@ -0,0 +1,83 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _COMMANDBUFFERPOOL_H_
+#define _COMMANDBUFFERPOOL_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Wrapper of a VkCommandPool which keeps track of all the command buffers allocated from it, so they can be
+* recycled instead of being allocated and freed each time a new command buffer is needed. The whole pool can be
+* reset at once (for instance once per frame, when all the work submitted with its command buffers is known to
+* be completed), making all its command buffers available again */
+class CommandBufferPool
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	CommandBufferPool();
+
+	/** Builds m_commandPool for the queue family index given as parameter
+	* @param queueFamilyIndex [in] queue family index the command buffers allocated from this pool will be submitted to
+	* @param flags            [in] command pool creation flags
+	* @return nothing */
+	void createCommandPool(uint32_t queueFamilyIndex, VkCommandPoolCreateFlags flags);
+
+	/** Frees all the command buffers allocated from m_commandPool and destroys it
+	* @return nothing */
+	void destroyCommandPool();
+
+	/** Returns a command buffer ready to be recorded, taking it from m_vectorFreeCommandBuffer if any is available
+	* or allocating a new one from m_commandPool otherwise
+	* @return command buffer ready to be recorded */
+	VkCommandBuffer acquireCommandBuffer();
+
+	/** Gives back to the pool a command buffer previously returned by acquireCommandBuffer, which will be reset and
+	* reused in the next acquireCommandBuffer call. The command buffer must not be pending of execution
+	* @param commandBuffer [in] command buffer to give back to the pool
+	* @return nothing */
+	void releaseCommandBuffer(VkCommandBuffer commandBuffer);
+
+	/** Resets m_commandPool, making all the command buffers allocated from it available again. None of the
+	* command buffers allocated from this pool must be pending of execution
+	* @return nothing */
+	void resetCommandPool();
+
+	GETCOPY(VkCommandPool, m_commandPool, CommandPool)
+	GET(vector<VkCommandBuffer>, m_vectorCommandBuffer, VectorCommandBuffer)
+
+protected:
+	VkCommandPool           m_commandPool;              //!< Command pool wrapped
+	vector<VkCommandBuffer> m_vectorCommandBuffer;      //!< All the command buffers allocated from m_commandPool
+	vector<VkCommandBuffer> m_vectorFreeCommandBuffer;  //!< Command buffers allocated from m_commandPool available to be recorded
+	bool                    m_resetCommandBufferFlag;   //!< True if m_commandPool was built with VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, needed to reset individual command buffers
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _COMMANDBUFFERPOOL_H_
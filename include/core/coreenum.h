@@ -47,6 +47,15 @@ namespace coreenum
 
 	/////////////////////////////////////////////////////////////////////////////////////////////
 
+	/** Type of the events queued in Input, independent from the platform or script that generated them */
+	enum class InputEventType
+	{
+		INPUT_EVENT_TYPE_KEY = 0,
+		INPUT_EVENT_TYPE_MOUSE
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////
+
 	/** Key mapped codes */
 	enum class KeyCode
 	{
@@ -31,6 +31,8 @@ limitations under the License.
 #include "../../include/core/instance.h"
 #include "../../include/core/swapchain.h"
 #include "../../include/core/input.h"
+#include "../../include/core/commandbufferpool.h"
+#include "../../include/core/framepacer.h"
 
 // CLASS FORWARDING
 
@@ -60,7 +62,21 @@ public:
 	* @return nothing */
 	void prepare();
 
-	/** Resize window
+	/** Reads the presentation and frame loop settings from the command line arguments given as parameter, must be called before initialize:
+	*   -presentmode <fifo|fifo_relaxed|mailbox|immediate>  swap chain present mode (chosen automatically if not supported)
+	*   -swapchainimages <n>                                 number of swap chain images (clamped to the surface limits)
+	*   -targetframetime <ms>                                frame limiter target frame time, 0 to disable it
+	*   -framestatistics <n>                                 print the frame pacing statistics every n frames
+	*   -headless <n>                                        render n frames without waiting for window messages, with input only from the
+	*                                                        input script (0 renders until the last input script frame)
+	* @param argc [in] number of arguments
+	* @param argv [in] arguments
+	* @return nothing */
+	void parseCommandLineArguments(int argc, char** argv);
+
+	/** Resize window: the swap chain is built again and only the output relative textures and the framebuffers using
+	* them are rebuilt (through the texture manager notifications), the techniques depending on the output resolution
+	* record their commands again. Shaders, materials, pipelines and the rest of the resources are kept
 	* @return nothing */
 	void resize();
 
@@ -80,7 +96,29 @@ public:
 	* @return nothing */
 	void createCommandPools();
 
-	/** Sets the extent of the swap chain
+	/** Builds one element in m_vectorFrameCommandPool for each swap chain image
+	* @return nothing */
+	void createFrameCommandPools();
+
+	/** Destroys all the elements in m_vectorFrameCommandPool
+	* @return nothing */
+	void destroyFrameCommandPools();
+
+	/** Returns a command buffer from the frame command pool of the swap chain image currently in use, meant for
+	* short lived command buffers recorded and submitted once. The command buffer is recycled when the swap chain image
+	* is acquired again, or before that if releaseFrameCommandBuffer is called once the command buffer execution has completed
+	* @return command buffer ready to be recorded */
+	VkCommandBuffer acquireFrameCommandBuffer();
+
+	/** Gives back to the frame command pool of the swap chain image currently in use a command buffer returned by
+	* acquireFrameCommandBuffer, whose execution has already completed
+	* @param commandBuffer [in] command buffer to give back
+	* @return nothing */
+	void releaseFrameCommandBuffer(VkCommandBuffer commandBuffer);
+
+	/** Sets the extent of the swap chain and the output resolution
+	* @param width  [in] new width
+	* @param height [in] new height
 	* @return nothing */
 	void setSwapChainExtent(uint32_t width, uint32_t height);
 
@@ -193,6 +231,7 @@ public:
 	ivec2 getSwapChainDimensions();
 
 	static void allocCommandBuffer(const VkDevice* device, const VkCommandPool cmdPool, VkCommandBuffer* cmdBuf, const VkCommandBufferAllocateInfo* commandBufferInfo = NULL);
+	static void freeCommandBuffer(const VkDevice* device, const VkCommandPool cmdPool, VkCommandBuffer* cmdBuf);
 	static void beginCommandBuffer(VkCommandBuffer cmdBuf, VkCommandBufferBeginInfo* inCmdBufInfo = NULL);
 	static void endCommandBuffer(VkCommandBuffer cmdBuf);
 	static void submitCommandBuffer(const VkQueue& queue, const VkCommandBuffer* cmdBufList, const VkSubmitInfo* submitInfo = NULL, const VkFence& fence = VK_NULL_HANDLE);
@@ -217,6 +256,13 @@ public:
 	GETCOPY(uint, m_maxImageDimension3D, MaxImageDimension3D)
 	GETCOPY(uint, m_maxImageDimensionCube, MaxImageDimensionCube)
 	GETCOPY_SET(bool, m_endApplicationMessage, EndApplicationMessage)
+	REF(FramePacer, m_framePacer, FramePacer)
+	GETCOPY(bool, m_headless, Headless)
+	GETCOPY(uint, m_headlessNumFrame, HeadlessNumFrame)
+
+	/** Getter of m_liveCommandBufferCounter, useful to detect command buffer leaks
+	* @return number of command buffers allocated and not yet freed */
+	static uint getLiveCommandBufferCounter() { return m_liveCommandBufferCounter; }
 
 protected:
 	/** Build m_graphicsQueueQueryPool and m_computeQueueQueryPool query pools
@@ -265,6 +311,11 @@ protected:
 	bool            m_endApplicationMessage;          //!< Flag to know when a message to end application is received
 	VkFence         m_fence;                          //!< Fence used for command buffer submitting
 	bool            m_firstFrameFinished;             //!< To know when the first frame has been finished, updated in postRender method
+	vector<CommandBufferPool> m_vectorFrameCommandPool; //!< One resettable command pool per swap chain image, for short lived command buffers recorded and submitted once
+	static uint     m_liveCommandBufferCounter;       //!< Number of command buffers allocated through allocCommandBuffer and not yet freed through freeCommandBuffer
+	FramePacer      m_framePacer;                     //!< Frame limiter and acquire to present latency tracking
+	bool            m_headless;                       //!< If true, frames are rendered without waiting for window messages and input comes only from the input script
+	uint            m_headlessNumFrame;               //!< Number of frames to render when m_headless is true, 0 to render until the last input script frame
 };
 
 static CoreManager* s_pCoreManager;
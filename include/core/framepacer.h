@@ -0,0 +1,137 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _FRAMEPACER_H_
+#define _FRAMEPACER_H_
+
+// GLOBAL INCLUDES
+#include <chrono>
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/commonnamespace.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+using namespace commonnamespace;
+
+// DEFINES
+#define FRAME_PACER_NUM_SAMPLE     120     // Number of frames kept to compute the frame timing statistics
+#define FRAME_PACER_SPIN_THRESHOLD 1.0f    // Time in milliseconds before a wait deadline spent yielding instead of sleeping, for accuracy
+#define FRAME_PACER_REFRESH_TIME   16.667f // Default refresh interval in milliseconds of the headless present backend
+
+typedef std::chrono::high_resolution_clock::time_point FramePacerTime;
+
+/** Timing information of a frame, in milliseconds */
+struct FramePacerSample
+{
+	float m_acquireWait;      // Time blocked acquiring the swap chain image
+	float m_acquireToPresent; // Time since the swap chain image was acquired until it was queued for presentation
+	float m_presentToIdle;    // Time since the image was queued for presentation until the end of frame synchronization finished
+	float m_limiterWait;      // Time waited by the frame limiter to reach the target frame time
+	float m_frameTime;        // Time since the end of the previous frame, including the frame limiter wait
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Tracks the acquire to present latency and frame times, and limits the frame rate to a target frame time to get stable
+*   frame timing. The frame is delimited by calls to beginFrame, endAcquire, endPresent and endFrame. A headless present
+*   backend (headlessPresent, used instead of the swap chain present) simulates the blocking behaviour of each present
+*   mode with a fixed refresh interval, so the pacing can be exercised without a display */
+
+class FramePacer
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	FramePacer();
+
+	/** Marks the beginning of a frame, right before acquiring the swap chain image
+	* @return nothing */
+	void beginFrame();
+
+	/** Marks the moment the swap chain image was acquired
+	* @return nothing */
+	void endAcquire();
+
+	/** Marks the moment the swap chain image was queued for presentation
+	* @return nothing */
+	void endPresent();
+
+	/** Simulates the presentation of a frame with the present mode in m_presentMode and refresh interval in
+	* m_refreshInterval, blocking as the swap chain would, and marks the moment the frame was presented
+	* @return nothing */
+	void headlessPresent();
+
+	/** Marks the end of the frame. If a target frame time is set, waits until it is reached since the end of the
+	* previous frame, then stores the frame timing information
+	* @return nothing */
+	void endFrame();
+
+	/** Clears all the frame timing information
+	* @return nothing */
+	void reset();
+
+	/** Returns the average of the last FRAME_PACER_NUM_SAMPLE frames timing information
+	* @return average frame timing information */
+	FramePacerSample getAverageSample() const;
+
+	/** Returns the maximum of each field of the last FRAME_PACER_NUM_SAMPLE frames timing information
+	* @return maximum frame timing information */
+	FramePacerSample getMaximumSample() const;
+
+	/** Prints the average and maximum frame timing information
+	* @return nothing */
+	void printStatistics() const;
+
+	GETCOPY_SET(float, m_targetFrameTime, TargetFrameTime)
+	GETCOPY_SET(uint, m_statisticsInterval, StatisticsInterval)
+	GETCOPY_SET(VkPresentModeKHR, m_presentMode, PresentMode)
+	GETCOPY_SET(float, m_refreshInterval, RefreshInterval)
+	GETCOPY(uint, m_numFrame, NumFrame)
+
+protected:
+	/** Returns the time in milliseconds between the two time points given as parameter
+	* @param start [in] start time point
+	* @param end   [in] end time point
+	* @return elapsed time in milliseconds */
+	static float getElapsed(const FramePacerTime& start, const FramePacerTime& end);
+
+	/** Blocks the calling thread until the time point given as parameter. Sleeps until FRAME_PACER_SPIN_THRESHOLD
+	* milliseconds before it and yields afterwards, as sleeping has a coarse granularity on some platforms
+	* @param deadline [in] time point to wait for
+	* @return nothing */
+	static void waitUntil(const FramePacerTime& deadline);
+
+	float                    m_targetFrameTime;    //!< Target frame time in milliseconds used by the frame limiter, 0 to disable it
+	uint                     m_statisticsInterval; //!< Number of frames between each printStatistics call done in endFrame, 0 to disable it
+	VkPresentModeKHR         m_presentMode;        //!< Present mode simulated by headlessPresent
+	float                    m_refreshInterval;    //!< Refresh interval in milliseconds simulated by headlessPresent
+	uint                     m_numFrame;           //!< Number of frames finished since the last reset
+	FramePacerTime           m_frameBegin;         //!< Time point of the last beginFrame call
+	FramePacerTime           m_acquireEnd;         //!< Time point of the last endAcquire call
+	FramePacerTime           m_presentEnd;         //!< Time point of the last endPresent or headlessPresent call
+	FramePacerTime           m_previousFrameEnd;   //!< Time point of the end of the previous frame, after the frame limiter wait
+	FramePacerTime           m_headlessStart;      //!< Time point of the first headless present, origin of the simulated refresh intervals
+	bool                     m_headlessStarted;    //!< True once m_headlessStart has been set
+	vector<FramePacerSample> m_vectorSample;       //!< Circular buffer with the timing information of the last FRAME_PACER_NUM_SAMPLE frames
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _FRAMEPACER_H_
@@ -27,6 +27,7 @@ limitations under the License.
 #include "../../include/core/eventsignalslot.h"
 #include "../../include/core/coreenum.h"
 #include "../../include/util/containerutilities.h"
+#include "../../include/core/inputscript.h"
 
 // CLASS FORWARDING
 
@@ -49,10 +50,29 @@ public:
 	* @return nothing */
 	~Input();
 
-	/** Update input according to the Windows message given by message
+#ifdef _WIN32
+	/** Translates the Windows message given by message into an input event added to the event queue
 	* @param message [in] message to process
 	* @return nothing */
 	void updateInput(MSG& message);
+#endif // _WIN32
+
+	/** Adds the event given as parameter to the event queue, to be processed in the next call to processEventQueue.
+	* Any platform backend or scripted input source can feed input this way
+	* @param event [in] event to add
+	* @return nothing */
+	void pushEvent(const InputEvent& event);
+
+	/** Adds to the event queue the input script events for the current frame, processes all the queued events and
+	* advances the input frame index. Must be called once per frame before updateKeyboard
+	* @return nothing */
+	void processEventQueue();
+
+	/** Loads the input script file given as parameter, whose events are queued frame by frame starting at the next
+	* call to processEventQueue
+	* @param filePath [in] path to the input script file
+	* @return true if the input script was loaded, false otherwise */
+	bool loadInputScript(const string& filePath);
 
 	/** Update keyboard input from user
 	* @return nothing */
@@ -100,27 +120,37 @@ public:
 	GETCOPY(int32_t, m_mouseY, MouseY)
 	REF(EventSignalSlot, m_eventSignalSlot, EventSignalSlot)
 	REF(EventSignalSlot, m_eventSinglePressSignalSlot, EventSinglePressSignalSlot)
+	REF(InputScript, m_inputScript, InputScript)
+	GETCOPY(uint, m_frameIndex, FrameIndex)
 
 protected:
-	int32_t         m_mouseX;                        //!< Mouse position x
-	int32_t         m_mouseY;                        //!< Mouse position y
-	bool            m_buttonState[5];                //!< mouse button state
-	bool            m_buttonSinglePressState[5];     //!< mouse button state for single press events
-	bool            m_keyState[256];                 //!< Mapping of each key's state
-	bool            m_keySinglePressState[256];      //!< Mapping of each key's state for single press events
-	bool            m_settingCursorPosition;         //!< To know when the application is setting the cursor position, to avoid processing events regarding this particular event
-	int8_t          m_mouseWheelDelta;               //!< Mouse wheel delta event value (if any)
-	bool            m_leftMouseButtonDown;           //!< Flag to register left mouse button down
-	bool            m_centerMouseButtonDown;         //!< Flag to register center mouse button down
-	bool            m_rightMouseButtonDown;          //!< Flag to register right mouse button down
-	bool            m_leftMouseButtonUp;             //!< Flag to register left mouse button up
-	bool            m_centerMouseButtonUp;           //!< Flag to register center mouse button up
-	bool            m_rightMouseButtonUp;            //!< Flag to register right mouse button up
-	EventSignalSlot m_eventSignalSlot;               //!< To notify for mouse movement and mouse and keyboard down and up events
-	EventSignalSlot m_eventSinglePressSignalSlot;    //!< To notify for mouse movement and mouse and keyboard down and up events for single press events
-	vector<KeyCode> m_vectorPressedKey;              //!< Vector with the currently pressed keys
-	vector<KeyCode> m_vectorSingleStatePressedKey;   //!< Vector with the currently pressed keys for single press events
-	vector<KeyCode> m_vectorSingleStateReleaseddKey; //!< Vector with the currently released keys for single press events
+	/** Processes the event given as parameter, updating the input state
+	* @param event [in] event to process
+	* @return nothing */
+	void processEvent(const InputEvent& event);
+
+	int32_t            m_mouseX;                        //!< Mouse position x
+	int32_t            m_mouseY;                        //!< Mouse position y
+	bool               m_buttonState[5];                //!< mouse button state
+	bool               m_buttonSinglePressState[5];     //!< mouse button state for single press events
+	bool               m_keyState[256];                 //!< Mapping of each key's state
+	bool               m_keySinglePressState[256];      //!< Mapping of each key's state for single press events
+	bool               m_settingCursorPosition;         //!< To know when the application is setting the cursor position, to avoid processing events regarding this particular event
+	int8_t             m_mouseWheelDelta;               //!< Mouse wheel delta event value (if any)
+	bool               m_leftMouseButtonDown;           //!< Flag to register left mouse button down
+	bool               m_centerMouseButtonDown;         //!< Flag to register center mouse button down
+	bool               m_rightMouseButtonDown;          //!< Flag to register right mouse button down
+	bool               m_leftMouseButtonUp;             //!< Flag to register left mouse button up
+	bool               m_centerMouseButtonUp;           //!< Flag to register center mouse button up
+	bool               m_rightMouseButtonUp;            //!< Flag to register right mouse button up
+	EventSignalSlot    m_eventSignalSlot;               //!< To notify for mouse movement and mouse and keyboard down and up events
+	EventSignalSlot    m_eventSinglePressSignalSlot;    //!< To notify for mouse movement and mouse and keyboard down and up events for single press events
+	vector<KeyCode>    m_vectorPressedKey;              //!< Vector with the currently pressed keys
+	vector<KeyCode>    m_vectorSingleStatePressedKey;   //!< Vector with the currently pressed keys for single press events
+	vector<KeyCode>    m_vectorSingleStateReleaseddKey; //!< Vector with the currently released keys for single press events
+	vector<InputEvent> m_vectorEvent;                   //!< Queue of events pending to be processed in processEventQueue
+	InputScript        m_inputScript;                   //!< Scripted input events, queued frame by frame in processEventQueue
+	uint               m_frameIndex;                    //!< Number of calls to processEventQueue done, used to queue the input script events
 };
 
 static Input* s_pInputSingleton;
@@ -0,0 +1,122 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _INPUTSCRIPT_H_
+#define _INPUTSCRIPT_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/core/coreenum.h"
+#include "../../include/commonnamespace.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+using namespace commonnamespace;
+using namespace coreenum;
+
+// DEFINES
+
+/** Platform independent input event, processed by Input::processEventQueue */
+struct InputEvent
+{
+	InputEventType m_type;       // Event type (keyboard or mouse)
+	ActionCode     m_action;     // Event action (up, down, move or mouse wheel)
+	KeyCode        m_key;        // Key involved in keyboard events
+	int32_t        m_x;          // Mouse x screen coordinate for mouse events, a negative value keeps the current one
+	int32_t        m_y;          // Mouse y screen coordinate for mouse events, a negative value keeps the current one
+	uint8_t        m_button;     // Mouse button for mouse events (1 left, 2 center, 3 right)
+	int8_t         m_wheelDelta; // Mouse wheel delta sign for mouse wheel events
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Input event with the frame it has to be processed at */
+struct InputScriptEvent
+{
+	uint       m_frame; // Frame index at which the event is queued
+	InputEvent m_event; // Event to queue
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Sequence of input events loaded from a text file, to drive the application without a window or a user.
+*   Each line is "<frame> <command> <arguments>" ('#' starts a comment), with the commands:
+*     key_down <key>                    key down event
+*     key_up <key>                      key up event
+*     key_press <key>                   key down event at frame and key up event at frame + 1
+*     key_hold <key> <numFrame>         key down event each frame in [frame, frame + numFrame), key up event at frame + numFrame
+*     mouse_move <x> <y>                mouse movement event
+*     mouse_down <button> <x> <y>       mouse button down event (1 left, 2 center, 3 right)
+*     mouse_up <button> <x> <y>         mouse button up event
+*     mouse_wheel <delta>               mouse wheel event at the current mouse position
+*   Keys are given by name (A-Z, 0-9, F1-F12, UP, DOWN, LEFT, RIGHT, SPACE, ENTER, ESCAPE, TAB) or by USB HID code */
+
+class InputScript
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	InputScript();
+
+	/** Loads the input script file given as parameter
+	* @param filePath [in] path to the input script file
+	* @return true if the file was loaded, false otherwise */
+	bool load(const string& filePath);
+
+	/** Clears all the input script events
+	* @return nothing */
+	void clear();
+
+	/** Appends to vectorEvent the events to queue at the frame given as parameter
+	* @param frameIndex  [in]    frame index
+	* @param vectorEvent [inout] vector to append the events to
+	* @return nothing */
+	void getFrameEvent(uint frameIndex, vector<InputEvent>& vectorEvent) const;
+
+	/** Returns the number of frames needed to queue all the script events
+	* @return index of the last frame with events plus one, 0 if the script is empty */
+	uint getNumFrame() const;
+
+	/** Returns the key code for the key name given as parameter
+	* @param name [in] key name or USB HID code
+	* @return key code, KeyCode::KEY_CODE_NONE if the name is not valid */
+	static KeyCode getKeyCode(const string& name);
+
+	GET(vector<InputScriptEvent>, m_vectorEvent, VectorEvent)
+
+protected:
+	/** Parses a line of the input script, adding the events it generates to m_vectorEvent
+	* @param line [in] line to parse, without comments
+	* @return true if the line was parsed without errors, false otherwise */
+	bool parseLine(const string& line);
+
+	/** Adds to m_vectorEvent a keyboard event
+	* @param frame  [in] frame index of the event
+	* @param action [in] key action
+	* @param key    [in] key code
+	* @return nothing */
+	void addKeyEvent(uint frame, ActionCode action, KeyCode key);
+
+	vector<InputScriptEvent> m_vectorEvent; //!< Script events, sorted by frame index
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _INPUTSCRIPT_H_
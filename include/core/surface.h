@@ -89,10 +89,21 @@ public:
 	* @return nothing */
 	void createSurfaceExtensions();
 
-	/** Sets the most convenient values for m_swapchainPresentMode and m_desiredNumberOfSwapChainImages based on recovered data
+	/** Sets the values for m_swapchainPresentMode and m_desiredNumberOfSwapChainImages based on recovered data. The values in
+	* m_preferredPresentMode and m_preferredNumberOfSwapChainImages are used when supported, otherwise the most convenient ones are chosen
 	* @return nothing */
 	void managePresentMode(VkPresentModeKHR& presentMode, uint32_t& numberOfSwapChainImages);
 
+	/** Returns the present mode whose name is given as parameter
+	* @param name [in] present mode name (fifo, fifo_relaxed, mailbox or immediate)
+	* @return present mode, VK_PRESENT_MODE_MAX_ENUM_KHR if the name is not valid */
+	static VkPresentModeKHR getPresentModeFromName(const string& name);
+
+	/** Returns the name of the present mode given as parameter
+	* @param presentMode [in] present mode
+	* @return present mode name */
+	static string getPresentModeName(VkPresentModeKHR presentMode);
+
 	/** Sets the extent of the swap chain images to be build
 	* @return nothing */
 	VkExtent2D setSwapChainExtent();
@@ -105,6 +116,8 @@ public:
 	GET(VkSurfaceTransformFlagBitsKHR, m_preTransform, PreTransform)
 	GET(HWND, m_window, Window)
 	GET(VkSurfaceCapabilitiesKHR, m_surfaceCapabilities, SurfaceCapabilities)
+	GETCOPY_SET(VkPresentModeKHR, m_preferredPresentMode, PreferredPresentMode)
+	GETCOPY_SET(uint32_t, m_preferredNumberOfSwapChainImages, PreferredNumberOfSwapChainImages)
 
 protected:
 #ifdef _WIN32
@@ -133,6 +146,8 @@ protected:
 	uint32_t	                                  m_width;                                     //!< Surface width
 	uint32_t                                      m_height;                                    //!< Surface height
     uint32_t				                      m_graphicsQueueWithPresentIndex;             //!< Number of queue family exposed by device
+	VkPresentModeKHR                              m_preferredPresentMode;                      //!< Present mode to use if supported, VK_PRESENT_MODE_MAX_ENUM_KHR to choose it automatically
+	uint32_t                                      m_preferredNumberOfSwapChainImages;          //!< Number of swap chain images to use (clamped to the surface limits), 0 to choose it automatically
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
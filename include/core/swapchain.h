@@ -65,6 +65,10 @@ public:
 	* @return nothing */
 	void createColorImageView();
 
+	/** Destroys the image views in m_arraySwapChainImageView, called before building the swap chain again when resizing
+	* @return nothing */
+	void destroyColorImageView();
+
 	/** Builds the swap chain color images and retrieves them, putting a handler in the corresponding variable of m_arraySwapchainImages
 	* @return nothing */
 	void createSwapChainColorImages();
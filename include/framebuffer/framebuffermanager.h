@@ -78,7 +78,8 @@ protected:
 	virtual void assignSlots();
 
 	// TODO: use crtp to avoid this virtual method call
-	/** Slot for managing added, elements signal
+	/** Slot for managing added, removed and changed elements signal. Framebuffers are built again when one of their
+	* attachments changes (for instance when an output relative texture is resized)
 	* @param managerName      [in] name of the manager performing the notification
 	* @param elementName      [in] name of the element added
 	* @param notificationType [in] enum describing the type of notification
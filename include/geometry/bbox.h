@@ -65,6 +65,19 @@ public:
 	* @return nothing */
 	void computeFromVertList(const vectorVec3 &vecData, Node* pModel);
 
+	/** Computes the bounding box for the vertices passed as param without applying any transform
+	* @param vecData [in] vertex data
+	* @return nothing */
+	void computeFromPointList(const vectorVec3 &vecData);
+
+	/** Computes this bounding box as the one containing the box given as parameter once transformed by the matrix given as parameter,
+	* transforming the box center and extents instead of the eight box corners (Arvo's method). The result is conservative
+	* but avoids iterating again over all the vertices of a node when only its transform changed
+	* @param box    [in] box to transform, usually in object space
+	* @param matrix [in] affine transform to apply
+	* @return nothing */
+	void computeFromTransformedBox(const BBox3D &box, const mat4 &matrix);
+
 	/** Extends this bb taking the data given as parameter, the resulting bb contains this bb and the one given by data
 	* @param data [in] new bb to add volume to this one
 	* @return nothing */
@@ -0,0 +1,161 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _MESHSIMPLIFIER_H_
+#define _MESHSIMPLIFIER_H_
+
+// GLOBAL INCLUDES
+#include <cfloat>
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+#define MESH_SIMPLIFIER_MAX_ITERATION     100  // Maximum number of iterations of the edge collapse loop
+#define MESH_SIMPLIFIER_AGGRESSIVENESS    7.0  // Exponent of the per iteration error threshold growth, higher values decimate faster with lower quality
+#define MESH_SIMPLIFIER_UNLIMITED_ERROR   DBL_MAX
+
+/** Symmetric 4x4 matrix used to store the quadric of each vertex, only the 10 different elements are kept */
+struct MeshSimplifierQuadric
+{
+	double m_data[10]; // Upper triangular part of the symmetric matrix
+};
+
+/** Triangle of the mesh being simplified */
+struct MeshSimplifierTriangle
+{
+	uint   m_vertex[3]; // Indices of the vertices of the triangle
+	double m_error[4];  // Collapse error of each edge of the triangle, the last element is the minimum of the other three
+	bool   m_deleted;   // True if the triangle has been removed by an edge collapse
+	bool   m_dirty;     // True if the triangle has been modified in the current iteration
+	dvec3  m_normal;    // Triangle normal
+};
+
+/** Vertex of the mesh being simplified */
+struct MeshSimplifierVertex
+{
+	dvec3                 m_position;      // Vertex position
+	uint                  m_triangleStart; // First element in MeshSimplifier::m_vectorReference for this vertex
+	uint                  m_triangleCount; // Number of elements in MeshSimplifier::m_vectorReference for this vertex
+	MeshSimplifierQuadric m_quadric;       // Vertex quadric
+	bool                  m_border;        // True if the vertex belongs to an open border of the mesh
+};
+
+/** Reference from a vertex to one of the triangles using it */
+struct MeshSimplifierReference
+{
+	uint m_triangle;       // Triangle index
+	uint m_triangleVertex; // Index of the vertex in the triangle (0, 1 or 2)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Quadric error metric edge collapse mesh decimation (based on the Fast-Quadric-Mesh-Simplification algorithm by
+* Sven Forstmann). All the data is kept in the instance, so different instances can decimate different meshes
+* concurrently from different threads */
+
+class MeshSimplifier
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	MeshSimplifier();
+
+	/** Sets the mesh to decimate, resetting any previous information
+	* @param vectorIndex  [in] vector with the index data
+	* @param vectorVertex [in] vector with the vertex data
+	* @return nothing */
+	void setMesh(const vectorUint& vectorIndex, const vectorVec3& vectorVertex);
+
+	/** Decimates the mesh given in setMesh until targetTriangleCount triangles remain, the error threshold needed to keep
+	* collapsing edges exceeds errorBudget, or the maximum number of iterations is reached
+	* @param targetTriangleCount [in] number of triangles to reach
+	* @param errorBudget         [in] maximum quadric error allowed for any edge collapse
+	* @return nothing */
+	void simplify(uint targetTriangleCount, double errorBudget = MESH_SIMPLIFIER_UNLIMITED_ERROR);
+
+	/** Copies the decimated mesh to the parameters
+	* @param vectorIndex  [out] vector with the decimated index data
+	* @param vectorVertex [out] vector with the decimated vertex data
+	* @return nothing */
+	void getResult(vectorUint& vectorIndex, vectorVec3& vectorVertex) const;
+
+	/** Returns the number of triangles of the mesh
+	* @return number of triangles of the mesh */
+	uint getNumTriangle() const;
+
+	/** Returns the number of vertices of the mesh
+	* @return number of vertices of the mesh */
+	uint getNumVertex() const;
+
+	GETCOPY(double, m_maxCollapseError, MaxCollapseError)
+	GETCOPY(uint, m_numIteration, NumIteration)
+	GETCOPY(bool, m_errorBudgetReached, ErrorBudgetReached)
+	GETCOPY(float, m_elapsedTime, ElapsedTime)
+
+protected:
+	/** Removes deleted triangles, computes the vertex quadrics, triangle normals and edge errors (first iteration only),
+	* rebuilds the vertex to triangle references and identifies the border vertices (first iteration only)
+	* @param iteration [in] current iteration of the simplification loop
+	* @return nothing */
+	void updateMesh(uint iteration);
+
+	/** Updates the triangles referencing vertex after collapsing an edge to vertexIndex, marking as deleted those
+	* flagged in vectorDeleted
+	* @param vertexIndex   [in] index of the vertex the edge was collapsed to
+	* @param vertex        [in] vertex whose triangles are updated
+	* @param vectorDeleted [in] flags for each triangle of vertex telling whether it has to be deleted
+	* @return nothing */
+	void updateTriangle(uint vertexIndex, const MeshSimplifierVertex& vertex, const vectorBool& vectorDeleted);
+
+	/** Tests whether moving vertex0 to position flips any of its triangles
+	* @param position      [in]  position vertex0 would be moved to
+	* @param index1        [in]  index of the other vertex of the edge to collapse
+	* @param vertex0       [in]  vertex to test
+	* @param vectorDeleted [out] flags for each triangle of vertex0 telling whether it is removed by the collapse
+	* @return true if any triangle would be flipped, false otherwise */
+	bool flipped(dvec3 position, uint index1, const MeshSimplifierVertex& vertex0, vectorBool& vectorDeleted) const;
+
+	/** Computes the error of collapsing the edge between the two vertices given as parameter, and the optimal position
+	* of the resulting vertex
+	* @param index0   [in]  index of the first vertex of the edge
+	* @param index1   [in]  index of the second vertex of the edge
+	* @param position [out] optimal position of the resulting vertex
+	* @return collapse error */
+	double computeError(uint index0, uint index1, dvec3& position) const;
+
+	/** Compacts the triangles and vertices, removing the deleted triangles and unreferenced vertices
+	* @return nothing */
+	void compactMesh();
+
+	vector<MeshSimplifierTriangle>  m_vectorTriangle;     //!< Mesh triangles
+	vector<MeshSimplifierVertex>    m_vectorVertex;       //!< Mesh vertices
+	vector<MeshSimplifierReference> m_vectorReference;    //!< Vertex to triangle references
+	uint                            m_numDeletedTriangle; //!< Number of triangles deleted in the current simplification
+	double                          m_maxCollapseError;   //!< Maximum error of the edge collapses done in the last call to simplify
+	uint                            m_numIteration;       //!< Number of iterations done in the last call to simplify
+	bool                            m_errorBudgetReached; //!< True if the last call to simplify stopped because of the error budget
+	float                           m_elapsedTime;        //!< Time in milliseconds taken by the last call to simplify
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _MESHSIMPLIFIER_H_
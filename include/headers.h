@@ -88,6 +88,7 @@ typedef map<uint, uvec4>             mapUintUvec4;
 typedef vector<VkCommandBuffer*>     vectorCommandBufferPtr;
 typedef vector<Framebuffer*>         vectorFramebufferPtr;
 typedef vector<Buffer*>              vectorBufferPtr;
+typedef vector<uvec2>                vectorUvec2;
 typedef vector<uvec4>                vectorUvec4;
 typedef vector<Camera*>              vectorCameraPtr;
 
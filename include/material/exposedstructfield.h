@@ -48,11 +48,13 @@ public:
 	* @param structName      [in] name of the struct in the shader that contains the struct member this variable will be linked with
 	* @param structFieldName [in] pointer to the CPU copy of the variable in the shader that represents the struct member in the shader, for lazy updating
 	* @param data            [in] pointer to the member variable to expose
+	* @param size            [in] size in bytes of the type of the member variable to expose
 	* @return nothing */
-	ExposedStructField(ResourceInternalType internalType, string&& structName, string&& structFieldName, void* data);
+	ExposedStructField(ResourceInternalType internalType, string&& structName, string&& structFieldName, void* data, uint32_t size);
 
 	GETCOPY(ResourceInternalType, m_internalType, InternalType)
 	GET_PTR(void, m_data, Data)
+	GETCOPY(uint32_t, m_size, Size)
 	GET_PTR(UniformBase, m_structFieldResource, StructFieldResource)
 	REF_PTR(UniformBase, m_structFieldResource, StructFieldResource)
 	SET_PTR(UniformBase, m_structFieldResource, StructFieldResource)
@@ -62,6 +64,7 @@ public:
 protected:
 	ResourceInternalType m_internalType;        //!< Exposed variable internal type (should be one of the glm library types or a C++ fundamental type present in ResourceInternalType)
 	void*                m_data;                //!< Void pointer to the exposed variable
+	uint32_t             m_size;                //!< Size in bytes of the type of the exposed variable
 	UniformBase*         m_structFieldResource; //!< Pointer to the resource in the shader that represents a struct field copy in C++ to link the member variable m_data with
 	string               m_structName;          //!< Name of the struct in the shader the exposed variable will be linked with
 	string               m_structFieldName;     //!< Name of the field in the struct in the shader the exposed variable will be linked with
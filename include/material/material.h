@@ -23,6 +23,7 @@ limitations under the License.
 #include "../../include/util/genericresource.h"
 #include "../../include/shader/resourceenum.h"
 #include "../../include/material/exposedstructfield.h"
+#include "../../include/shader/uniformlayout.h"
 #include "../../include/pipeline/pipeline.h"
 #include "../../include/material/materialenum.h"
 #include "../../include/util/io.h"
@@ -111,22 +112,59 @@ public:
 	virtual void setupPipelineData();
 
 	/** Exposes a member variable of this material to be linked and updated with a struct field variable in the shader this
-	* material is attached to.
+	* material is attached to. The type of the member variable has to match internalType
 	* @param internalType    [in] resource internal type
-	* @param data            [in] void pointer to the member variable to expose
+	* @param data            [in] pointer to the member variable to expose
 	* @param structName      [in] name of the struct in the shader this member variable is going to be exposed
 	* @param structFieldName [in] name of the struct member field the member variable of this class is going to be linked with
 	* @return true if the element was found in the shader resources, and false otherwise */
-	bool exposeStructField(ResourceInternalType internalType, void* data, string&& structName, string&& structFieldName);
+	template <class T> bool exposeStructField(ResourceInternalType internalType, T* data, string&& structName, string&& structFieldName)
+	{
+		if (!isResourceInternalTypeOf<T>(internalType))
+		{
+			cout << "ERROR: type of the exposed variable " << structFieldName << " doesn't match its resource internal type in Material::exposeStructField" << endl;
+			return false;
+		}
+
+		return exposeStructField(internalType, (void*)(data), uint32_t(sizeof(T)), move(structName), move(structFieldName));
+	}
 
 	/** Exposes a member variable of this material to be linked and updated with a push constant struct field variable
-	* (i.e. element in Shader::m_pushConstant::m_vecUniformBase) in the shader this material is attached to.
+	* (i.e. element in Shader::m_pushConstant::m_vecUniformBase) in the shader this material is attached to. The type of
+	* the member variable has to match internalType
+	* @param internalType    [in] resource internal type
+	* @param data            [in] pointer to the member variable to expose
+	* @param structName      [in] name of the struct in the psuh constant shader's vector of push constant struct elements this member variable is going to be exposed
+	* @param structFieldName [in] name of the struct member field the member variable of this class is going to be linked with (matching the name of an element in the push constant struct of the shader)
+	* @return true if the element was found in the shader's push constant resources (i.e. in Shader::m_pushConstant::m_vecUniformBase), and false otherwise */
+	template <class T> bool pushConstantExposeStructField(ResourceInternalType internalType, T* data, string&& structName, string&& structFieldName)
+	{
+		if (!isResourceInternalTypeOf<T>(internalType))
+		{
+			cout << "ERROR: type of the exposed variable " << structFieldName << " doesn't match its resource internal type in Material::pushConstantExposeStructField" << endl;
+			return false;
+		}
+
+		return pushConstantExposeStructField(internalType, (void*)(data), uint32_t(sizeof(T)), move(structName), move(structFieldName));
+	}
+
+	/** Non template version of exposeStructField, once the type of the member variable has been checked
 	* @param internalType    [in] resource internal type
 	* @param data            [in] void pointer to the member variable to expose
+	* @param size            [in] size in bytes of the type of the member variable to expose
+	* @param structName      [in] name of the struct in the shader this member variable is going to be exposed
+	* @param structFieldName [in] name of the struct member field the member variable of this class is going to be linked with
+	* @return true if the element was found in the shader resources, and false otherwise */
+	bool exposeStructField(ResourceInternalType internalType, void* data, uint32_t size, string&& structName, string&& structFieldName);
+
+	/** Non template version of pushConstantExposeStructField, once the type of the member variable has been checked
+	* @param internalType    [in] resource internal type
+	* @param data            [in] void pointer to the member variable to expose
+	* @param size            [in] size in bytes of the type of the member variable to expose
 	* @param structName      [in] name of the struct in the psuh constant shader's vector of push constant struct elements this member variable is going to be exposed
 	* @param structFieldName [in] name of the struct member field the member variable of this class is going to be linked with (matching the name of an element in the push constant struct of the shader)
 	* @return true if the element was found in the shader's push constant resources (i.e. in Shader::m_pushConstant::m_vecUniformBase), and false otherwise */
-	bool pushConstantExposeStructField(ResourceInternalType internalType, void* data, string&& structName, string&& structFieldName);
+	bool pushConstantExposeStructField(ResourceInternalType internalType, void* data, uint32_t size, string&& structName, string&& structFieldName);
 
 	/** Assigns the texture given as parameter to the texture sampler whose name is given as parameter, that needs to be present in the
 	* shader this material is linked with. Default mip mapping type is VkSamplerMipmapMode::VK_SAMPLER_MIPMAP_MODE_LINEAR.
@@ -178,9 +216,10 @@ public:
 	static int computeExposedStructFieldSize(const vector<ExposedStructField>& vectorExposed);
 
 	/** Writes the exposed data to the material uniform buffer which has all the information for
-	* each material used in the scene
+	* each material used in the scene, and marks in the material manager the byte range of the
+	* material cell covered by the fields in m_vectorDirtyExposedStructField as dirty
 	* @return nothing */
-	void writeExposedDataToMaterialUB() const;
+	void writeExposedDataToMaterialUB();
 
 	/** Writes the push constant exposed data to the push constant cpu buffer in the shader 
 	* (i.e. Shader::m_pushConstant::m_CPUBuffer::m_UBHostMemory)
@@ -247,6 +286,13 @@ public:
 	* @return nothing */
 	void destroyPipelineResource();
 
+	/** Rewrites the descriptors of m_descriptorSet for the texture samplers sampling the texture given as parameter,
+	* used when the image view of the texture changes (like when the texture residency changes). Command buffers
+	* using the descriptor set need to be recorded again
+	* @param texture [in] texture whose image view changed
+	* @return true if any descriptor was updated, false otherwise */
+	bool updateTextureDescriptor(const Texture* texture);
+
 	GET_PTR(Shader, m_shader, Shader)
 	REF_PTR(Shader, m_shader, Shader)
 	GET(string, m_shaderResourceName, ShaderResourceName)
@@ -259,6 +305,7 @@ public:
 	GETCOPY_SET(bool, m_exposedStructFieldDirty, ExposedStructFieldDirty)
 	GETCOPY_SET(bool, m_pushConstantExposedStructFieldDirty, PushConstantExposedStructFieldDirty)
 	GETCOPY(int, m_exposedStructFieldSize, ExposedStructFieldSize)
+	REF(vector<ExposedStructField>, m_vectorExposedStructField, VectorExposedStructField)
 	GETCOPY(int, m_pushConstantExposedStructFieldSize, PushConstantExposedStructFieldSize)
 	GETCOPY_SET(int, m_materialUniformBufferIndex, MaterialUniformBufferIndex)
 	GET_SET(vector<VkClearValue>, m_vectorClearValue, VectorClearValue)
@@ -300,10 +347,13 @@ protected:
 	vector<VkDescriptorPool>      m_vectorShaderStorageDescriptorPool;         //!< Vector of the image descriptor pool of this material
 	vector<ExposedStructField>    m_vectorExposedStructField;                  //!< Vector with the exposed member variables that will be linked with sctruct members in the shader
 	vector<ExposedStructField*>   m_vectorDirtyExposedStructField;             //!< Vector with those exposed struct fields with different values form the preious update
+	UniformLayout                 m_uniformLayout;                             //!< Compiled layout of m_vectorExposedStructField, with the packed values written to the material uniform buffer cell
+	vectorUint                    m_vectorDirtyFieldIndex;                     //!< Indices in m_vectorExposedStructField of the fields with different values from the previous update
 	vector<ExposedStructField>    m_vectorPushConstantExposedStructField;      //!< Vector with the exposed member variables that will be linked with sctruct members in the shader in the push constant struct (if any)
 	vector<ExposedStructField*>   m_vectorPushConstantDirtyExposedStructField; //!< Vector with those exposed struct fields with different values form the preious update in the push constant struct (if any)
 	vector<VkClearValue>          m_vectorClearValue;                          //!< Vector with the clear values for this material
 	bool                          m_isCompute;                                 //!< True if the material has a compute shader assigned iosntead of the rasterization pipeline shader (default)
+	VkPipelineCreateFlags         m_computePipelineCreateFlags;                //!< Flags used to build the compute pipeline when m_isCompute is true
 	bool                          m_isEmitter;                                 //!< True f the material represents an emitter
 	MaterialBufferResource        m_resourcesUsed;                             //!< Enum to know the dynamic uniform buffers generated by raster manager used by this material
 	VkDescriptorSet               m_descriptorSet;                             //!< Descriptor set used for this material
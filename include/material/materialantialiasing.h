@@ -135,7 +135,7 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC2, (void*)(&m_textureSize), move(string("myMaterialData")), move(string("textureSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC2, &m_textureSize, move(string("myMaterialData")), move(string("textureSize")));
 
 		assignTextureToSampler(move(string("scenelightingcolor")), move(string("scenelightingcolor")), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 	}
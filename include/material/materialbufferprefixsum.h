@@ -81,17 +81,17 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_prefixSumTotalSize),     move(string("myMaterialData")), move(string("prefixSumTotalSize")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementBase),         move(string("myMaterialData")), move(string("numElementBase")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel0),       move(string("myMaterialData")), move(string("numElementLevel0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel1),       move(string("myMaterialData")), move(string("numElementLevel1")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel2),       move(string("myMaterialData")), move(string("numElementLevel2")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel3),       move(string("myMaterialData")), move(string("numElementLevel3")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_currentStep),            move(string("myMaterialData")), move(string("currentStep")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_currentPhase),           move(string("myMaterialData")), move(string("currentPhase")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numberStepsDownSweep),   move(string("myMaterialData")), move(string("numberStepsDownSweep")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_indirectionBufferRange), move(string("myMaterialData")), move(string("indirectionBufferRange")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_voxelizationWidth),      move(string("myMaterialData")), move(string("voxelizationWidth")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_prefixSumTotalSize,     move(string("myMaterialData")), move(string("prefixSumTotalSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementBase,         move(string("myMaterialData")), move(string("numElementBase")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel0,       move(string("myMaterialData")), move(string("numElementLevel0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel1,       move(string("myMaterialData")), move(string("numElementLevel1")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel2,       move(string("myMaterialData")), move(string("numElementLevel2")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel3,       move(string("myMaterialData")), move(string("numElementLevel3")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_currentStep,            move(string("myMaterialData")), move(string("currentStep")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_currentPhase,           move(string("myMaterialData")), move(string("currentPhase")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numberStepsDownSweep,   move(string("myMaterialData")), move(string("numberStepsDownSweep")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_indirectionBufferRange, move(string("myMaterialData")), move(string("indirectionBufferRange")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_voxelizationWidth,      move(string("myMaterialData")), move(string("voxelizationWidth")));
 
 		assignShaderStorageBuffer(move(string("voxelFirstIndexBuffer")),              move(string("voxelFirstIndexBuffer")),              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("prefixSumPlanarBuffer")),              move(string("prefixSumPlanarBuffer")),              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -101,14 +101,14 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElement),                move(string("myMaterialData")), move(string("numElement")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_dummyValue),                move(string("myMaterialData")), move(string("dummyValue")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_voxelizationSize),          move(string("myMaterialData")), move(string("voxelizationSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                  move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),               move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_voxelSize),                 move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElement,                move(string("myMaterialData")), move(string("numElement")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_dummyValue,                move(string("myMaterialData")), move(string("dummyValue")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_voxelizationSize,          move(string("myMaterialData")), move(string("voxelizationSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                  move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,               move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_voxelSize,                 move(string("myMaterialData")), move(string("voxelSize")));
 
 		assignShaderStorageBuffer(move(string("voxelHashedPositionCompactedBuffer")), move(string("voxelHashedPositionCompactedBuffer")), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("shadowMapGeometryVertexBuffer")),      move(string("shadowMapGeometryVertexBuffer")),      VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
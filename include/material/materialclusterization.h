@@ -89,16 +89,16 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElement),                move(string("myMaterialData")), move(string("numElement")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_dummyValue),                move(string("myMaterialData")), move(string("dummyValue")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_superPixelNumber),          move(string("myMaterialData")), move(string("superPixelNumber")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numOccupiedVoxel),          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_clusterizationStep),        move(string("myMaterialData")), move(string("clusterizationStep")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_voxelSize),                 move(string("myMaterialData")), move(string("voxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                  move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),               move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElement,                move(string("myMaterialData")), move(string("numElement")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_dummyValue,                move(string("myMaterialData")), move(string("dummyValue")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_superPixelNumber,          move(string("myMaterialData")), move(string("superPixelNumber")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numOccupiedVoxel,          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_clusterizationStep,        move(string("myMaterialData")), move(string("clusterizationStep")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_voxelSize,                 move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                  move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,               move(string("myMaterialData")), move(string("sceneExtent")));
 
 		assignShaderStorageBuffer(move(string("voxelClusterOwnerIndexBuffer")),                move(string("voxelClusterOwnerIndexBuffer")),                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("voxelClusterOwnerDistanceBuffer")),             move(string("voxelClusterOwnerDistanceBuffer")),             VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -116,7 +116,7 @@ public:
 		assignShaderStorageBuffer(move(string("voxelHashedPositionCompactedBuffer")),          move(string("voxelHashedPositionCompactedBuffer")),          VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("clusterizationDebugVoxelIndexBuffer")),         move(string("clusterizationDebugVoxelIndexBuffer")),         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 
-		pushConstantExposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, (void*)(&m_pushConstantIterationStep), move(string("myPushConstant")), move(string("clusterizationStep")));
+		pushConstantExposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, &m_pushConstantIterationStep, move(string("myPushConstant")), move(string("clusterizationStep")));
 	}
 
 	SET(string, m_computeShaderThreadMapping, ComputeShaderThreadMapping)
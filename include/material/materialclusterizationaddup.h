@@ -88,14 +88,14 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_superPixelNumber),          move(string("myMaterialData")), move(string("superPixelNumber")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numOccupiedVoxel),          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_voxelSize),                 move(string("myMaterialData")), move(string("voxelSize")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_dummyValue0),               move(string("myMaterialData")), move(string("dummyValue0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_dummyValue1),               move(string("myMaterialData")), move(string("dummyValue1")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_dummyValue2),               move(string("myMaterialData")), move(string("dummyValue2")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_superPixelNumber,          move(string("myMaterialData")), move(string("superPixelNumber")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numOccupiedVoxel,          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_voxelSize,                 move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_dummyValue0,               move(string("myMaterialData")), move(string("dummyValue0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_dummyValue1,               move(string("myMaterialData")), move(string("dummyValue1")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_dummyValue2,               move(string("myMaterialData")), move(string("dummyValue2")));
 
 		assignShaderStorageBuffer(move(string("voxelClusterOwnerIndexBuffer")),                move(string("voxelClusterOwnerIndexBuffer")),                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("voxelHashedPositionCompactedBuffer")),          move(string("voxelHashedPositionCompactedBuffer")),          VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -87,14 +87,14 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_occupiedVoxelNumber),       move(string("myMaterialData")), move(string("occupiedVoxelNumber")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),         move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_voxelizationSize),          move(string("myMaterialData")), move(string("voxelizationSize")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding0),                  move(string("myMaterialData")), move(string("padding0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding1),                  move(string("myMaterialData")), move(string("padding1")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding2),                  move(string("myMaterialData")), move(string("padding2")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_occupiedVoxelNumber,       move(string("myMaterialData")), move(string("occupiedVoxelNumber")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,         move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_voxelizationSize,          move(string("myMaterialData")), move(string("voxelizationSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding0,                  move(string("myMaterialData")), move(string("padding0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding1,                  move(string("myMaterialData")), move(string("padding1")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding2,                  move(string("myMaterialData")), move(string("padding2")));
 
 		assignShaderStorageBuffer(move(string("clusterizationBuffer")),               move(string("clusterizationBuffer")),               VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("voxelClusterOwnerIndexBuffer")),       move(string("voxelClusterOwnerIndexBuffer")),       VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -83,10 +83,10 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),         move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numCluster),                move(string("myMaterialData")), move(string("numCluster")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,         move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numCluster,                move(string("myMaterialData")), move(string("numCluster")));
 
 		assignShaderStorageBuffer(move(string("clusterizationFinalBuffer")),          move(string("clusterizationFinalBuffer")),          VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("clusterizationNeighbourDebugBuffer")), move(string("clusterizationNeighbourDebugBuffer")), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -100,18 +100,18 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension),    move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension),    move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),            move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numCluster),                   move(string("myMaterialData")), move(string("numCluster")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_voxelizationSize),             move(string("myMaterialData")), move(string("voxelizationSize")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding0),                     move(string("myMaterialData")), move(string("padding0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding1),                     move(string("myMaterialData")), move(string("padding1")));
-		exposeStructField(ResourceInternalType::RIT_INT,          (void*)(&m_irradianceFieldGridDensity),   move(string("myMaterialData")), move(string("irradianceFieldGridDensity")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                     move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),                  move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_INT_VEC4,     (void*)(&m_irradianceFieldMinCoordinate), move(string("myMaterialData")), move(string("irradianceFieldMinCoordinate")));
-		exposeStructField(ResourceInternalType::RIT_INT_VEC4,     (void*)(&m_irradianceFieldMaxCoordinate), move(string("myMaterialData")), move(string("irradianceFieldMaxCoordinate")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension,    move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension,    move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,            move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numCluster,                   move(string("myMaterialData")), move(string("numCluster")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_voxelizationSize,             move(string("myMaterialData")), move(string("voxelizationSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding0,                     move(string("myMaterialData")), move(string("padding0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding1,                     move(string("myMaterialData")), move(string("padding1")));
+		exposeStructField(ResourceInternalType::RIT_INT,          &m_irradianceFieldGridDensity,   move(string("myMaterialData")), move(string("irradianceFieldGridDensity")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                     move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,                  move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_INT_VEC4,     &m_irradianceFieldMinCoordinate, move(string("myMaterialData")), move(string("irradianceFieldMinCoordinate")));
+		exposeStructField(ResourceInternalType::RIT_INT_VEC4,     &m_irradianceFieldMaxCoordinate, move(string("myMaterialData")), move(string("irradianceFieldMaxCoordinate")));
 
 		assignShaderStorageBuffer(move(string("clusterizationFinalBuffer")),              move(string("clusterizationFinalBuffer")),              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("clusterizationMergeClustersDebugBuffer")), move(string("clusterizationMergeClustersDebugBuffer")), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
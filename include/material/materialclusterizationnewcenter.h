@@ -84,11 +84,11 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElement),                move(string("myMaterialData")), move(string("numElement")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_clusterizationStep),        move(string("myMaterialData")), move(string("clusterizationStep")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_voxelSize),                 move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElement,                move(string("myMaterialData")), move(string("numElement")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_clusterizationStep,        move(string("myMaterialData")), move(string("clusterizationStep")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_voxelSize,                 move(string("myMaterialData")), move(string("voxelSize")));
 
 		assignShaderStorageBuffer(move(string("clusterizationCenterCoordinatesBuffer")),               move(string("clusterizationCenterCoordinatesBuffer")),               VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("clusterizationCenterPositiveDirectionBuffer")),         move(string("clusterizationCenterPositiveDirectionBuffer")),         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -101,7 +101,7 @@ public:
 		assignShaderStorageBuffer(move(string("IndirectionIndexBuffer")),                              move(string("IndirectionIndexBuffer")),                              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("IndirectionRankBuffer")),                               move(string("IndirectionRankBuffer")),                               VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 
-		pushConstantExposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, (void*)(&m_pushConstantIterationStep), move(string("myPushConstant")), move(string("clusterizationStep")));
+		pushConstantExposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, &m_pushConstantIterationStep, move(string("myPushConstant")), move(string("clusterizationStep")));
 	}
 
 	SET(string, m_computeShaderThreadMapping, ComputeShaderThreadMapping)
@@ -86,13 +86,13 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numOccupiedVoxel),          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_voxelSize),                 move(string("myMaterialData")), move(string("voxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                  move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),               move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMax),                  move(string("myMaterialData")), move(string("sceneMax")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numOccupiedVoxel,          move(string("myMaterialData")), move(string("numOccupiedVoxel")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_voxelSize,                 move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                  move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,               move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMax,                  move(string("myMaterialData")), move(string("sceneMax")));
 
 		assignShaderStorageBuffer(move(string("meanCurvatureBuffer")),                move(string("meanCurvatureBuffer")),                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("meanNormalBuffer")),                   move(string("meanNormalBuffer")),                   VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -95,7 +95,7 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC3, (void*)(&m_color), move(string("myMaterialData")), move(string("color")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC3, &m_color, move(string("myMaterialData")), move(string("color")));
 		assignTextureToSampler(move(string("reflectance")), move(string(m_reflectanceTextureName)), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 		assignTextureToSampler(move(string("normal")),      move(string(m_normalTextureName)),      VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 	}
@@ -82,22 +82,22 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension),       move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension),       move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),               move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding),                         move(string("myMaterialData")), move(string("padding")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneLeftMainCamera),      move(string("myMaterialData")), move(string("frustumPlaneLeftMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneRightMainCamera),     move(string("myMaterialData")), move(string("frustumPlaneRightMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneTopMainCamera),       move(string("myMaterialData")), move(string("frustumPlaneTopMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneBottomMainCamera),    move(string("myMaterialData")), move(string("frustumPlaneBottomMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneBackMainCamera),      move(string("myMaterialData")), move(string("frustumPlaneBackMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneFrontMainCamera),     move(string("myMaterialData")), move(string("frustumPlaneFrontMainCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneLeftEmitterCamera),   move(string("myMaterialData")), move(string("frustumPlaneLeftEmitterCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneRightEmitterCamera),  move(string("myMaterialData")), move(string("frustumPlaneRightEmitterCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneTopEmitterCamera),    move(string("myMaterialData")), move(string("frustumPlaneTopEmitterCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneBottomEmitterCamera), move(string("myMaterialData")), move(string("frustumPlaneBottomEmitterCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneBackEmitterCamera),   move(string("myMaterialData")), move(string("frustumPlaneBackEmitterCamera")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_frustumPlaneFrontEmitterCamera),  move(string("myMaterialData")), move(string("frustumPlaneFrontEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension,       move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension,       move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,               move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding,                         move(string("myMaterialData")), move(string("padding")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneLeftMainCamera,      move(string("myMaterialData")), move(string("frustumPlaneLeftMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneRightMainCamera,     move(string("myMaterialData")), move(string("frustumPlaneRightMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneTopMainCamera,       move(string("myMaterialData")), move(string("frustumPlaneTopMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneBottomMainCamera,    move(string("myMaterialData")), move(string("frustumPlaneBottomMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneBackMainCamera,      move(string("myMaterialData")), move(string("frustumPlaneBackMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneFrontMainCamera,     move(string("myMaterialData")), move(string("frustumPlaneFrontMainCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneLeftEmitterCamera,   move(string("myMaterialData")), move(string("frustumPlaneLeftEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneRightEmitterCamera,  move(string("myMaterialData")), move(string("frustumPlaneRightEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneTopEmitterCamera,    move(string("myMaterialData")), move(string("frustumPlaneTopEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneBottomEmitterCamera, move(string("myMaterialData")), move(string("frustumPlaneBottomEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneBackEmitterCamera,   move(string("myMaterialData")), move(string("frustumPlaneBackEmitterCamera")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_frustumPlaneFrontEmitterCamera,  move(string("myMaterialData")), move(string("frustumPlaneFrontEmitterCamera")));
 
 		assignShaderStorageBuffer(move(string("instanceDataBuffer")),                       move(string("instanceDataBuffer")),                       VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("frustumElementCounterMainCameraBuffer")),    move(string("frustumElementCounterMainCameraBuffer")),    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
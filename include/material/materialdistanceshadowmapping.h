@@ -93,8 +93,8 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, (void*)(&m_viewProjection), move(string("myMaterialData")), move(string("viewProjection")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, (void*)(&m_lightPosition),  move(string("myMaterialData")), move(string("lightPosition")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, &m_viewProjection, move(string("myMaterialData")), move(string("viewProjection")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, &m_lightPosition,  move(string("myMaterialData")), move(string("lightPosition")));
 	}
 
 	void setupPipelineData()
@@ -161,17 +161,17 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_voxelSize),                   move(string("myMaterialData")), move(string("voxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                    move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),                 move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_lightPosition),               move(string("myMaterialData")), move(string("lightPosition")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   (void*)(&m_shadowViewProjection),        move(string("myMaterialData")), move(string("shadowViewProjection")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_offsetAndSize),               move(string("myMaterialData")), move(string("offsetAndSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_zFar),                        move(string("myMaterialData")), move(string("zFar")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_lightForwardEmitterRadiance), move(string("myMaterialData")), move(string("lightForwardEmitterRadiance")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_irradianceFieldGridDensity),  move(string("myMaterialData")), move(string("irradianceFieldGridDensity")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_irradianceMultiplier),        move(string("myMaterialData")), move(string("irradianceMultiplier")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_directIrradianceMultiplier),  move(string("myMaterialData")), move(string("directIrradianceMultiplier")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_voxelSize,                   move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                    move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,                 move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_lightPosition,               move(string("myMaterialData")), move(string("lightPosition")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   &m_shadowViewProjection,        move(string("myMaterialData")), move(string("shadowViewProjection")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_offsetAndSize,               move(string("myMaterialData")), move(string("offsetAndSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_zFar,                        move(string("myMaterialData")), move(string("zFar")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_lightForwardEmitterRadiance, move(string("myMaterialData")), move(string("lightForwardEmitterRadiance")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_irradianceFieldGridDensity,  move(string("myMaterialData")), move(string("irradianceFieldGridDensity")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_irradianceMultiplier,        move(string("myMaterialData")), move(string("irradianceMultiplier")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_directIrradianceMultiplier,  move(string("myMaterialData")), move(string("directIrradianceMultiplier")));
 		
 		assignTextureToSampler(move(string("reflectance")),                            move(string(m_reflectanceTextureName)),                 VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
 		assignTextureToSampler(move(string("normal")),                                 move(string(m_normalTextureName)),                      VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
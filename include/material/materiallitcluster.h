@@ -64,6 +64,7 @@ protected:
 		m_resourcesUsed                     = MaterialBufferResource::MBR_MATERIAL;
 		m_numElementPerLocalWorkgroupThread = 1;
 		m_numThreadPerLocalWorkgroup        = 64;
+		m_computePipelineCreateFlags        = VK_PIPELINE_CREATE_DISPATCH_BASE; // LitClusterTechnique can dispatch only the workgroups of the clusters affected by an emitter change
 
 		buildShaderThreadMapping();
 	}
@@ -100,20 +101,20 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   (void*)(&m_shadowViewProjection),        move(string("myMaterialData")), move(string("shadowViewProjection")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                    move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMax),                    move(string("myMaterialData")), move(string("sceneMax")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),                 move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_lightPosition),               move(string("myMaterialData")), move(string("lightPosition")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension),   move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension),   move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numOccupiedVoxel),            move(string("myMaterialData")), move(string("numOccupiedVoxel")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_voxelSize),                   move(string("myMaterialData")), move(string("voxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_lightForwardEmitterRadiance), move(string("myMaterialData")), move(string("lightForwardEmitterRadiance")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),           move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numAddUpElementPerThread),    move(string("myMaterialData")), move(string("numAddUpElementPerThread")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numAddUpStepThread),          move(string("myMaterialData")), move(string("numAddUpStepThread")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numCluster),                  move(string("myMaterialData")), move(string("numCluster")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   &m_shadowViewProjection,        move(string("myMaterialData")), move(string("shadowViewProjection")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                    move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMax,                    move(string("myMaterialData")), move(string("sceneMax")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,                 move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_lightPosition,               move(string("myMaterialData")), move(string("lightPosition")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension,   move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension,   move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numOccupiedVoxel,            move(string("myMaterialData")), move(string("numOccupiedVoxel")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_voxelSize,                   move(string("myMaterialData")), move(string("voxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_lightForwardEmitterRadiance, move(string("myMaterialData")), move(string("lightForwardEmitterRadiance")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,           move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numAddUpElementPerThread,    move(string("myMaterialData")), move(string("numAddUpElementPerThread")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numAddUpStepThread,          move(string("myMaterialData")), move(string("numAddUpStepThread")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numCluster,                  move(string("myMaterialData")), move(string("numCluster")));
 		
 		assignShaderStorageBuffer(move(string("IndirectionIndexBuffer")),             move(string("IndirectionIndexBuffer")),             VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("IndirectionRankBuffer")),              move(string("IndirectionRankBuffer")),              VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -93,12 +93,12 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numCluster),                move(string("myMaterialData")), move(string("numCluster")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_maximumThreadIndex),        move(string("myMaterialData")), move(string("maximumThreadIndex")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtentAndVoxelSize),   move(string("myMaterialData")), move(string("sceneExtentAndVoxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),                  move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numCluster,                move(string("myMaterialData")), move(string("numCluster")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_maximumThreadIndex,        move(string("myMaterialData")), move(string("maximumThreadIndex")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtentAndVoxelSize,   move(string("myMaterialData")), move(string("sceneExtentAndVoxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,                  move(string("myMaterialData")), move(string("sceneMin")));
 		
 		assignShaderStorageBuffer(move(string("IndirectionIndexBuffer")),                 move(string("IndirectionIndexBuffer")),                 VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("IndirectionRankBuffer")),                  move(string("IndirectionRankBuffer")),                  VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -34,6 +34,13 @@ class UniformBuffer;
 // DEFINES
 #define materialM s_pMaterialManager->instance()
 
+/** Byte range of a material cell in the material uniform buffer with values not yet written to the GPU buffer */
+struct MaterialUniformDirtyRange
+{
+	uint m_start; // First dirty byte in the material cell
+	uint m_end;   // One past the last dirty byte in the material cell, equal to m_start if the cell is not dirty
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 class MaterialManager: public ManagerTemplate<Material>, public Singleton<MaterialManager>
@@ -77,17 +84,37 @@ public:
 	* @return nothing */
 	void buildMaterialUniformBuffer();
 
-	/** Update the GPU buffer m_materialUniformData memory region given by the material parameter
-	* @param materialToUpdate [in] material to update
+	/** Adds the byte range given as parameter of the cell of the material with index materialUniformBufferIndex
+	* in m_materialUniformData to the dirty range of the cell, to be written to the GPU buffer in the next call to
+	* flushMaterialUniformData
+	* @param materialUniformBufferIndex [in] index of the material cell in m_materialUniformData
+	* @param start                      [in] first dirty byte in the material cell
+	* @param end                        [in] one past the last dirty byte in the material cell
 	* @return nothing */
-	void updateGPUBufferMaterialData(Material* materialToUpdate);
+	void markMaterialUniformDirty(int materialUniformBufferIndex, uint start, uint end);
+
+	/** Writes the dirty ranges of the material cells to the persistently mapped GPU buffer of m_materialUniformData,
+	* adding the number of bytes written to m_materialUniformByteUploaded. Nothing is written if no material changed
+	* @return nothing */
+	void flushMaterialUniformData();
 
 	REF_PTR(UniformBuffer, m_materialUniformData, MaterialUniformData)
 	GETCOPY(uint, m_materialUBDynamicAllignment, MaterialUBDynamicAllignment)
+	GETCOPY(VkDeviceSize, m_materialUniformByteUploadedLastFrame, MaterialUniformByteUploadedLastFrame)
 
 protected:
-	UniformBuffer* m_materialUniformData;         //!< Uniform buffer with information for each one of the materials
-	uint           m_materialUBDynamicAllignment; //!< Value of UniformBuffer::m_dynamicAllignment for m_materialUniformData
+	/** Called once per frame, stores in m_materialUniformByteUploadedLastFrame the number of bytes written to the
+	* GPU buffer of m_materialUniformData during the frame and resets m_materialUniformByteUploaded
+	* @return nothing */
+	void endFrameMaterialUniformUpload();
+
+	UniformBuffer*                    m_materialUniformData;                  //!< Uniform buffer with information for each one of the materials
+	uint                              m_materialUBDynamicAllignment;          //!< Value of UniformBuffer::m_dynamicAllignment for m_materialUniformData
+	uint8_t*                          m_materialUniformMappedPointer;         //!< Persistently mapped pointer to the GPU buffer memory of m_materialUniformData
+	vector<MaterialUniformDirtyRange> m_vectorMaterialUniformDirtyRange;      //!< Dirty byte range of each material cell in m_materialUniformData
+	vectorUint                        m_vectorDirtyMaterialUniformIndex;      //!< Indices of the material cells with a non empty range in m_vectorMaterialUniformDirtyRange
+	VkDeviceSize                      m_materialUniformByteUploaded;          //!< Number of bytes written to the GPU buffer of m_materialUniformData in the current frame
+	VkDeviceSize                      m_materialUniformByteUploadedLastFrame; //!< Number of bytes written to the GPU buffer of m_materialUniformData in the last frame
 };
 
 static MaterialManager* s_pMaterialManager;
@@ -79,14 +79,14 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementBase),       move(string("myMaterialData")), move(string("numElementBase")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel0),     move(string("myMaterialData")), move(string("numElementLevel0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel1),     move(string("myMaterialData")), move(string("numElementLevel1")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel2),     move(string("myMaterialData")), move(string("numElementLevel2")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numElementLevel3),     move(string("myMaterialData")), move(string("numElementLevel3")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_currentStep),          move(string("myMaterialData")), move(string("currentStep")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_currentPhase),         move(string("myMaterialData")), move(string("currentPhase")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numberStepsDownSweep), move(string("myMaterialData")), move(string("numberStepsDownSweep")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementBase,       move(string("myMaterialData")), move(string("numElementBase")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel0,     move(string("myMaterialData")), move(string("numElementLevel0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel1,     move(string("myMaterialData")), move(string("numElementLevel1")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel2,     move(string("myMaterialData")), move(string("numElementLevel2")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numElementLevel3,     move(string("myMaterialData")), move(string("numElementLevel3")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_currentStep,          move(string("myMaterialData")), move(string("currentStep")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_currentPhase,         move(string("myMaterialData")), move(string("currentPhase")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numberStepsDownSweep, move(string("myMaterialData")), move(string("numberStepsDownSweep")));
 
 		assignShaderStorageBuffer(move(string("prefixSumBuffer")),                  move(string("prefixSumBuffer")),                  VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("clusterVisibilityBuffer")),          move(string("clusterVisibilityBuffer")),          VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
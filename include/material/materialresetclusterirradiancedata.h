@@ -58,6 +58,7 @@ protected:
 		m_resourcesUsed                     = MaterialBufferResource::MBR_MATERIAL;
 		m_numElementPerLocalWorkgroupThread = 1;
 		m_numThreadPerLocalWorkgroup        = 64;
+		m_computePipelineCreateFlags        = VK_PIPELINE_CREATE_DISPATCH_BASE; // LitClusterTechnique can dispatch only the workgroups of the clusters affected by an emitter change
 
 		buildShaderThreadMapping();
 	}
@@ -93,10 +94,10 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension), move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension), move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numCluster),                move(string("myMaterialData")), move(string("numCluster")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),         move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension, move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension, move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numCluster,                move(string("myMaterialData")), move(string("numCluster")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,         move(string("myMaterialData")), move(string("numThreadExecuted")));
 
 		assignShaderStorageBuffer(move(string("clusterizationFinalBuffer")),            move(string("clusterizationFinalBuffer")),            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("litTestClusterBuffer")),                 move(string("litTestClusterBuffer")),                 VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
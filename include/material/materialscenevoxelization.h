@@ -84,13 +84,13 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, (void*)(&m_projection),       move(string("myMaterialData")), move(string("projection")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, (void*)(&m_viewX),            move(string("myMaterialData")), move(string("viewX")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, (void*)(&m_viewY),            move(string("myMaterialData")), move(string("viewY")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, (void*)(&m_viewZ),            move(string("myMaterialData")), move(string("viewZ")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC3, (void*)(&m_voxelizationSize), move(string("myMaterialData")), move(string("voxelizationSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,      (void*)(&m_storeInformation), move(string("myMaterialData")), move(string("storeInformation")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, (void*)(&m_pixelDiagonal),    move(string("myMaterialData")), move(string("pixelDiagonal")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, &m_projection,       move(string("myMaterialData")), move(string("projection")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, &m_viewX,            move(string("myMaterialData")), move(string("viewX")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, &m_viewY,            move(string("myMaterialData")), move(string("viewY")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4, &m_viewZ,            move(string("myMaterialData")), move(string("viewZ")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC3, &m_voxelizationSize, move(string("myMaterialData")), move(string("voxelizationSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,      &m_storeInformation, move(string("myMaterialData")), move(string("storeInformation")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4, &m_pixelDiagonal,    move(string("myMaterialData")), move(string("pixelDiagonal")));
 
 		assignImageToSampler(move(string("voxelizedscene")), move(string("voxelizedscene")), VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
 
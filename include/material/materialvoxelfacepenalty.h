@@ -85,14 +85,14 @@ public:
 	* @return nothing */
 	void exposeResources()
 	{
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsXDimension),     move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_localWorkGroupsYDimension),     move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numThreadExecuted),             move(string("myMaterialData")), move(string("numThreadExecuted")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numberThreadPerElement),        move(string("myMaterialData")), move(string("numberThreadPerElement")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMinAndNumberVoxel),        move(string("myMaterialData")), move(string("sceneMinAndNumberVoxel")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtentAndVoxelSize),       move(string("myMaterialData")), move(string("sceneExtentAndVoxelSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_formFactorVoxelToVoxelAdded),   move(string("myMaterialData")), move(string("formFactorVoxelToVoxelAdded")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT,        (void*)(&m_formFactorClusterToVoxelAdded), move(string("myMaterialData")), move(string("formFactorClusterToVoxelAdded")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsXDimension,     move(string("myMaterialData")), move(string("localWorkGroupsXDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_localWorkGroupsYDimension,     move(string("myMaterialData")), move(string("localWorkGroupsYDimension")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numThreadExecuted,             move(string("myMaterialData")), move(string("numThreadExecuted")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numberThreadPerElement,        move(string("myMaterialData")), move(string("numberThreadPerElement")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMinAndNumberVoxel,        move(string("myMaterialData")), move(string("sceneMinAndNumberVoxel")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtentAndVoxelSize,       move(string("myMaterialData")), move(string("sceneExtentAndVoxelSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_formFactorVoxelToVoxelAdded,   move(string("myMaterialData")), move(string("formFactorVoxelToVoxelAdded")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT,        &m_formFactorClusterToVoxelAdded, move(string("myMaterialData")), move(string("formFactorClusterToVoxelAdded")));
 		
 		assignShaderStorageBuffer(move(string("voxelHashedPositionCompactedBuffer")),      move(string("voxelHashedPositionCompactedBuffer")),      VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("voxelOccupiedBuffer")),                     move(string("voxelOccupiedBuffer")),                     VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
@@ -117,14 +117,14 @@ public:
 		assignShaderStorageBuffer(move(string("litTestClusterBuffer")),                move(string("litTestClusterBuffer")),                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 		assignShaderStorageBuffer(move(string("nextFragmentIndexBuffer")),             move(string("nextFragmentIndexBuffer")),             VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 
-		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   (void*)(&m_viewProjection),   move(string("myMaterialData")), move(string("viewProjection")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_voxelizationSize), move(string("myMaterialData")), move(string("voxelizationSize")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneMin),         move(string("myMaterialData")), move(string("sceneMin")));
-		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   (void*)(&m_sceneExtent),      move(string("myMaterialData")), move(string("sceneExtent")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_numOcupiedVoxel),  move(string("myMaterialData")), move(string("numOcupiedVoxel")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding0),         move(string("myMaterialData")), move(string("padding0")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding1),         move(string("myMaterialData")), move(string("padding1")));
-		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, (void*)(&m_padding2),         move(string("myMaterialData")), move(string("padding2")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_MAT4,   &m_viewProjection,   move(string("myMaterialData")), move(string("viewProjection")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_voxelizationSize, move(string("myMaterialData")), move(string("voxelizationSize")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneMin,         move(string("myMaterialData")), move(string("sceneMin")));
+		exposeStructField(ResourceInternalType::RIT_FLOAT_VEC4,   &m_sceneExtent,      move(string("myMaterialData")), move(string("sceneExtent")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_numOcupiedVoxel,  move(string("myMaterialData")), move(string("numOcupiedVoxel")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding0,         move(string("myMaterialData")), move(string("padding0")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding1,         move(string("myMaterialData")), move(string("padding1")));
+		exposeStructField(ResourceInternalType::RIT_UNSIGNED_INT, &m_padding2,         move(string("myMaterialData")), move(string("padding2")));
 	}
 
 	void setupPipelineData()
@@ -27,6 +27,7 @@ limitations under the License.
 #include "../../include/util/getsetmacros.h"
 #include "../../include/geometry/bbox.h"
 #include "../../include/material/materialenum.h"
+#include "../../include/model/scenecache.h"
 
 // CLASS FORWARDING
 class Node;
@@ -37,6 +38,25 @@ using namespace materialenum;
 // DEFINES
 const int minNumberTriangleToDecimate   = 300;
 const float maxAABBDiagonalSizeDecimate = 30.0f;
+const float decimationErrorBudgetFactor = 0.01f; // Per mesh decimation error budget, as a fraction of the squared diagonal of the mesh AABB
+
+/** Assimp mesh found while traversing the scene nodes, pending to be processed */
+struct ModelMeshTask
+{
+	const aiMesh* m_mesh;      // Assimp mesh
+	aiMatrix4x4   m_transform; // Accumulated transform of the node the mesh belongs to
+	string        m_nodeName;  // Name of the node the mesh belongs to
+};
+
+/** Result of decimating a mesh for the merged geometry node */
+struct ModelMeshDecimation
+{
+	bool       m_decimated;        // True if the mesh was decimated, in which case m_index and m_vertex have the decimated geometry
+	vectorUint m_index;            // Decimated index data
+	vectorVec3 m_vertex;           // Decimated vertex data
+	uint       m_numTriangleInput; // Number of triangles before decimating
+	float      m_elapsedTime;      // Time in milliseconds taken to decimate the mesh
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,11 +101,38 @@ public:
 	GET(BBox3D, m_aabb, AABB)
 
 protected:
-	/** Loads the model given by the path variable, returns true if everything went ok and false otherwise
+	/** Loads the model given by the path variable, returns true if everything went ok and false otherwise. If a scene
+	* cache file with a matching key exists, the model is built from it and the assimp import is skipped, otherwise the
+	* model is imported and the cache file is generated
 	* param path [in] path to the model to load
 	* @return true if everything went ok and false otherwise */
 	bool loadModel(string path);
 
+	/** Builds the model from the data in m_sceneCache (materials, cameras, meshes and merged geometry)
+	* @return nothing */
+	void loadFromSceneCache();
+
+	/** Builds the scene material (and textures) described by the parameter
+	* @param material [in] material information
+	* @return nothing */
+	void buildMaterial(const SceneCacheMaterial& material);
+
+	/** Builds the emitter camera or regular camera described by the parameter and adds it to the scene
+	* @param camera [in] camera information
+	* @return nothing */
+	void buildCamera(const SceneCacheCamera& camera);
+
+	/** Builds a new scene node (or emitter node) from the world space mesh data given as parameter
+	* @param indices      [in] index data
+	* @param vertices     [in] world space vertex data
+	* @param texCoord     [in] texture coordinates
+	* @param normals      [in] normals
+	* @param tangents     [in] tangents
+	* @param materialName [in] name of the node material
+	* @param decimation   [in] decimated version of the mesh to add to the merged geometry node, nullptr if not available
+	* @return new scene node */
+	Node* buildNode(vectorUint indices, vectorVec3 vertices, const vectorVec2& texCoord, const vectorVec3& normals, const vectorVec3& tangents, const string& materialName, const ModelMeshDecimation* decimation);
+
 	/** Recursive function used to process all the nodes and therefore children of the model loaded with
 	* the assimp library
 	* @param node		  [in] assimp node to process
@@ -94,12 +141,19 @@ protected:
 	* @return nothing */
 	void processNode(aiNode* node, const aiScene* scene, const aiMatrix4x4 accTransform);
 
-	/** Generates a new node added to the scene from each mesh given by each node of the assimp loaded model
-	* #param mesh      [in] assimp mesh to get data from and generate a new scene node
-	* #param scene     [in] assimp scene which contains the model that contains the node
-	* #param transform [in] transform info for this node
-	* @return new node added to the scene from each mesh given by each node of the assimp loaded model */
-	Node *processMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4 &transform, const string& nodeName);
+	/** Extracts the per-vertex and index data of the assimp mesh given as parameter, transforming the vertices to world
+	* space and computing their AABB. Only reads from the parameters, so it can be called concurrently for different meshes
+	* @param mesh      [in]  assimp mesh to get data from
+	* @param transform [in]  transform info for this mesh
+	* @param cacheMesh [out] mesh data extracted
+	* @return nothing */
+	void processMesh(const aiMesh* mesh, const aiMatrix4x4 &transform, SceneCacheMesh& cacheMesh) const;
+
+	/** Processes in parallel all the meshes in m_vectorMeshTask with processMesh, and then builds in order a new scene
+	* node for each one of them
+	* @param scene [in] assimp scene which contains the meshes
+	* @return nothing */
+	void processMeshTask(const aiScene* scene);
 
 	/** Loops through all the nodes starting from the root node of the scene, and returns true if all of the meshes have tangent and
 	* bitangent data, and false otherwise
@@ -159,18 +213,22 @@ protected:
 	* @param vectorTexCoord [in] texture cordinates information to add to the merged geometry node
 	* @param vectorNormal   [in] normal information to add to the merged geometry node
 	* @param vectorTangent  [in] tangent information to add to the merged geometry node
-	* @param aabbMin        [in] minimum value of the AABB for the vertices in vectorVertex
-	* @param aabbMax        [in] maximum value of the AABB for the vertices in vectorVertex
-	* @param nodeName       [in] node name
+	* @param decimation     [in] if not nullptr and decimated, its geometry is added instead of vectorIndex and vectorVertex
 	* @return nothing */
 	void addMergedGeometryNodeInformation(const vectorUint& vectorIndex,
 										  const vectorVec3& vectorVertex,
 										  const vectorVec2& vectorTexCoord,
 										  const vectorVec3& vectorNormal,
 										  const vectorVec3& vectorTangent,
-										  vec3 aabbMin,
-										  vec3 aabbMax,
-										  const string& nodeName);
+										  const ModelMeshDecimation* decimation);
+
+	/** Decimates the mesh given as parameter for the merged geometry node, if it's not flagged to avoid decimation by
+	* the scene avoid decimate keywords and it is small and detailed enough. Each call uses its own MeshSimplifier
+	* instance, so it can be called concurrently for different meshes
+	* @param mesh       [in]  mesh to decimate
+	* @param decimation [out] decimation result
+	* @return nothing */
+	void decimateMesh(const SceneCacheMesh& mesh, ModelMeshDecimation& decimation) const;
 
 	/** Look in the aiCamera array in the scene to look for a camera with name given as parameter. If found, then 
 	* retrieve information from that camera (position, up, lookAt, zNear, zFar)
@@ -185,12 +243,6 @@ protected:
 	static bool getCameraInformation(const aiScene* scene, string&& cameraName, vec3& position, vec3& lookAt, vec3& up, float& zNear, float& zFar);
 
 protected:
-	/** Prepare the vertex and index data for the decimation operation
-	* @param vectorIndex  [in] vector with the index data
-	* @param vectorVertex [in] vector with the vertex data
-	* @return nothing */
-	void prepareDecimationData(const vectorUint& vectorIndex, const vectorVec3& vectorVertex);
-
 	/** Helper method: Takes the texture file name recovered, textureName, and returns the corresponding reflectance and normal texture
 	* names for loading
 	* @param vectorIndex    [in] index information to add to the merged geometry node
@@ -218,6 +270,9 @@ protected:
 	vectorVec3    m_mergedTangent;          //!< temp vector used to store information for the merged geometry node (if m_makeMergedGeometryNode is true)
 	vectorString  m_vectorEmitterName;      //!< Temp vector used to store emitter names (emitter information is not available in the aiLight structure, storing the name of all emitters to obtain its transform data when processing scene nodes)
 	vectorString  m_vectorCameraName;       //!< Temp vector used to store camera names (camera information is not available in the aiCamera structure, storing the name of all cameras to obtain its transform data when processing scene nodes)
+	SceneCache    m_sceneCache;             //!< Pre processed scene data, filled while importing with assimp (to be saved) or loaded from the scene cache file
+	vector<ModelMeshTask> m_vectorMeshTask; //!< Meshes found while traversing the scene nodes in processNode, processed afterwards in processMeshTask
+	bool          m_loadedFromSceneCache;   //!< True if the model has been built from a scene cache file
 	static int    m_modelCounter;           //!< Simple counter to name added models to the scene
 };
 
@@ -0,0 +1,259 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _SCENECACHE_H_
+#define _SCENECACHE_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+#define SCENE_CACHE_MAGIC     0x43535643 // "CVSC"
+#define SCENE_CACHE_VERSION   2          // Increase each time the layout of the cache file, the data generated when importing a scene or the key computation changes
+#define SCENE_CACHE_EXTENSION ".cache"   // Extension added to the scene file name to build the cache file name
+#define SCENE_CACHE_ALIGNMENT 16         // Alignment in bytes of each array stored in the cache file
+#define FNV1A_OFFSET_BASIS 14695981039346656037ull
+#define FNV1A_PRIME        1099511628211ull
+
+/** Material information recovered from the imported scene, enough to build again the scene materials and textures */
+struct SceneCacheMaterial
+{
+	string m_name;               // Material name
+	bool   m_isEmitter;          // True if the material is an emitter (MaterialPlainColor), false for textured materials (MaterialColorTexture)
+	string m_reflectanceTexture; // Reflectance texture file name (relative to the scene path)
+	string m_normalTexture;      // Normal texture file name (relative to the scene path)
+	uint   m_surfaceType;        // MaterialSurfaceType of the material
+};
+
+/** Camera information recovered from the imported scene, for both emitter and regular cameras */
+struct SceneCacheCamera
+{
+	string m_name;      // Camera (node) name
+	bool   m_isEmitter; // True if the camera corresponds to an emitter in the scene
+	mat4   m_transform; // Accumulated node transform
+	vec3   m_up;        // Up vector (not used for emitter cameras)
+	float  m_zNear;     // Near clip plane distance (not used for emitter cameras)
+	float  m_zFar;      // Far clip plane distance (not used for emitter cameras)
+};
+
+/** Mesh information after all the import post processing and world space transform, ready to build a scene node */
+struct SceneCacheMesh
+{
+	string     m_nodeName;     // Name of the scene node the mesh belongs to
+	string     m_materialName; // Material name
+	vectorUint m_index;        // Index data
+	vectorVec3 m_vertex;       // World space vertex data
+	vectorVec2 m_texCoord;     // Texture coordinates
+	vectorVec3 m_normal;       // Normals
+	vectorVec3 m_tangent;      // Tangents
+	vec3       m_aabbMin;      // Minimum value of the mesh AABB
+	vec3       m_aabbMax;      // Maximum value of the mesh AABB
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Binary container with the imported and pre processed scene data (materials, cameras, meshes and merged geometry),
+*   so later loads of the same scene skip the assimp import. The file starts with a header (magic, version and key) and
+*   each array is stored raw, aligned to SCENE_CACHE_ALIGNMENT bytes, so the whole file can be read (or mapped) with a
+*   single operation and parsed in place. The key is built from the scene file content, the import flags and the size and
+*   last write time of the files the scene depends on (.mtl files and textures), any change in them makes the cache file obsolete. */
+
+class SceneCache
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	SceneCache();
+
+	/** Computes the key of the scene given as parameter, hashing the file content with the import flags, the size and last
+	* write time of the scene dependencies (see collectDependency) and any additional value affecting the imported data
+	* @param filePath     [in] path to the scene file
+	* @param importFlags  [in] assimp import flags
+	* @param vectorExtra  [in] additional values affecting the imported data (decimation parameters, keywords, etc)
+	* @param key          [out] computed key
+	* @return true if the scene file could be read, false otherwise */
+	static bool computeKey(const string& filePath, uint importFlags, const vectorString& vectorExtra, uint64_t& key);
+
+	/** Collects the paths of the files the scene given as parameter depends on. For .obj files these are the material
+	* libraries referenced with mtllib and the texture maps referenced in them, other formats have no dependencies
+	* @param filePath         [in]  path to the scene file
+	* @param vectorData       [in]  scene file content
+	* @param vectorDependency [out] paths of the dependencies, relative to the current directory
+	* @return nothing */
+	static void collectDependency(const string& filePath, const vectorUint8& vectorData, vectorString& vectorDependency);
+
+	/** Loads the cache file given as parameter, if it exists and its magic, version and key match
+	* @param cachePath [in] path to the cache file
+	* @param key       [in] expected key
+	* @return true if the cache was loaded, false otherwise */
+	bool load(const string& cachePath, uint64_t key);
+
+	/** Saves the cache content in the file given as parameter
+	* @param cachePath [in] path to the cache file
+	* @param key       [in] key to store
+	* @return true if the cache was saved, false otherwise */
+	bool save(const string& cachePath, uint64_t key) const;
+
+	/** Clears all the cache content
+	* @return nothing */
+	void clear();
+
+	REF(vector<SceneCacheMaterial>, m_vectorMaterial, VectorMaterial)
+	REF(vector<SceneCacheCamera>, m_vectorCamera, VectorCamera)
+	REF(vector<SceneCacheMesh>, m_vectorMesh, VectorMesh)
+	REF(vectorUint, m_mergedIndex, MergedIndex)
+	REF(vectorVec3, m_mergedVertex, MergedVertex)
+	REF(vectorVec2, m_mergedTexCoord, MergedTexCoord)
+	REF(vectorVec3, m_mergedNormal, MergedNormal)
+	REF(vectorVec3, m_mergedTangent, MergedTangent)
+
+	/** Appends to vectorData the value given as parameter
+	* @param value      [in] value to append
+	* @param vectorData [in] vector to append to
+	* @return nothing */
+	template <class T> static void writeValue(const T& value, vectorUint8& vectorData);
+
+	/** Appends to vectorData the size of the array given as parameter, and its content aligned to SCENE_CACHE_ALIGNMENT bytes
+	* @param vectorValue [in] array to append
+	* @param vectorData  [in] vector to append to
+	* @return nothing */
+	template <class T> static void writeArray(const vector<T>& vectorValue, vectorUint8& vectorData);
+
+	/** Appends to vectorData the string given as parameter
+	* @param value      [in] string to append
+	* @param vectorData [in] vector to append to
+	* @return nothing */
+	static void writeString(const string& value, vectorUint8& vectorData);
+
+	/** Reads a value from vectorData at the offset given as parameter, advancing it
+	* @param vectorData [in]    data to read from
+	* @param offset     [inout] offset to read from
+	* @param value      [out]   value read
+	* @return true if the value could be read, false otherwise */
+	template <class T> static bool readValue(const vectorUint8& vectorData, size_t& offset, T& value);
+
+	/** Reads an array stored with writeArray from vectorData at the offset given as parameter, advancing it
+	* @param vectorData  [in]    data to read from
+	* @param offset      [inout] offset to read from
+	* @param vectorValue [out]   array read
+	* @return true if the array could be read, false otherwise */
+	template <class T> static bool readArray(const vectorUint8& vectorData, size_t& offset, vector<T>& vectorValue);
+
+	/** Reads a string stored with writeString from vectorData at the offset given as parameter, advancing it
+	* @param vectorData [in]    data to read from
+	* @param offset     [inout] offset to read from
+	* @param value      [out]   string read
+	* @return true if the string could be read, false otherwise */
+	static bool readString(const vectorUint8& vectorData, size_t& offset, string& value);
+
+	/** Hashes the bytes given as parameter with the FNV-1a algorithm, starting from the hash value given as parameter
+	* @param data   [in] data to hash
+	* @param size   [in] size in bytes of data
+	* @param hash   [in] initial hash value
+	* @return hash value */
+	static uint64_t hashFNV1a(const void* data, size_t size, uint64_t hash);
+
+protected:
+	vector<SceneCacheMaterial> m_vectorMaterial; //!< Scene materials
+	vector<SceneCacheCamera>   m_vectorCamera;   //!< Scene cameras (emitter and regular ones)
+	vector<SceneCacheMesh>     m_vectorMesh;     //!< Scene meshes, in the same order they were processed
+	vectorUint                 m_mergedIndex;    //!< Merged geometry node index data (empty if no merged geometry node was built)
+	vectorVec3                 m_mergedVertex;   //!< Merged geometry node vertex data
+	vectorVec2                 m_mergedTexCoord; //!< Merged geometry node texture coordinate data
+	vectorVec3                 m_mergedNormal;   //!< Merged geometry node normal data
+	vectorVec3                 m_mergedTangent;  //!< Merged geometry node tangent data
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T> inline void SceneCache::writeValue(const T& value, vectorUint8& vectorData)
+{
+	size_t offset = vectorData.size();
+	vectorData.resize(offset + sizeof(T));
+	memcpy(&vectorData[offset], &value, sizeof(T));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T> inline void SceneCache::writeArray(const vector<T>& vectorValue, vectorUint8& vectorData)
+{
+	writeValue(uint64_t(vectorValue.size()), vectorData);
+
+	size_t offset = vectorData.size();
+	offset        = (offset + SCENE_CACHE_ALIGNMENT - 1) & ~size_t(SCENE_CACHE_ALIGNMENT - 1);
+	vectorData.resize(offset + vectorValue.size() * sizeof(T), 0);
+
+	if (vectorValue.size() > 0)
+	{
+		memcpy(&vectorData[offset], vectorValue.data(), vectorValue.size() * sizeof(T));
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T> inline bool SceneCache::readValue(const vectorUint8& vectorData, size_t& offset, T& value)
+{
+	if ((offset + sizeof(T)) > vectorData.size())
+	{
+		return false;
+	}
+
+	memcpy(&value, &vectorData[offset], sizeof(T));
+	offset += sizeof(T);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T> inline bool SceneCache::readArray(const vectorUint8& vectorData, size_t& offset, vector<T>& vectorValue)
+{
+	uint64_t numElement;
+	if (!readValue(vectorData, offset, numElement))
+	{
+		return false;
+	}
+
+	offset = (offset + SCENE_CACHE_ALIGNMENT - 1) & ~size_t(SCENE_CACHE_ALIGNMENT - 1);
+
+	// Written as a division so a corrupted numElement can't overflow the size computation
+	if ((offset > vectorData.size()) || (numElement > ((vectorData.size() - offset) / sizeof(T))))
+	{
+		return false;
+	}
+
+	vectorValue.resize(size_t(numElement));
+
+	if (numElement > 0)
+	{
+		memcpy(vectorValue.data(), &vectorData[offset], size_t(numElement) * sizeof(T));
+	}
+
+	offset += size_t(numElement) * sizeof(T);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _SCENECACHE_H_
@@ -32,6 +32,20 @@ class Material;
 // NAMESPACE
 
 // DEFINES
+#define MESHLET_MAX_TRIANGLE 64 // Maximum number of triangles in each meshlet built in Node::buildMeshlet
+
+/** Contiguous range of the node indices with its bounding sphere and normal cone, used for culling */
+struct MeshletData
+{
+	vec4 m_boundingSphere; // Bounding sphere center (xyz) and radius (w)
+	vec4 m_normalCone;     // Normal cone axis (xyz) and cutoff (w), a cutoff of 1.0 means the meshlet can't be backface culled
+	uint m_firstIndex;     // First index of the meshlet, relative to the node index list
+	uint m_indexCount;     // Number of indices in the meshlet
+	uint m_padding0;       // Padding to keep the struct size multiple of 16 bytes
+	uint m_padding1;       // Padding to keep the struct size multiple of 16 bytes
+};
+
+typedef vector<MeshletData> vectorMeshletData;
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -82,6 +96,13 @@ public:
 	* @return nothing */
 	void generateNormals();
 
+	/** Reorders the triangles in m_indices following the Morton code of their centroid so spatially close triangles
+	* are contiguous, and partitions them in meshlets of at most maxTriangle triangles, stored in m_vectorMeshlet.
+	* Needs to be called before the node index data is added to the scene index buffer
+	* @param maxTriangle [in] maximum number of triangles per meshlet
+	* @return nothing */
+	void buildMeshlet(uint maxTriangle);
+
 	/** Generates node's tangents
 	* @return nothing */
 	void generateTangents();
@@ -103,7 +124,7 @@ public:
 	* @return nothing */
 	virtual bool testPointInside(const vec3 &vP);
 
-	/** Computes the bounding box of the model
+	/** Computes the bounding box of the model, both in object space (m_localAABB) and in world space (m_aabb)
 	* @return nothing */
 	virtual void computeBB();
 
@@ -119,6 +140,7 @@ public:
 	REF(vectorVec3, m_tangents, Tangents)
 	REF(vectorFloat, m_vertexData, VertexData)
 	GET(BBox3D, m_aabb, BBox)
+	GET(BBox3D, m_localAABB, LocalBBox)
 	GET_SET(eGeometryType, m_geomType, GeomType)
 	GET_SET(eMeshType, m_meshType, MeshType)
 	GET_SET(bool, m_followingPath, FollowingPath)
@@ -130,6 +152,7 @@ public:
 	REF_SET(bool, m_affectSceneBB, AffectSceneBB)
 	GET_PTR(Material, m_material, Material)
 	REF_PTR(Material, m_material, Material)
+	GET(vectorMeshletData, m_vectorMeshlet, VectorMeshlet)
 	GET_PTR(Material, m_materialInstanced, MaterialInstanced)
 	REF_PTR(Material, m_materialInstanced, MaterialInstanced)
 
@@ -158,6 +181,7 @@ protected:
 	vectorVec3    m_tangents;          //!< vector of tangents of this node that will be sent to GPU
 	vectorFloat	  m_vertexData;        //!< All the previous per - vertex information stored as an array of structures with all the info for each vertex
 	BBox3D		  m_aabb;              //!< Boundig box of the mesh
+	BBox3D		  m_localAABB;         //!< Boundig box of the mesh in object space, used to refit m_aabb when the transform changes
 	eGeometryType m_geomType;          //!< Geometry type of the mesh (triangles, triangle strip, triangle fan for now)
 	mat4		  m_modelMat;          //!< Model matrix for the mesh (if the model is static, it only has to be computed once, but if the model has traslation / rotation / scaling changes, each time it changes)
 	eMeshType	  m_meshType;          //!< To clasify each type of mesh: light volume / no light volume, torus light volume, etc
@@ -173,6 +197,7 @@ protected:
 	Material*     m_material;          //!< Material to use for this node for scene (main purpose) rasterization
 	Material*     m_materialInstanced; //!< Material to use for this node for instanced rasterization
 	float         m_instanceCounter;   //!< Current value of s_instanceCounter in Node constructor before its increased by one
+	vectorMeshletData m_vectorMeshlet; //!< Meshlets built in buildMeshlet, empty if buildMeshlet was not called
 	static float  s_instanceCounter;   //!< Static variable to know the number of nodes instanced and have per-element vertex information in shaders, float value is currnently used since per-vertex data is currently composed of 32-bit float values
 };
 
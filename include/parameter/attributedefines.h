@@ -250,12 +250,6 @@ namespace attributedefines
 	// Distance shadow mapping distance texture name compute shader source code chunk hashed
 	extern const uint g_distanceShadowMapDistanceTextureCodeChunkHashed;
 
-	// Distance shadow mapping offscreen texture name compute shader source code chunk
-	extern const char* g_distanceShadowMapOffscreenTextureCodeChunk;
-
-	// Distance shadow mapping offscreen texture name compute shader source code chunk hashed
-	extern const uint g_distanceShadowMapOffscreenTextureCodeChunkHashed;
-
 	// Distance shadow mapping material name compute shader source code chunk
 	extern const char* g_distanceShadowMapMaterialNameCodeChunk;
 
@@ -64,6 +64,10 @@ public:
 	* @return nothing */
 	virtual void postCommandSubmit();
 
+	/** Updates the texture size used by the antialiasing material and clears the recorded command buffers
+	* @return nothing */
+	virtual void outputResized();
+
 protected:
 	RenderPass* m_renderPass; //!< Render pass used for post process pass
 	Material*   m_material;   //!< Material used for post process pass
@@ -59,18 +59,26 @@ public:
 
 	REF(SignalBuildVoxelShadowMapGeometryCompletion, m_signalBuildVoxelShadowMapGeometryCompletion, SignalBuildVoxelShadowMapGeometryCompletion)
 	GETCOPY(uint, m_numUsedVertex, NumUsedVertex)
+	GETCOPY_SET(bool, m_greedyMesh, GreedyMesh)
 
 protected:
 	/** Slot to receive signal when the prefix sum step has been done
 	* @return nothing */
 	void slotPrefixSumComplete();
 
+	/** Builds the voxel shadow map geometry from the occupied voxels in voxelHashedPositionCompactedBuffer, emitting only the voxel
+	* faces not shared with another occupied voxel and merging each slice coplanar faces into maximal rectangles (greedy meshing).
+	* The result is uploaded to m_shadowMapGeometryVertexBuffer with the same vertex format the compute pass generates
+	* @return nothing */
+	void buildGreedyMeshGeometry();
+
 	SignalBuildVoxelShadowMapGeometryCompletion m_signalBuildVoxelShadowMapGeometryCompletion; //!< Signal for completion of the technique
 	BufferPrefixSumTechnique*                   m_techniquePrefixSum;                          //!< Pointer to the instance of the prefix sum technique
 	uint                                        m_numOccupiedVoxel;                            //!< Number of occupied voxels after voxelization process
 	Buffer*                                     m_shadowMapGeometryVertexBuffer;               //!< Buffer with the vertex information for the mesh built for the voxel shadow mapping technique
 	Buffer*                                     m_vertexCounterBuffer;                         //!< Buffer used to counter the amount of vertices that end up used to build the geometry for the voxel shadow map
 	uint                                        m_numUsedVertex;                               //!< Counter with the value from the m_vertexCounterBuffer buffer
+	bool                                        m_greedyMesh;                                  //!< If true, the geometry is built with greedy meshing of the visible voxel faces instead of the compute pass emitting a whole cube per occupied voxel (which is kept for validation)
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
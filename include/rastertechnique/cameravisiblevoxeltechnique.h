@@ -58,9 +58,17 @@ public:
 	* @return nothing */
 	virtual void postCommandSubmit();
 
+	/** Called once the light bounce computations for the last camera visible voxel set have finished. If the main camera
+	* changed while they were in progress, a new camera visible voxel pass is started with the current camera values
+	* @return nothing */
+	void lightBounceCompleted();
+
 	REF(SignalCameraVisibleVoxelCompletion, m_signalCameraVisibleVoxelCompletion, SignalCameraVisibleVoxelCompletion)
 	GETCOPY(uint, m_cameraVisibleVoxelNumber, CameraVisibleVoxelNumber)
 	GETCOPY_SET(bool, m_lightBounceOnProgress, LightBounceOnProgress)
+	GETCOPY_SET(float, m_cameraMovementThreshold, CameraMovementThreshold)
+	GETCOPY_SET(float, m_cameraRotationThreshold, CameraRotationThreshold)
+	SET(bool, m_forceNextPass, ForceNextPass)
 
 protected:
 	/** Slot to receive notification when the prefix sum of the scene voxelization has been completed
@@ -71,6 +79,27 @@ protected:
 	* @return nothing */
 	void slotCameraDirty();
 
+	/** Slot to receive notification when the LitClusterTechnique has completed, the light bounce results of some voxels
+	* were invalidated and a new camera visible voxel pass is needed even if the main camera did not move
+	* @return nothing */
+	void slotLitClusterCompleted();
+
+	/** Slot to receive notification when the main camera stops moving. If its pose is not the one of the last camera
+	* visible voxel pass (the movement accumulated since then stayed below the thresholds), a final pass is forced so
+	* the camera visible voxels match the pose the camera rests at
+	* @return nothing */
+	void slotCameraStopped();
+
+	/** Returns true if the main camera moved more than m_cameraMovementThreshold or rotated more than
+	* m_cameraRotationThreshold since the last camera visible voxel pass, or its projection changed
+	* @return true if the camera visible voxels need to be computed again, false otherwise */
+	bool cameraMovedSinceLastPass();
+
+	/** Returns true if the pose or projection of the main camera is different in any amount from the ones used in the
+	* last camera visible voxel pass
+	* @return true if the main camera changed since the last camera visible voxel pass, false otherwise */
+	bool cameraChangedSinceLastPass();
+
 	/** For debug purposes, show the contents of m_cameraVisibleVoxelCompactedBuffer
 	* @return nothing */
 	void showVisibleVoxelData();
@@ -84,12 +113,18 @@ protected:
 	BufferPrefixSumTechnique*          m_bufferPrefixSumTechnique;           //!< Pointer to the prefix sum technique
 	bool                               m_prefixSumCompleted;                 //!< Flag to know if the prefix sum step has completed
 	Camera*                            m_mainCamera;                         //!< Scene main camera
-	vec3                               m_cameraPosition;                     //!< Camera position in the moment the slot reset radiance data is signaled, to store the original camera positon in the moment all the simulation starts (it takes several frames and the camera poition and forward direction can change in the meantime
-	vec3                               m_cameraForward;                      //!< Camera forward direction in the moment the slot reset radiance data is signaled, to store the original camera positon in the moment all the simulation starts (it takes several frames and the camera poition and forward direction can change in the meantime
+	vec3                               m_cameraPosition;                     //!< Camera position used in the last camera visible voxel pass, only updated when a pass is computed so the movement since then accumulates (the simulation takes several frames and the camera position and forward direction can change in the meantime)
+	vec3                               m_cameraForward;                      //!< Camera forward direction used in the last camera visible voxel pass, only updated when a pass is computed so the rotation since then accumulates (the simulation takes several frames and the camera position and forward direction can change in the meantime)
 	uint                               m_cameraVisibleVoxelNumber;           //!< Where to put the lst recovered camera visible voxel result from m_cameraVisibleCounterBuffer buffer
 	LitClusterProcessResultsTechnique* m_litClusterProcessResultsTechnique;  //!< Pointer to the instace of the lit cluster process results technique
 	bool                               m_lightBounceOnProgress;              //!< Flag to avoid several visible voxel tests in the same light bouunce and gaussian filter simulation. This flag is reset by the gaussian filtering technique ince it finishes
 	bool                               m_cameraDirtyWhileComputation;        //!< Flag to track whether the camera is dirty while performming the light bounce computation process (m_lightBounceOnProgress is true)
+	bool                               m_forceNextPass;                      //!< If true, the next camera visible voxel pass is done even if the main camera did not move since the last one
+	bool                               m_lastPassValid;                      //!< True once a camera visible voxel pass has been done, m_cameraPosition, m_cameraForward and m_lastPassProjection have the values used in it
+	mat4                               m_lastPassProjection;                 //!< Main camera projection matrix used in the last camera visible voxel pass
+	float                              m_voxelWorldSize;                     //!< Biggest dimension of the world space size of a voxel
+	float                              m_cameraMovementThreshold;            //!< Main camera displacement, in voxels, since the last pass needed to compute the camera visible voxels again
+	float                              m_cameraRotationThreshold;            //!< Main camera forward direction change, in degrees, since the last pass needed to compute the camera visible voxels again
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@ limitations under the License.
 
 // PROJECT INCLUDES
 #include "../../include/rastertechnique/bufferprocesstechnique.h"
+#include "../../include/util/clustervisibilitycache.h"
 
 // CLASS FORWARDING
 class BufferPrefixSumTechnique;
@@ -64,7 +65,14 @@ public:
 	* @return nothing */
 	virtual void postCommandSubmit();
 
+	/** Encodes the content of the cluster visibility buffers once the compaction step is done, and saves it to the cluster
+	* visibility cache file so next executions with the same voxelization and clusterization skip this technique. The
+	* clusterVisibilityBuffer and clusterVisibilityDebugBuffer buffers are not needed anymore and are shrunk
+	* @return nothing */
+	void storeVisibilityCache();
+
 	REF(SignalClusterVisibilityCompletion, m_clusterVisibilityCompletion, SignalClusterVisibilityCompletion)
+	GETCOPY(bool, m_loadedFromCache, LoadedFromCache)
 
 protected:
 	/** Slot to receive signal when the prefix sum step has been done
@@ -75,6 +83,15 @@ protected:
 	* @return nothing */
 	void slotClusterMergeComplete();
 
+	/** Computes m_cacheKey from the voxelization and clusterization buffers the cluster visibility depends on
+	* @return nothing */
+	void computeCacheKey();
+
+	/** Tries to load the cluster visibility cache file and, if present and valid, fills with its content the
+	* clusterVisibilityNumberBuffer, clusterVisibilityFirstIndexBuffer and clusterVisibilityCompactedBuffer buffers
+	* @return true if the cluster visibility buffers were loaded from the cache file, false otherwise */
+	bool loadVisibilityCache();
+
 	SignalClusterVisibilityCompletion    m_clusterVisibilityCompletion;       //!< Signal for completion of the technique
 	BufferPrefixSumTechnique*            m_techniquePrefixSum;                //!< Pointer to the instance of the prefix sum technique
 	ClusterizationMergeClusterTechnique* m_techniqueClusterMerge;             //!< Pointer to the instance of the cluster merge technique
@@ -87,6 +104,10 @@ protected:
 	vec4                                 m_sceneExtent;                       //!< Scene extent
 	uint                                 m_numOccupiedVoxel;                  //!< Number of occupied voxels after voxelization process
 	bool                                 m_prefixSumCompleted;                //!< Flag to know if the prefix sum step has completed
+	ClusterVisibilityCache               m_visibilityCache;                   //!< Sparse delta coded cluster visibility data, used to load and save the cluster visibility cache file
+	string                               m_cachePath;                         //!< Path to the cluster visibility cache file
+	uint64_t                             m_cacheKey;                          //!< Key of the current voxelization and clusterization, to validate the cluster visibility cache file
+	bool                                 m_loadedFromCache;                   //!< True if the cluster visibility buffers were loaded from the cache file and the technique was not executed
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@ limitations under the License.
 
 // CLASS FORWARDING
 class Buffer;
+class Texture;
+class Camera;
 class MaterialComputeFrustumCulling;
 
 // NAMESPACE
@@ -60,6 +62,14 @@ public:
 	* @return nothing */
 	virtual void recordBarriers(VkCommandBuffer* commandBuffer);
 
+	/** Record command buffer, for the compute queue or, when occlusion culling is enabled, for the graphics queue,
+	* which owns the scene depth texture copied in recordBarriers
+	* @param currentImage      [in]    current screen image framebuffer drawing to (in case it's needed)
+	* @param commandBufferID   [in]    Unique identifier of the command buffer returned as parameter
+	* @param commandBufferType [inout] Type of command buffer recorded
+	* @return command buffer the technique has recorded to */
+	virtual VkCommandBuffer* record(int currentImage, uint& commandBufferID, CommandBufferType& commandBufferType);
+
 	/** Called before rendering
 	* @param dt [in] elapsed time in miliseconds since the last update call
 	* @return nothing */
@@ -71,13 +81,70 @@ public:
 	* @return nothing */
 	virtual void postCommandSubmit();
 
+	/** Resizes m_depthReadbackBuffer to the new size of m_sceneDepthTexture, discards the depth pyramid built with
+	* the previous size and clears the recorded command buffers, since they copy the whole scene depth texture
+	* @return nothing */
+	virtual void outputResized();
+
 	REF(SignalComputeFrustumCullingCompletion, m_signalComputeFrustumCullingCompletion, SignalComputeFrustumCullingCompletion)
+	/** Enables or disables occlusion culling. The technique command buffers are destroyed, since they are recorded for the
+	* graphics queue and copy the scene depth texture only when occlusion culling is enabled
+	* @param occlusionCulling [in] true to enable occlusion culling, false to disable it
+	* @return nothing */
+	void setOcclusionCulling(bool occlusionCulling);
+
+	GETCOPY(bool, m_occlusionCulling, OcclusionCulling)
+	GETCOPY(uint, m_occlusionCulledCounter, OcclusionCulledCounter)
+	GETCOPY(uint, m_drawnMainCameraCounter, DrawnMainCameraCounter)
+	GETCOPY(uint, m_meshletCulledMainCameraCounter, MeshletCulledMainCameraCounter)
+	GETCOPY(uint, m_meshletCulledEmitterCameraCounter, MeshletCulledEmitterCameraCounter)
+	GETCOPY(uvec2, m_compactedGeometryMeshletRange, CompactedGeometryMeshletRange)
+	GET(vector<uvec2>, m_vectorNodeMeshletRange, VectorNodeMeshletRange)
 
 protected:
 	/** Slot to receive signal when the prefix sum step has been done
 	* @return nothing */
 	void slotPrefixSumComplete();
 
+	/** Builds m_vectorDepthPyramid from the depth values of the previous frame copied into m_depthReadbackBuffer, each
+	* level stores for each texel the farthest depth of the four texels it covers in the previous level
+	* @return nothing */
+	void buildDepthPyramid();
+
+	/** Tests the axis aligned bounding box given as parameter against m_vectorDepthPyramid
+	* @param viewProjection [in] view projection matrix used when rendering the depth values in m_vectorDepthPyramid
+	* @param aabbMin        [in] bounding box minimum coordinates
+	* @param aabbMax        [in] bounding box maximum coordinates
+	* @return true if the bounding box is completely behind the depth values in m_vectorDepthPyramid, false otherwise */
+	bool isOccluded(const mat4& viewProjection, const vec3& aabbMin, const vec3& aabbMax);
+
+	/** Sets to zero the instance count of the main camera indirect commands of the scene elements that pass the frustum
+	* test but are occluded in the depth pyramid, updating m_occlusionCulledCounter and m_drawnMainCameraCounter. The
+	* frustum test is repeated on the host with the instance data, so the indirect command buffer is not read back, and
+	* only the instance count of the occluded elements is uploaded
+	* @return nothing */
+	void applyOcclusionCulling();
+
+	/** Adds the meshlets of the node given as parameter to vectorMeshlet and one indirect command per meshlet to
+	* m_arrayMeshletIndirectCommandMainCamera and m_arrayMeshletIndirectCommandEmitterCamera
+	* @param node          [in]    node to add the meshlets from
+	* @param firstInstance [in]    first instance value of the node indirect commands
+	* @param vectorMeshlet [inout] vector with all the meshlets to cull
+	* @return index of the first meshlet of the node in vectorMeshlet (x field) and number of meshlets of the node (y field) */
+	uvec2 addNodeMeshlet(Node* node, uint firstInstance, vectorMeshletData& vectorMeshlet);
+
+	/** Tests each meshlet in m_vectorMeshlet against the frustum and position of the camera given as parameter, setting
+	* to zero the instance count of the indirect commands of the meshlets outside the frustum or back facing the camera.
+	* Nothing is done if the camera frustum didn't change since the last call, and only the range of indirect commands
+	* whose instance count changed is uploaded to indirectCommandBuffer
+	* @param camera                [in]    camera to test the meshlets against
+	* @param arrayLastFrustumPlane [inout] frustum planes of the camera in the last call
+	* @param vectorIndirectCommand [inout] indirect commands of the meshlets for the camera
+	* @param indirectCommandBuffer [in]    buffer with one indirect command per meshlet to update
+	* @param numCulled             [inout] number of culled meshlets, updated only if the camera frustum changed
+	* @return nothing */
+	void cullMeshlet(const Camera* camera, vec4* arrayLastFrustumPlane, vector<VkDrawIndexedIndirectCommand>& vectorIndirectCommand, Buffer* indirectCommandBuffer, uint& numCulled);
+
 	SignalComputeFrustumCullingCompletion m_signalComputeFrustumCullingCompletion;    //!< Signal for completion of the technique
 	Buffer*                               m_instanceDataBuffer;                       //!< Buffer with the information from Scene::m_vectorInstanceData
 	Buffer*                               m_frustumDebugBuffer;                       //!< Buffer for debug purposes
@@ -91,6 +158,30 @@ protected:
 	MaterialComputeFrustumCulling*        m_materialComputeFrustumCulling;            //!< Pointer to the compute frustum culling material
 	vectorNodePtr                         m_arrayNode;                                //!< Vector with pointers to the scene nodes with flag eMeshType E_MT_RENDER_MODEL
 	vectorInstanceData                    m_vectorInstanceData;                       //!< Vector with the scene elements position and bounding sphere radius
+	vectorInt                             m_vectorSceneIndexToInstance;               //!< Index in m_vectorInstanceData of each element in the scene model vector, -1 if the element is not in m_arrayNode
+	bool                                  m_occlusionCulling;                         //!< If true, the scene elements that pass the main camera frustum test are also tested against a depth pyramid built from the previous frame scene depth. Disabled by default, since it reads back the scene depth and builds the depth pyramid on the host each frame, enable it through setOcclusionCulling
+	Texture*                              m_sceneDepthTexture;                        //!< Pointer to the scenelightingdepth texture, copied each frame to m_depthReadbackBuffer
+	Buffer*                               m_depthReadbackBuffer;                      //!< Host visible buffer where the depth values of the previous frame are copied to build the depth pyramid
+	vectorUint8                           m_vectorDepthReadback;                      //!< Helper vector to retrieve the content of m_depthReadbackBuffer
+	vector<vectorFloat>                   m_vectorDepthPyramid;                       //!< Depth pyramid, each level stores the farthest depth of the four texels covered in the previous level
+	vector<uvec2>                         m_vectorDepthPyramidSize;                   //!< Size of each level of m_vectorDepthPyramid
+	mat4                                  m_depthViewProjection;                      //!< Main camera view projection matrix used to render the depth values present in m_depthReadbackBuffer
+	bool                                  m_depthViewProjectionValid;                 //!< True if m_depthViewProjection has been set at least once
+	uint                                  m_occlusionCulledCounter;                   //!< Number of scene elements that passed the main camera frustum test and were culled by the occlusion test in the last frame
+	uint                                  m_drawnMainCameraCounter;                   //!< Number of scene elements drawn for the main camera in the last frame
+	Node*                                 m_compactedGeometryNode;                    //!< Pointer to the sceneCompactedGeometry node (if present), whose meshlets are culled individually
+	vectorMeshletData                     m_vectorMeshlet;                            //!< Meshlets of m_compactedGeometryNode followed by the meshlets of each node in m_arrayNode
+	uvec2                                 m_compactedGeometryMeshletRange;            //!< Index of the first meshlet (x field) and number of meshlets (y field) of m_compactedGeometryNode in m_vectorMeshlet
+	vector<uvec2>                         m_vectorNodeMeshletRange;                   //!< Index of the first meshlet (x field) and number of meshlets (y field) in m_vectorMeshlet of each node in m_arrayNode
+	Buffer*                               m_meshletBuffer;                            //!< Buffer with the MeshletData of each of the meshlets in m_vectorMeshlet
+	Buffer*                               m_indirectCommandBufferMeshletMainCamera;   //!< Buffer with one indirect command per meshlet in m_vectorMeshlet for the main camera
+	Buffer*                               m_indirectCommandBufferMeshletEmitterCamera; //!< Buffer with one indirect command per meshlet in m_vectorMeshlet for the emitter camera
+	vector<VkDrawIndexedIndirectCommand>  m_arrayMeshletIndirectCommandMainCamera;    //!< Vector with the indirect commands of the meshlets in m_vectorMeshlet for the main camera
+	vector<VkDrawIndexedIndirectCommand>  m_arrayMeshletIndirectCommandEmitterCamera; //!< Vector with the indirect commands of the meshlets in m_vectorMeshlet for the emitter camera
+	vec4                                  m_arrayMeshletMainCameraFrustumPlane[6];    //!< Main camera frustum planes used in the last meshlet culling
+	vec4                                  m_arrayMeshletEmitterCameraFrustumPlane[6]; //!< Emitter camera frustum planes used in the last meshlet culling
+	uint                                  m_meshletCulledMainCameraCounter;           //!< Number of meshlets culled for the main camera in the last frame
+	uint                                  m_meshletCulledEmitterCameraCounter;        //!< Number of meshlets culled for the emitter camera in the last frame
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
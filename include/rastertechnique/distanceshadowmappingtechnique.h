@@ -22,6 +22,7 @@ limitations under the License.
 
 // PROJECT INCLUDES
 #include "../../include/rastertechnique/rastertechnique.h"
+#include "../../include/texture/shadowatlas.h"
 
 // CLASS FORWARDING
 class RenderPass;
@@ -81,16 +82,18 @@ public:
 
 	GET_PTR(Camera, m_camera, Camera)
 	GETCOPY(float, m_emitterRadiance, EmitterRadiance)
+	GET(ShadowAtlasRegion, m_atlasRegion, AtlasRegion)
 
 protected:
 	RenderPass*                    m_renderPass;                    //!< Render pass used for directional voxel shadow mapping technique
 	Framebuffer*                   m_framebuffer;                   //!< Framebuffer used for directional voxel shadow mapping technique
 	MaterialDistanceShadowMapping* m_material;                      //!< Material for the distance shadow mapping technique
 	Camera*                        m_camera;                        //!< Camera used by the technique
-	Texture*                       m_distanceShadowMappingTexture;  //!< Distance shadow mapping texture name
-	int                            m_shadowMapWidth;                //!< Voxel shadow map texture width
-	int                            m_shadowMapHeight;               //!< Voxel shadow map texture height
-	Texture*                       m_offscreenDistanceDepthTexture; //!< Offscreen distance depth texture used together with the color attachment
+	Texture*                       m_distanceShadowMappingTexture;  //!< Shadow atlas page texture where the distance shadow map region is
+	int                            m_shadowMapWidth;                //!< Distance shadow map region width
+	int                            m_shadowMapHeight;               //!< Distance shadow map region height
+	Texture*                       m_offscreenDistanceDepthTexture; //!< Shadow atlas depth scratch texture used together with the color attachment
+	ShadowAtlasRegion              m_atlasRegion;                   //!< Region of the shadow atlas where the distance shadow map is rasterized
 	float                          m_emitterRadiance;               //!< Radiance of the emitter this shadow map represents
 	bool                           m_useCompactedGeometry;          //!< flag to use GPU frustum culling geometry or the lower resolution compaced scene node for the distance shadow mapping
 };
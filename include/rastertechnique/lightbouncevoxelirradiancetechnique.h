@@ -37,6 +37,7 @@ class CameraVisibleVoxelTechnique;
 // DEFINES
 // TODO: unify in a single define in common .h file and remove all duplicates
 typedef Nano::Signal<void()> SignalLightBounceVoxelIrradianceCompletion;
+#define LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER 12 // Number of floats per voxel in lightBounceVoxelIrradianceBuffer and lightBounceVoxelFilteredIrradianceBuffer, two per voxel face with the irradiance first
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -70,6 +71,10 @@ public:
 	virtual void postCommandSubmit();
 
 	REF(SignalLightBounceVoxelIrradianceCompletion, m_signalLightBounceVoxelIrradianceCompletion, SignalLightBounceVoxelIrradianceCompletion)
+	GETCOPY_SET(uint, m_voxelFaceBudgetPerFrame, VoxelFaceBudgetPerFrame)
+	GETCOPY_SET(bool, m_irradianceCache, IrradianceCache)
+	GETCOPY_SET(float, m_temporalBlend, TemporalBlend)
+	GETCOPY_SET(float, m_temporalBlendThreshold, TemporalBlendThreshold)
 
 protected:
 	/** Slot to receive signal when the prefix sum step has been done
@@ -84,6 +89,77 @@ protected:
 	* @return nothing */
 	void slotCameraVisibleVoxelCompleted();
 
+	/** Slot to receive notification when the LitClusterTechnique has completed, the direct irradiance of some clusters
+	* changed and so the light bounce results in m_vectorVoxelIrradianceCached of the voxels seeing any of them are invalidated.
+	* If the changed clusters are not known, the whole cache is invalidated
+	* @return nothing */
+	void slotLitClusterCompleted();
+
+	/** Invalidates the light bounce results of all the voxels in m_vectorVoxelIrradianceCached
+	* @return nothing */
+	void invalidateIrradianceCache();
+
+	/** Builds, if not done yet, m_vectorClusterVisibleVoxelFirst and m_vectorClusterVisibleVoxel from the cluster visibility buffers
+	* @return true if the information is available, false if the cluster visibility has not been computed yet */
+	bool buildClusterVisibleVoxel();
+
+	/** Removes from m_vectorCameraVisibleVoxel the voxels whose light bounce results are still valid in the world space
+	* irradiance cache, moving the remaining ones to the beginning of the vector
+	* @return number of camera visible voxels that need the light bounce to be computed */
+	uint removeCachedCameraVisibleVoxel();
+
+	/** Marks as cached in m_vectorVoxelIrradianceCached the voxels of m_vectorCameraVisibleVoxel in the range given
+	* by the parameters, called once the light bounce of those voxels has been computed
+	* @param offset [in] index in m_vectorCameraVisibleVoxel of the first voxel to mark
+	* @param number [in] number of voxels to mark
+	* @return nothing */
+	void markCameraVisibleVoxelCached(uint offset, uint number);
+
+	/** Unlocks the lit cluster and camera visible voxel techniques and notifies the completion of the light bounce
+	* @return nothing */
+	void completeLightBounce();
+
+	/** Sets the dispatch size and number of threads of the light bounce material to process voxelNumber camera visible voxels
+	* @param voxelNumber [in] number of camera visible voxels to process (from the beginning of cameraVisibleVoxelCompactedBuffer)
+	* @return nothing */
+	void setBounceVoxelNumber(uint voxelNumber);
+
+	/** Sets the dispatch size and number of threads of the gaussian filter materials to process voxelNumber camera visible voxels
+	* @param voxelNumber [in] number of camera visible voxels to process (from the beginning of cameraVisibleVoxelCompactedBuffer)
+	* @return nothing */
+	void setFilterVoxelNumber(uint voxelNumber);
+
+	/** Sorts m_vectorCameraVisibleVoxel by distance to the main camera so the closest voxels, which have a bigger
+	* screen space footprint, receive the light bounce first when the computation is split across several frames
+	* @return nothing */
+	void sortCameraVisibleVoxelByImportance();
+
+	/** Copies to the beginning of cameraVisibleVoxelCompactedBuffer the next slice of m_vectorCameraVisibleVoxel to
+	* process, starting at m_sliceVoxelOffset and with at most the amount of voxels given by m_voxelFaceBudgetPerFrame,
+	* and sets the light bounce and gaussian filter dispatches to process it
+	* @return nothing */
+	void prepareNextSlice();
+
+	/** Copies, if not done yet, the content of voxelHashedPositionCompactedBuffer to m_vectorVoxelHashedPosition
+	* @return true if the information is available, false otherwise */
+	bool loadVoxelHashedPosition();
+
+	/** If the temporal blend is enabled, stores in m_vectorPreviousIrradiance the light bounce and filtered irradiance of
+	* the voxels in the slice about to be processed, and their indices in m_vectorSliceVoxelIndex
+	* @return nothing */
+	void storeSlicePreviousIrradiance();
+
+	/** Blends the new light bounce and filtered irradiance of the voxels in the slice just processed with the values
+	* stored by storeSlicePreviousIrradiance, using m_temporalBlend as weight of the new values. Voxels whose new values
+	* are within m_temporalBlendThreshold of the previous ones are marked as cached, the remaining ones need another pass
+	* @return true if the temporal blend was applied, false if no previous values were stored for the slice */
+	bool applyTemporalBlend();
+
+	/** Clears the recorded command buffer in case the sizes of the light bounce and gaussian filter dispatches differ
+	* from the ones in the last recorded command buffer, given by m_recordedDispatchSize
+	* @return nothing */
+	void updateRecordedCommandBuffer();
+
 	/** Slot for the keyboard signal when pressing the 3 key to remove 100 units from MaterialLightBounceVoxelIrradiance::m_formFactorVoxelToVoxelAdded
 	* @return nothing */
 	void slot3KeyPressed();
@@ -100,6 +176,12 @@ protected:
 	* @return nothing */
 	void slot6KeyPressed();
 
+	/** Slot for the keyboard signal when pressing the G key to run the CPU reference implementation in LightingReferenceHelper
+	* and compare its lit test and light bounce results with the ones in the GPU buffers. With the irradiance cache enabled,
+	* only the voxels in m_vectorVoxelIrradianceCached are compared
+	* @return nothing */
+	void slotGKeyPressed();
+
 	SignalLightBounceVoxelIrradianceCompletion  m_signalLightBounceVoxelIrradianceCompletion; //!< Signal for completion of the technique
 	BufferPrefixSumTechnique*                   m_techniquePrefixSum;                         //!< Pointer to the instance of the prefix sum technique
 	LitClusterProcessResultsTechnique*          m_litClusterProcessResultsTechnique;          //!< Pointer to the instace of the lit cluster process results technique
@@ -118,6 +200,24 @@ protected:
 	uint                                        m_cameraVisibleVoxelNumber;                   //!< Number of visible voxel determined by the CameraVisibleVoxelTechnique technique
 	uint                                        m_lightBounceIndirectLitCounter;              //!< Helper variable to take the value from m_lightBounceIndirectLitCounterBuffer
 	Buffer*                                     m_lightBounceVoxelGaussianFilterDebugBuffer;  //!< Buffer for debug purposes
+	uvec4                                       m_recordedDispatchSize;                       //!< Local workgroup x and y dimensions of the light bounce and gaussian filter dispatches in the last recorded command buffer, the command buffer is only recorded again if any of them changes
+	uint                                        m_voxelFaceBudgetPerFrame;                    //!< Maximum number of voxel faces to process by the light bounce each frame, initialized from the LIGHT_BOUNCE_VOXEL_FACE_BUDGET_PER_FRAME raster flag. If the camera visible voxels have more faces, the light bounce and gaussian filter are split across several frames. A value of 0 processes all camera visible voxels in a single frame
+	vectorUint                                  m_vectorCameraVisibleVoxel;                   //!< Copy of the camera visible voxels in cameraVisibleVoxelCompactedBuffer to process, sorted by importance when the light bounce is split across several frames
+	uint                                        m_sliceVoxelOffset;                           //!< Index in m_vectorCameraVisibleVoxel of the first voxel of the slice being processed
+	uint                                        m_sliceVoxelNumber;                           //!< Number of voxels in the slice being processed
+	bool                                        m_sliceInProgress;                            //!< True while the light bounce is being split across several frames
+	uint                                        m_voxelizationWidth;                          //!< Voxelization texture size
+	bool                                        m_irradianceCache;                            //!< If true, the light bounce results in lightBounceVoxelIrradianceBuffer are kept as a world space cache and only camera visible voxels not present in m_vectorVoxelIrradianceCached are computed, so camera movement only costs the newly visible voxels
+	vectorUint                                  m_vectorVoxelIrradianceCached;                //!< Bit array indexed by voxel hashed position, a bit set means the light bounce results of the voxel faces are valid for the current direct lighting
+	vectorUint                                  m_vectorClusterVisibleVoxelFirst;             //!< For each cluster, index in m_vectorClusterVisibleVoxel of the first voxel seeing it (with one extra element at the end)
+	vectorUint                                  m_vectorClusterVisibleVoxel;                  //!< Hashed position of the voxels with any face seeing each cluster, used to invalidate only the voxels affected by an emitter change
+	vectorUint                                  m_vectorVoxelHashedPosition;                  //!< Copy of voxelHashedPositionCompactedBuffer, to know the index of each occupied voxel from its hashed position
+	Buffer*                                     m_lightBounceVoxelFilteredIrradianceBuffer;   //!< Pointer to the lightBounceVoxelFilteredIrradianceBuffer buffer
+	float                                       m_temporalBlend;                              //!< Weight of the new light bounce results when blended with the previous ones, initialized from the LIGHT_BOUNCE_TEMPORAL_BLEND raster flag. A value of 1 disables the temporal blend
+	float                                       m_temporalBlendThreshold;                     //!< Maximum relative difference between the new and previous light bounce results of a voxel face to consider its temporal blend converged
+	bool                                        m_temporalBlendPending;                       //!< True if the temporal blend of any voxel processed in the current pass has not converged
+	vectorUint                                  m_vectorSliceVoxelIndex;                      //!< Index in voxelHashedPositionCompactedBuffer of each voxel of the slice being processed, UINT_MAX if not found
+	vectorFloat                                 m_vectorPreviousIrradiance;                   //!< Light bounce and filtered irradiance of each face of the voxels of the slice being processed, previous to processing it
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +38,8 @@ class MaterialLitClusterProcessResults;
 
 // DEFINES
 typedef Nano::Signal<void()> SignalLitClusterCompletion;
-#define NUM_ADDUP_ELEMENT_PER_THREAD 25
+#define NUM_ADDUP_ELEMENT_PER_THREAD     25
+#define LIT_CLUSTER_MAX_RELIGHT_DISPATCH 16 // Maximum number of dispatches per pass when relighting only the clusters affected by an emitter change
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -80,12 +81,40 @@ public:
 	* @return nothing */
 	void slotCameraDirty();
 
+	/** Computes how many clusters are affected by the emitter camera change, this is, how many clusters have their
+	* aabb intersecting the emitter frustum previous to the change or the current one. Clusters outside both frustums
+	* don't receive direct irradiance neither before nor after the change. The indices of the affected clusters are
+	* stored in m_vectorAffectedCluster
+	* @return number of affected clusters */
+	uint computeAffectedClusterNumber();
+
+	/** Computes the workgroup rows to dispatch for the reset cluster irradiance and lit cluster passes. If fullRelight
+	* is true, all the rows are dispatched, otherwise only the rows with the clusters in m_vectorAffectedCluster (reset
+	* pass) and with the occupied voxels owned by them (lit cluster pass), since the remaining ones are not lit neither
+	* before nor after the emitter change
+	* @param fullRelight [in] if true, the whole set of clusters and voxels is processed
+	* @return true if the dispatched rows changed and the command buffer has to be recorded again, false otherwise */
+	bool updateRelightDispatchRange(bool fullRelight);
+
+	/** Builds the ranges of workgroup rows to dispatch covering all the rows given as parameter. When more than
+	* LIT_CLUSTER_MAX_RELIGHT_DISPATCH ranges are needed, the rows between the closest ranges are dispatched as well
+	* @param vectorRow   [inout] workgroup rows to dispatch, sorted and made unique in the call
+	* @param numRow      [in]    number of workgroup rows of a full dispatch
+	* @param vectorRange [out]   first row (x) and number of rows (y) of each dispatch
+	* @return nothing */
+	static void buildDispatchRange(vectorUint& vectorRow, uint numRow, vectorUvec2& vectorRange);
+
 	REF(SignalLitClusterCompletion, m_signalLitClusterCompletion, SignalLitClusterCompletion)
 	GETCOPY(vec3, m_cameraPosition, CameraPosition)
 	GETCOPY(vec3, m_cameraForward, CameraForward)
 	GETCOPY(float, m_emitterRadiance, EmitterRadiance)
 	GETCOPY(uint, m_numAddUpElementPerThread, NumAddUpElementPerThread)
 	SET(bool, m_techniqueLock, TechniqueLock)
+	GETCOPY_SET(bool, m_incrementalRelight, IncrementalRelight)
+	GETCOPY_SET(float, m_incrementalRelightThreshold, IncrementalRelightThreshold)
+	GETCOPY(uint, m_affectedClusterNumber, AffectedClusterNumber)
+	GET(vectorUint, m_vectorAffectedCluster, VectorAffectedCluster)
+	GETCOPY(bool, m_affectedClusterKnown, AffectedClusterKnown)
 
 protected:
 	/** Slot to receive notification when the prefix sum of the scene voxelization has been completed
@@ -96,6 +125,12 @@ protected:
 	* @return nothing */
 	void slotClusterizationBuildFinalBufferCompletion();
 
+	/** Retrieves from clusterizationFinalBuffer the aabb of each cluster and stores it in world coordinates in
+	* m_vectorClusterMin and m_vectorClusterMax, used to know which clusters are affected by emitter changes. The
+	* occupied voxels owned by each cluster are stored in m_vectorClusterVoxelFirst and m_vectorClusterVoxel
+	* @return nothing */
+	void buildClusterWorldAABB();
+
 	SignalLitClusterCompletion               m_signalLitClusterCompletion;              //!< Signal for lit cluster completion
 	Buffer*                                  m_accumulatedIrradianceBuffer;             //!< Shader storage buffer where to store all irradiance in each light bounce step including irradiance from emitter arriving at the scene step
 	Buffer*                                  m_litClusterCounterBuffer;                 //!< Buffer used as atomic counter for the visible clusters present in m_litVisibleClusterBuffer
@@ -119,6 +154,19 @@ protected:
 	uint                                     m_numAddUpElementPerThread;                //!< Number of elements per thread to process when performing the add up process
 	uint                                     m_numAddUpStepThread;                      //!< Number of threads that will take care of the add up step process (one single step before accumulating the final value)
 	MaterialLitCluster*                      m_materialLitCluster;                      //!< Pointer to the instance of the lit cluster material
+	bool                                     m_incrementalRelight;                      //!< If true, emitter changes only relight the clusters affected by the change (inside the previous or current emitter frustum), and don't trigger a new lit cluster pass if there are none
+	float                                    m_incrementalRelightThreshold;             //!< Fraction of the total number of clusters affected by an emitter change above which a full relight is done
+	vectorVec3                               m_vectorClusterMin;                        //!< World space aabb minimum of each cluster in clusterizationFinalBuffer
+	vectorVec3                               m_vectorClusterMax;                        //!< World space aabb maximum of each cluster in clusterizationFinalBuffer
+	vectorUint                               m_vectorClusterVoxelFirst;                 //!< Index in m_vectorClusterVoxel of the first occupied voxel owned by each cluster in clusterizationFinalBuffer, with one extra element at the end
+	vectorUint                               m_vectorClusterVoxel;                      //!< Indices in voxelHashedPositionCompacted of the occupied voxels owned by each cluster, contiguous per cluster
+	vectorUvec2                              m_vectorResetDispatchRange;                //!< First workgroup row (x) and number of rows (y) of each dispatch of the reset cluster irradiance data pass
+	vectorUvec2                              m_vectorLitClusterDispatchRange;           //!< First workgroup row (x) and number of rows (y) of each dispatch of the lit cluster pass
+	vec4                                     m_arrayLitEmitterFrustumPlane[6];          //!< Emitter frustum planes used in the last lit cluster pass
+	bool                                     m_litEmitterFrustumValid;                  //!< True if m_arrayLitEmitterFrustumPlane has been initialized with the emitter frustum of a lit cluster pass
+	uint                                     m_affectedClusterNumber;                   //!< Number of clusters affected by the last emitter change, computed in computeAffectedClusterNumber
+	vectorUint                               m_vectorAffectedCluster;                   //!< Indices of the clusters affected by the last emitter change, computed in computeAffectedClusterNumber
+	bool                                     m_affectedClusterKnown;                    //!< True if the last lit cluster pass was requested through the incremental relight path, so only the clusters in m_vectorAffectedCluster changed their irradiance
 
 	// ResetClusterIrradianceDataTechnique
 	MaterialResetClusterIrradianceData*      m_materialResetClusterIrradianceData;      //!< Pointer to the instance of the material used by this technique
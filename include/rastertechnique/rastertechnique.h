@@ -41,6 +41,7 @@ class RasterTechnique : public GenericResource
 	friend class RasterTechniqueManager;
 	friend class CoreManager;
 	friend class GPUPipeline;
+	friend class TextureManager;
 	DECLARE_FRIEND_REGISTERER(RasterTechnique)
 
 protected:
@@ -92,6 +93,13 @@ public:
 	* @return command buffer the technique has recorded to */
 	virtual VkCommandBuffer* record(int currentImage, uint& commandBufferID, CommandBufferType& commandBufferType);
 
+	/** Called once the output resolution has changed and the output relative textures and framebuffers have been
+	* resized. Techniques whose recorded commands depend on the output resolution (m_outputSizeDependent) and the last
+	* technique of the pipeline (which records to the swap chain framebuffers) clear their recorded command buffers,
+	* so they are recorded again with the new size
+	* @return nothing */
+	virtual void outputResized();
+
 	/** Shut down
 	* @return nothing */
 	virtual void shutdown();
@@ -110,6 +118,7 @@ public:
 	GETCOPY(RasterTechniqueType, m_rasterTechniqueType, RasterTechniqueType)
 	GETCOPY(bool, m_computeHostSynchronize, ComputeHostSynchronize)
 	GETCOPY(float, m_lastExecutionTime, LastExecutionTime)
+	GETCOPY(bool, m_outputSizeDependent, OutputSizeDependent)
 
 protected:	
 	/** Tests if the resource with name given by materialResourceName is used in this raster technique,
@@ -119,11 +128,19 @@ protected:
 	* @return true if the raster technique was affected by the notification, and false otherwise */
 	bool materialResourceNotification(string&& materialResourceName, ManagerNotificationType notificationType);
 
-	/** Adds to m_mapIdCommandBuffer a new command buffer, returning its unique id and a pointer to the added variable
+	/** Adds to m_mapIdCommandBuffer a new command buffer, returning its unique id and a pointer to the added variable.
+	* The command buffer is taken from m_vectorRecycledCommandBuffer if any is available (already reset), and allocated
+	* from the graphics / compute command pool (depending on m_rasterTechniqueType) otherwise
 	* @param commandBufferId [in] command buffer generated unique id
 	* return pointer to the command buffer variable added to m_mapIdCommandBuffer */
 	VkCommandBuffer* addRecordedCommandBuffer(uint& commandBufferId);
 
+	/** Moves all the command buffers in m_vectorCommand to m_vectorRecycledCommandBuffer so they are reused by the next
+	* calls to addRecordedCommandBuffer instead of allocating new ones, removing them from m_mapIdCommandBuffer and
+	* m_mapUintCommandBufferType, and clearing m_vectorCommand. Used when a technique needs to record its commands again
+	* @return nothing */
+	void clearRecordedCommandBuffer();
+
 	/** Will add to m_mapUintCommandBufferType a new pair, with the id representing a command buffer in m_mapIdCommandBuffer
 	* and the type of queue that command buffer recorded to.
 	* @param commandBufferId   [in] command buffer generated unique id
@@ -131,7 +148,7 @@ protected:
 	* return true if the new pair was added successfully, false otherwise */
 	bool addCommandBufferQueueType(uint commandBufferId, CommandBufferType commandBufferType);
 
-	/** Destroy command buffers in m_mapIdCommandBuffer
+	/** Destroy command buffers in m_mapIdCommandBuffer and m_vectorRecycledCommandBuffer
 	* @return nothing */
 	void destroyCommandBuffers();
 
@@ -163,11 +180,13 @@ protected:
 	uint                     m_queryIndex0;              //!< One of the two indices of the queries used for performance measurement in the query pool
 	uint                     m_queryIndex1;              //!< One of the two indices of the queries used for performance measurement in the query pool
 	vectorCommandBufferPtr   m_vectorCommand;            //!< Vector with the command buffers recorded by this technique
+	vector<VkCommandBuffer>  m_vectorRecycledCommandBuffer; //!< Vector with command buffers previously recorded by this technique and no longer used, reused when recording again
 	uint                     m_usedCommandBufferNumber;  //!< Number of command buffers this raster technique needs. For instance, the last technique in the pipeline will need to record as many command buffers as images are there in the swap chain. The value here is also the numer of elements added to m_vectorSemaphore
 	uint                     m_neededSemaphoreNumber;    //!< Number of semaphore elements to generate in m_vectorSemaphore
 	vector<VkSemaphore>      m_vectorSemaphore;          //!< Technique's semaphores for wait and signaling when submitting command buffers (more than one semaphore might be needed in case the technique submits more than one command buffer per swapchain image).
 	bool                     m_isLastPipelineTechnique;  //!< True in case this raster technique is the last one in the pipeline, meaning it needs to record as many command buffers as the number of swapchain images
 	RasterTechniqueType      m_rasterTechniqueType;      //!< Raster technique type, what queue type (compute or graphics) this technique will submit command buffers to
+	bool                     m_outputSizeDependent;      //!< True if the commands recorded by this technique depend on the output resolution (render area, viewport or output relative attachments), recorded again in outputResized
 	bool                     m_computeHostSynchronize;   //!< In case the raster technique is of type RasterTechniqueType::RTT_COMPUTE, whether to wait for the command buffer send to the compute technique before continuing submitting more command buffers from the same / other techniques. This can be useful for techniques that iterate, sending several command buffers to the compute queue
 };
 
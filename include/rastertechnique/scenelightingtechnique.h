@@ -111,6 +111,8 @@ protected:
 	Framebuffer*         m_framebuffer;                     //!< Framebuffer used
 	Buffer*              m_indirectCommandBufferMainCamera; //!< Pointer to the indirect command buffer for the main camera
 	vectorNodePtr        m_arrayNode;                       //!< Vector with pointers to the scene nodes with flag eMeshType E_MT_RENDER_MODEL
+	vectorUint           m_arrayNodeMaterialHandle;         //!< Material manager handle of the lighting material of each element in m_arrayNode, resolved at init
+	vectorUint           m_arrayNodeSceneIndex;             //!< Index in the scene of each element in m_arrayNode, resolved at init
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@ limitations under the License.
 
 // PROJECT INCLUDES
 #include "../../include/rastertechnique/rastertechnique.h"
+#include "../../include/texture/shadowatlas.h"
 
 // CLASS FORWARDING
 class RenderPass;
@@ -92,13 +93,14 @@ protected:
 	Framebuffer*                m_framebuffer;               //!< Framebuffer used for directional voxel shadow mapping technique
 	MaterialShadowMappingVoxel* m_material;                  //!< Material for directional voxel shadow mapping
 	Camera*                     m_shadowMappingCamera;       //!< Voxel shadow mapping camera, is the same as the one used in the shadow mapping technique
-	Texture*                    m_shadowMappingTexture;      //!< Voxel shadow mapping texture
-	int                         m_shadowMapWidth;            //!< Voxel shadow map texture width
-	int                         m_shadowMapHeight;           //!< Voxel shadow map texture height
+	Texture*                    m_shadowMappingTexture;      //!< Shadow atlas page texture where the voxel shadow map region is
+	int                         m_shadowMapWidth;            //!< Voxel shadow map region width
+	int                         m_shadowMapHeight;           //!< Voxel shadow map region height
 	uint                        m_numUsedVertex;             //!< Number of used vertices for building the geometry used in the voxel shadow map pass
 	bool                        m_prefixSumCompleted;        //!< Flag to know if the prefix sum step has completed
 	bool                        m_newPassRequested;          //!< If true, new pass was requested to process the assigned buffer
-	Texture*                    m_offscreenDepthTexture;     //!< Offscreen depth texture used together with the color attachment
+	Texture*                    m_offscreenDepthTexture;     //!< Shadow atlas depth scratch texture used together with the color attachment
+	ShadowAtlasRegion           m_atlasRegion;               //!< Region of the shadow atlas where the voxel shadow map is rasterized
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@ limitations under the License.
 
 // PROJECT INCLUDES
 #include "../../include/node/node.h"
+#include "../../include/scene/scenebvh.h"
 #include "../../include/util/singleton.h"
 #include "../../include/commonnamespace.h"
 
@@ -95,7 +96,7 @@ public:
 	* @return index of the found element or -1 otherwise */
 	int getElementIndexByName(string&& name);
 
-	/** Returns the index of the node given by the node parameter in the m_vModel vector
+	/** Returns the index of the node given by the node parameter in the m_vModel vector, resolved through m_mapNodeIndex
 	* @param node [in] node to search in m_mapStringNode
 	* @return index of the found node or -1 otherwise */
 	int getElementIndex(Node* node);
@@ -110,6 +111,20 @@ public:
 	* @return vector with the scene elements with the flags given by meshType parameter */
 	vectorNodePtr getByMeshType(eMeshType meshType);
 
+	/** Casts a ray against the scene elements referenced by m_sceneBVH, returning the closest one hit (used for picking)
+	* @param origin    [in]  ray origin in world space
+	* @param direction [in]  normalized ray direction in world space
+	* @param distance  [out] distance from origin to the closest hit
+	* @return closest scene element hit, nullptr if none was hit */
+	Node* raycastElement(const vec3& origin, const vec3& direction, float& distance) const;
+
+	/** Returns a vector with the scene elements referenced by m_sceneBVH whose bounding box overlaps the sphere given as parameter
+	* (used for instance for emitter to scene element proximity queries)
+	* @param center [in] sphere center in world space
+	* @param radius [in] sphere radius
+	* @return vector with the scene elements found */
+	vectorNodePtr getElementInRadius(const vec3& center, float radius) const;
+
 	/** Add cameraParameter to m_vectorCamera if not already added
 	param cameraParameter [in] light to add to the scene if not already added
 	* @ return true if added successfully, false otherwise */
@@ -120,10 +135,13 @@ public:
 	GET(vectorNodePtr, m_model, Model)
 	REF(vectorNodePtr, m_model, Model)
 	GET(vectorNodePtr, m_lightVolumes, LightVolumes)
+	GET(string, m_scenePath, ScenePath)
 	GET(string, m_sceneName, SceneName)
 	GET(vectorString, m_transparentKeywords, TransparentKeywords)
 	GET(vectorString, m_avoidDecimateKeywords, AvoidDecimateKeywords)
 	GETCOPY_SET(float, m_executionTime, ExecutionTime)
+	GET(SceneBVH, m_sceneBVH, SceneBVH)
+	GET(vectorUint, m_vectorRefitElementIndex, VectorRefitElementIndex)
 
 protected:
 	float		        m_deltaTime;             //!< Delta time, the time between the last frame rendered and this frame
@@ -131,6 +149,7 @@ protected:
 	vectorNodePtr       m_model;                 //!< Models in scene 
 	vectorNodePtr       m_lightVolumes;          //!< Scene light volumes
 	mapStringNode       m_mapStringNode;         //!< Map with the key mapped value pair <string, node pointer> to locate quicker nodes by name
+	unordered_map<const Node*, int> m_mapNodeIndex; //!< Hashed map with the index of each node in m_model, rebuilt by getElementIndex when m_model changes
 	Camera*             m_sceneCamera;           //!< Scene camera
 	static string       m_scenePath;             //!< Path to the scene to load
 	static string       m_sceneName;             //!< Name of the scene file to load
@@ -138,6 +157,8 @@ protected:
 	static vectorString m_avoidDecimateKeywords; //!< Vector with strings to be used to identify scene elements hat should not be decimated  or should have a quite high face count target (90% of the original or more)
 	vectorCameraPtr     m_vectorCamera;          //!< Vector with all the scene cameras (emitters also have their cameras here)
 	float               m_executionTime;         //!< Time the application has been running
+	SceneBVH            m_sceneBVH;              //!< BVH over the bounding boxes of the E_MT_RENDER_MODEL and E_MT_EMITTER_MODEL elements of m_model, built in update when the number of scene elements changes
+	vectorUint          m_vectorRefitElementIndex; //!< Index in m_model of the elements whose bounding box was refitted in the last call to update, to allow incremental updates of data depending on it
 };
 
 static Scene *s_pSceneSingleton;
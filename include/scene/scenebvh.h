@@ -0,0 +1,147 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _SCENEBVH_H_
+#define _SCENEBVH_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/commonnamespace.h"
+
+// CLASS FORWARDING
+class Node;
+
+// NAMESPACE
+using namespace commonnamespace;
+
+// DEFINES
+#define SCENE_BVH_LEAF_SIZE       2  // Maximum number of scene elements referenced by a BVH leaf
+#define SCENE_BVH_MAX_STACK_DEPTH 64 // Size of the traversal stack used in the BVH queries
+
+/** Node of the scene BVH. Inner nodes reference their two children, leaves reference a range of SceneBVH::m_vectorPrimitive */
+struct SceneBVHNode
+{
+	vec3 m_min;    // Bounding box minimum
+	vec3 m_max;    // Bounding box maximum
+	int  m_parent; // Index of the parent node in SceneBVH::m_vectorBVHNode, -1 for the root
+	int  m_left;   // Index of the left child for inner nodes, index of the first primitive in SceneBVH::m_vectorPrimitive for leaves
+	int  m_right;  // Index of the right child for inner nodes, -1 for leaves
+	int  m_count;  // Number of primitives for leaves, 0 for inner nodes
+};
+
+typedef vector<SceneBVHNode> vectorSceneBVHNode;
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+// Bounding volume hierarchy built over the world space bounding boxes of the scene elements. Elements are referenced by their index
+// in the vector given at build time (the scene model vector), so queries return indices usable with Scene::getElementIndex
+class SceneBVH
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	SceneBVH();
+
+	/** Builds the BVH over the world space bounding boxes of the elements in vectorNode with mesh type flags in meshType, splitting each
+	* BVH node at the median of the element centroids along the longest axis. Elements not matching meshType are not referenced by the BVH
+	* @param vectorNode [in] scene elements
+	* @param meshType   [in] flags of the elements to add to the BVH
+	* @return nothing */
+	void build(const vectorNodePtr& vectorNode, uint meshType);
+
+	/** Updates the bounds of the leaf referencing the element with index given as parameter from the element current bounding box, and
+	* propagates the change upwards, stopping as soon as an ancestor bounding box does not change
+	* @param elementIndex [in] index of the element in the vector used in build
+	* @return nothing */
+	void refit(int elementIndex);
+
+	/** Removes all the BVH data
+	* @return nothing */
+	void clear();
+
+	/** Returns in vectorResult the index of the elements whose bounding box overlaps the box given by min and max
+	* @param min          [in]    box minimum
+	* @param max          [in]    box maximum
+	* @param vectorResult [inout] indices of the elements found
+	* @return nothing */
+	void queryBox(const vec3& min, const vec3& max, vectorInt& vectorResult) const;
+
+	/** Returns in vectorResult the index of the elements whose bounding box overlaps the sphere given by center and radius
+	* @param center       [in]    sphere center
+	* @param radius       [in]    sphere radius
+	* @param vectorResult [inout] indices of the elements found
+	* @return nothing */
+	void querySphere(const vec3& center, float radius, vectorInt& vectorResult) const;
+
+	/** Casts the ray given by origin and direction against the triangles of the elements whose bounding box the ray hits, visiting
+	* the closest BVH nodes first and skipping those farther than the current closest hit
+	* @param origin    [in]  ray origin in world space
+	* @param direction [in]  normalized ray direction in world space
+	* @param distance  [out] distance from origin to the closest hit
+	* @return index of the closest element hit, -1 if no element was hit */
+	int raycast(const vec3& origin, const vec3& direction, float& distance) const;
+
+	/** Returns true if the BVH was built for a vector of elements of size given as parameter
+	* @param numElement [in] number of elements
+	* @return true if the BVH was built for numElement elements, false otherwise */
+	bool isBuiltFor(uint numElement) const;
+
+	GET(vectorSceneBVHNode, m_vectorBVHNode, VectorBVHNode)
+	GET(vectorInt, m_vectorPrimitive, VectorPrimitive)
+
+protected:
+	/** Recursively builds the BVH node covering the primitives in the range [first, first + count) of m_vectorPrimitive
+	* @param first  [in] first primitive in m_vectorPrimitive
+	* @param count  [in] number of primitives
+	* @param parent [in] index of the parent BVH node, -1 for the root
+	* @return index of the BVH node built in m_vectorBVHNode */
+	int buildRecursive(int first, int count, int parent);
+
+	/** Computes the bounding box of the BVH node given as parameter from its primitives (leaves) or its children (inner nodes)
+	* @param bvhNodeIndex [in] index of the BVH node in m_vectorBVHNode
+	* @return nothing */
+	void computeBounds(int bvhNodeIndex);
+
+	/** Slab test between the ray given by origin and inverse direction and the box given by min and max
+	* @param origin           [in]  ray origin
+	* @param inverseDirection [in]  component-wise inverse of the ray direction
+	* @param min              [in]  box minimum
+	* @param max              [in]  box maximum
+	* @param distance         [out] distance to the entry point, 0 if the origin is inside the box
+	* @return true if the ray hits the box, false otherwise */
+	static bool rayBoxIntersection(const vec3& origin, const vec3& inverseDirection, const vec3& min, const vec3& max, float& distance);
+
+	/** Intersects the ray given by origin and direction with the triangles of the element given as parameter, in the element object space
+	* @param elementIndex [in]    index of the element in m_vectorNode
+	* @param origin       [in]    ray origin in world space
+	* @param direction    [in]    ray direction in world space
+	* @param distance     [inout] closest distance found so far, updated if a closer triangle is hit
+	* @return true if a triangle closer than distance was hit, false otherwise */
+	bool raycastElement(int elementIndex, const vec3& origin, const vec3& direction, float& distance) const;
+
+	vectorNodePtr      m_vectorNode;        //!< Elements given in build, indexed by element index
+	vectorSceneBVHNode m_vectorBVHNode;     //!< BVH nodes, the root being the first one
+	vectorInt          m_vectorPrimitive;   //!< Element indices referenced by the leaves, sorted so each leaf references a contiguous range
+	vectorInt          m_vectorElementLeaf; //!< Index in m_vectorBVHNode of the leaf referencing each element, -1 for elements not in the BVH
+	vectorVec3         m_vectorCentroid;    //!< Bounding box center of each element at build time, used to partition the primitives
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _SCENEBVH_H_
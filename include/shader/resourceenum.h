@@ -225,6 +225,53 @@ namespace resourceenum
 
 	/////////////////////////////////////////////////////////////////////////////////////////////
 
+	/** Returns true if variables of the C++ type T hold values of the ResourceInternalType given as parameter, used to
+	* type check the member variables exposed by the materials before their data is copied to the shader struct fields
+	* @param resourceInternalType [in] type to test
+	* @return true if variables of the C++ type T hold values of the ResourceInternalType given as parameter, false otherwise */
+	template <class T> bool isResourceInternalTypeOf(ResourceInternalType resourceInternalType) { return false; }
+
+	template <> inline bool isResourceInternalTypeOf<float>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_FLOAT); }
+	template <> inline bool isResourceInternalTypeOf<vec2>(ResourceInternalType resourceInternalType)         { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_VEC2); }
+	template <> inline bool isResourceInternalTypeOf<vec3>(ResourceInternalType resourceInternalType)         { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_VEC3); }
+	template <> inline bool isResourceInternalTypeOf<vec4>(ResourceInternalType resourceInternalType)         { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_VEC4); }
+	template <> inline bool isResourceInternalTypeOf<double>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE); }
+	template <> inline bool isResourceInternalTypeOf<dvec2>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_VEC2); }
+	template <> inline bool isResourceInternalTypeOf<dvec3>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_VEC3); }
+	template <> inline bool isResourceInternalTypeOf<dvec4>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_VEC4); }
+	template <> inline bool isResourceInternalTypeOf<int>(ResourceInternalType resourceInternalType)          { return (resourceInternalType == ResourceInternalType::RIT_INT); }
+	template <> inline bool isResourceInternalTypeOf<ivec2>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_INT_VEC2); }
+	template <> inline bool isResourceInternalTypeOf<ivec3>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_INT_VEC3); }
+	template <> inline bool isResourceInternalTypeOf<ivec4>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_INT_VEC4); }
+	template <> inline bool isResourceInternalTypeOf<unsigned int>(ResourceInternalType resourceInternalType) { return (resourceInternalType == ResourceInternalType::RIT_UNSIGNED_INT); }
+	template <> inline bool isResourceInternalTypeOf<uvec2>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_UNSIGNED_INT_VEC2); }
+	template <> inline bool isResourceInternalTypeOf<uvec3>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_UNSIGNED_INT_VEC3); }
+	template <> inline bool isResourceInternalTypeOf<uvec4>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_UNSIGNED_INT_VEC4); }
+	template <> inline bool isResourceInternalTypeOf<bool>(ResourceInternalType resourceInternalType)         { return (resourceInternalType == ResourceInternalType::RIT_BOOL); }
+	template <> inline bool isResourceInternalTypeOf<bvec2>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_BOOL_VEC2); }
+	template <> inline bool isResourceInternalTypeOf<bvec3>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_BOOL_VEC3); }
+	template <> inline bool isResourceInternalTypeOf<bvec4>(ResourceInternalType resourceInternalType)        { return (resourceInternalType == ResourceInternalType::RIT_BOOL_VEC4); }
+	template <> inline bool isResourceInternalTypeOf<mat2>(ResourceInternalType resourceInternalType)         { return ((resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT2) || (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT2x2)); }
+	template <> inline bool isResourceInternalTypeOf<mat3>(ResourceInternalType resourceInternalType)         { return ((resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT3) || (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT3x3)); }
+	template <> inline bool isResourceInternalTypeOf<mat4>(ResourceInternalType resourceInternalType)         { return ((resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT4) || (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT4x4)); }
+	template <> inline bool isResourceInternalTypeOf<mat2x3>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT2x3); }
+	template <> inline bool isResourceInternalTypeOf<mat2x4>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT2x4); }
+	template <> inline bool isResourceInternalTypeOf<mat3x2>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT3x2); }
+	template <> inline bool isResourceInternalTypeOf<mat3x4>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT3x4); }
+	template <> inline bool isResourceInternalTypeOf<mat4x2>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT4x2); }
+	template <> inline bool isResourceInternalTypeOf<mat4x3>(ResourceInternalType resourceInternalType)       { return (resourceInternalType == ResourceInternalType::RIT_FLOAT_MAT4x3); }
+	template <> inline bool isResourceInternalTypeOf<dmat2>(ResourceInternalType resourceInternalType)        { return ((resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT2) || (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT2x2)); }
+	template <> inline bool isResourceInternalTypeOf<dmat3>(ResourceInternalType resourceInternalType)        { return ((resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT3) || (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT3x3)); }
+	template <> inline bool isResourceInternalTypeOf<dmat4>(ResourceInternalType resourceInternalType)        { return ((resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT4) || (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT4x4)); }
+	template <> inline bool isResourceInternalTypeOf<dmat2x3>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT2x3); }
+	template <> inline bool isResourceInternalTypeOf<dmat2x4>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT2x4); }
+	template <> inline bool isResourceInternalTypeOf<dmat3x2>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT3x2); }
+	template <> inline bool isResourceInternalTypeOf<dmat3x4>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT3x4); }
+	template <> inline bool isResourceInternalTypeOf<dmat4x2>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT4x2); }
+	template <> inline bool isResourceInternalTypeOf<dmat4x3>(ResourceInternalType resourceInternalType)      { return (resourceInternalType == ResourceInternalType::RIT_DOUBLE_MAT4x3); }
+
+	/////////////////////////////////////////////////////////////////////////////////////////////
+
 	/** Image access type */
 	enum class ImageAccessType
 	{
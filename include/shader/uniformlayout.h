@@ -0,0 +1,84 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _UNIFORMLAYOUT_H_
+#define _UNIFORMLAYOUT_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/material/exposedstructfield.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Field of an uniform layout, with the location of the exposed variable and of its value in the layout */
+struct UniformLayoutField
+{
+	const uint8_t* m_source; // Pointer to the exposed variable
+	uint           m_offset; // Offset in bytes of the field in the layout
+	uint           m_size;   // Size in bytes of the field
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Compiled layout of a set of exposed struct fields: the offset and size of each field are computed once from the
+* exposed variables, and a packed copy of their values is kept in m_data. Updating the layout is a comparison and a
+* copy per field, without going through the resource internal type of each field, and the packed copy can be
+* written to a uniform buffer cell with a single copy */
+class UniformLayout
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	UniformLayout();
+
+	/** Builds the layout for the exposed struct fields given as parameter, packed in the same order with the size of the
+	* type of each exposed variable. The packed copy of the values is initialized to zero
+	* @param vectorExposedStructField [in] exposed struct fields to build the layout for
+	* @return nothing */
+	void build(const vector<ExposedStructField>& vectorExposedStructField);
+
+	/** Empties the layout
+	* @return nothing */
+	void clear();
+
+	/** Compares the value of each exposed variable with its packed copy in m_data, updating the copy of the ones that
+	* changed and adding their index to vectorDirtyField
+	* @param vectorDirtyField [inout] vector where to add the index of the fields whose value changed
+	* @return true if any field changed, false otherwise */
+	bool update(vectorUint& vectorDirtyField);
+
+	GET(vector<UniformLayoutField>, m_vectorField, VectorField)
+	GET(vectorUint8, m_data, Data)
+	GETCOPY(uint, m_size, Size)
+
+protected:
+	vector<UniformLayoutField> m_vectorField; //!< Fields of the layout, in the same order as the exposed struct fields it was built from
+	vectorUint8                m_data;        //!< Packed copy of the values of the fields
+	uint                       m_size;        //!< Size in bytes of the layout
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _UNIFORMLAYOUT_H_
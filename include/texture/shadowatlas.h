@@ -0,0 +1,104 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _SHADOWATLAS_H_
+#define _SHADOWATLAS_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/commonnamespace.h"
+
+// CLASS FORWARDING
+class Texture;
+
+// NAMESPACE
+using namespace commonnamespace;
+
+// DEFINES
+#define SHADOW_ATLAS_PAGE_SIZE 8192 // Default width and height of each shadow atlas page, biggest region resolution that can be requested
+
+/** Rectangle of a shadow atlas page handed out to a shadow casting pass */
+struct ShadowAtlasRegion
+{
+	Texture* m_texture;     // Atlas page texture the region belongs to
+	uvec4    m_rectangle;   // Region offset (xy) and size (zw) in texels inside m_texture
+	vec4     m_scaleOffset; // Scale (xy) and offset (zw) mapping [0, 1] shadow map coordinates to the region inside m_texture
+};
+
+/** Shadow atlas page, regions are packed in horizontal shelves from top to bottom */
+struct ShadowAtlasPage
+{
+	Texture* m_texture;     // Page texture
+	VkFormat m_format;      // Page texture format
+	uint     m_shelfX;      // First free texel in the x axis of the current shelf
+	uint     m_shelfY;      // Offset in the y axis of the current shelf
+	uint     m_shelfHeight; // Height of the current shelf (height of its biggest region)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+class ShadowAtlas
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	ShadowAtlas();
+
+	/** Hands out a region of width x height texels from the pages with format given as parameter, building a new page
+	* named pageName if none of the existing ones has room for it. The page name is only used when a new page is built,
+	* so shaders sampling the first pass to request a page keep using the same texture name
+	* @param pageName [in]  name for the page texture in case a new one is built
+	* @param format   [in]  color format of the region
+	* @param width    [in]  region width
+	* @param height   [in]  region height
+	* @param region   [out] region handed out
+	* @return true if the region was allocated successfully, false otherwise */
+	bool allocateRegion(string&& pageName, VkFormat format, uint width, uint height, ShadowAtlasRegion& region);
+
+	/** Returns the depth scratch texture with format given as parameter, building it if it doesn't exist. The scratch
+	* textures have the size of an atlas page and are shared by all the shadow casting passes, which only need them
+	* while rasterizing and record their render passes one after the other
+	* @param format [in] depth format
+	* @return depth scratch texture */
+	Texture* getDepthScratchTexture(VkFormat format);
+
+	/** Forgets all pages and depth scratch textures, to be called when the texture manager destroys its resources
+	* @return nothing */
+	void clear();
+
+	GETCOPY_SET(uint, m_pageSize, PageSize)
+
+protected:
+	/** Tries to place a region of width x height texels in the page given as parameter, opening a new shelf if the
+	* current one has no room left
+	* @param page   [in]  page where to place the region
+	* @param width  [in]  region width
+	* @param height [in]  region height
+	* @param offset [out] offset of the region inside the page
+	* @return true if the region fits in the page, false otherwise */
+	bool placeRegion(ShadowAtlasPage& page, uint width, uint height, uvec2& offset);
+
+	vector<ShadowAtlasPage> m_vectorPage;          //!< Pages built so far
+	vector<Texture*>        m_vectorDepthScratch;  //!< Depth scratch textures built so far, one per depth format
+	uint                    m_pageSize;            //!< Width and height of each page and depth scratch texture
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _SHADOWATLAS_H_
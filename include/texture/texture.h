@@ -66,25 +66,51 @@ public:
 	GETCOPY(VkImageViewType, m_imageViewType, ImageViewType)
 	GETCOPY(VkImageCreateFlags, m_flags, Flags)
 	GETCOPY_SET(bool, m_isSwapChainTex, IsSwapChainTex)
+	GETCOPY(VkDeviceSize, m_memorySize, MemorySize)
+	GETCOPY(bool, m_streamed, Streamed)
+	GETCOPY(uint32_t, m_residentMipLevel, ResidentMipLevel)
+	GETCOPY(uint32_t, m_startupMipLevel, StartupMipLevel)
+	GETCOPY(uint32_t, m_fullMipMapLevels, FullMipMapLevels)
+	GETCOPY(uint32_t, m_fullWidth, FullWidth)
+	GETCOPY(uint32_t, m_fullHeight, FullHeight)
+	GETCOPY(uint32_t, m_requestedMipLevel, RequestedMipLevel)
+	GETCOPY(uint, m_lastRequestFrame, LastRequestFrame)
+	GETCOPY(bool, m_outputRelative, OutputRelative)
+	GETCOPY(vec2, m_outputRelativeScale, OutputRelativeScale)
 
 protected:
-	VkImage            m_image;           //!< Texture image
-	VkImageLayout      m_imageLayout;     //!< Enum with the image layout
-	VkDeviceMemory     m_mem;             //!< Image memory
-	VkDeviceSize       m_memorySize;      //!< Size of the image memory
-	VkImageView        m_view;            //!< Image view
-	uint32_t           m_mipMapLevels;    //!< Number of image mip-map levels
-	uint32_t           m_layerCount;      //!< Number of image layers
-	uint32_t           m_width;           //!< Image width
-	uint32_t           m_height;          //!< Image height
-	uint32_t           m_depth;           //!< Image depth
-	bool               m_generateMipmap;  //!< If true, mipmaps will be generated when setting the data of the texture
-	string             m_path;            //!< Texture path to the image file this texure has loaded (if any)
-	VkImageUsageFlags  m_imageUsageFlags; //!< Enum with the usage flags of this image
-	VkFormat           m_format;          //!< Image format
-	VkImageViewType    m_imageViewType;   //!< Image view type
-	VkImageCreateFlags m_flags;           //!< Image flags
-	bool               m_isSwapChainTex;  //!< Flag to know if this texture is a swapchain texture
+	VkImage               m_image;               //!< Texture image
+	VkImageLayout         m_imageLayout;         //!< Enum with the image layout
+	VkDeviceMemory        m_mem;                 //!< Image memory
+	VkDeviceSize          m_memorySize;          //!< Size of the image memory
+	VkImageView           m_view;                //!< Image view
+	uint32_t              m_mipMapLevels;        //!< Number of image mip-map levels
+	uint32_t              m_layerCount;          //!< Number of image layers
+	uint32_t              m_width;               //!< Image width
+	uint32_t              m_height;              //!< Image height
+	uint32_t              m_depth;               //!< Image depth
+	bool                  m_generateMipmap;      //!< If true, mipmaps will be generated when setting the data of the texture
+	string                m_path;                //!< Texture path to the image file this texure has loaded (if any)
+	VkImageUsageFlags     m_imageUsageFlags;     //!< Enum with the usage flags of this image
+	VkFormat              m_format;              //!< Image format
+	VkImageViewType       m_imageViewType;       //!< Image view type
+	VkImageCreateFlags    m_flags;               //!< Image flags
+	bool                  m_isSwapChainTex;      //!< Flag to know if this texture is a swapchain texture
+	bool                  m_streamed;            //!< True if only part of the mip chain of the texture file is resident, m_image then has the mip levels from m_residentMipLevel onwards
+	uint32_t              m_residentMipLevel;    //!< For streamed textures, finest mip level of the texture file resident in m_image (m_width, m_height and m_mipMapLevels refer to m_image)
+	uint32_t              m_startupMipLevel;     //!< For streamed textures, finest mip level of the texture file made resident when loading it, textures are never evicted beyond it
+	uint32_t              m_fullMipMapLevels;    //!< For streamed textures, number of mip levels of the texture file
+	uint32_t              m_fullWidth;           //!< For streamed textures, width of the first mip level of the texture file
+	uint32_t              m_fullHeight;          //!< For streamed textures, height of the first mip level of the texture file
+	uint32_t              m_requestedMipLevel;   //!< For streamed textures, finest mip level requested by the residency feedback in the last frame it was requested
+	uint                  m_lastRequestFrame;    //!< For streamed textures, last frame in which the residency feedback requested the texture
+	VkImageAspectFlags    m_aspectMask;          //!< Aspect mask used to build the image view, kept to rebuild the image when resizing it
+	VkImageAspectFlags    m_layoutAspectMask;    //!< Aspect mask used for the initial layout transition, kept to rebuild the image when resizing it
+	VkMemoryPropertyFlags m_memoryProperties;    //!< Memory properties of the image memory, kept to rebuild the image when resizing it
+	VkSampleCountFlagBits m_samples;             //!< Number of samples per pixel of the image, kept to rebuild the image when resizing it
+	VkImageTiling         m_tiling;              //!< Tiling of the image, kept to rebuild the image when resizing it
+	bool                  m_outputRelative;      //!< True if the size of the texture follows the output resolution, the texture is resized by TextureManager::resizeOutputRelativeTextures
+	vec2                  m_outputRelativeScale; //!< For output relative textures, scale applied to the output resolution to compute the texture size
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -18,20 +18,73 @@ limitations under the License.
 #define _TEXTUREMANAGER_H_
 
 // GLOBAL INCLUDES
+#include <thread>
+#include <atomic>
 
 // PROJECT INCLUDES
 #include "../../include/util/singleton.h"
 #include "../../include/util/managertemplate.h"
 #include "../../include/texture/textureinfo.h"
+#include "../../include/texture/shadowatlas.h"
 #include "../headers.h"
 
 // CLASS FORWARDING
 class Texture;
+class Camera;
 
 // NAMESPACE
 
 // DEFINES
 #define textureM s_pTextureManager->instance()
+#define TEXTURE_UPLOAD_STAGING_SEGMENT_SIZE  33554432 // Size in bytes of each segment of the texture upload staging ring
+#define TEXTURE_UPLOAD_STAGING_SEGMENT_COUNT 2        // Number of segments in the texture upload staging ring, while one is being copied to the images by the GPU the next one is filled
+#define TEXTURE_UPLOAD_STAGING_ALIGNMENT     16       // Alignment in bytes of each texture in the staging ring (multiple of any texel / compressed block size)
+#define TEXTURE_STREAMING_STARTUP_MAX_SIZE     256        // Maximum width / height of the finest mip level made resident when loading a streamed texture
+#define TEXTURE_STREAMING_MEMORY_BUDGET        1073741824 // Memory budget in bytes for the images of the streamed textures, least recently requested textures are evicted to stay under it
+#define TEXTURE_STREAMING_MAX_UPDATE_PER_FRAME 4          // Maximum number of streamed textures whose finer mip levels are requested each frame
+#define TEXTURE_STREAMING_EVICT_FRAMES         120        // Number of frames without being requested after which a streamed texture is evicted back to its startup mip level
+
+/** Texture pending to be uploaded in the current texture upload batch */
+struct TextureUploadRequest
+{
+	Texture*        m_texture;     // Texture to upload, its image, memory and view are already built
+	gli::texture2D* m_imageGLI2D;  // Texture decoded by a worker thread
+	TextureInfo*    m_textureInfo; // Mip map information of the decoded texture
+};
+
+/** Segment of the texture upload staging ring, all the copies of the textures in a segment are submitted together */
+struct TextureUploadSegment
+{
+	VkCommandBuffer  m_commandBuffer; // Command buffer with the copies of the segment, VK_NULL_HANDLE if not recording
+	VkFence          m_fence;         // Fence signaled once the copies of the segment have completed
+	bool             m_inFlight;      // True if the segment has been submitted and its fence not waited yet
+	VkDeviceSize     m_offset;        // Offset of the first free byte in the segment
+	vectorTexturePtr m_vectorTexture; // Textures whose copies are recorded in the segment
+};
+
+/** Change of the resident mip level of a streamed texture in progress: the texture file is decoded by a worker thread
+* (or, for evictions, the coarser mip levels are copied from the resident image), the copy to the new image is submitted
+* without waiting for it, and the new image replaces the texture's one once the copy has completed */
+struct TextureStreamingRequest
+{
+	Texture*        m_texture;          // Streamed texture to update
+	uint32_t        m_mipLevel;         // New finest resident mip level of the texture file
+	VkDeviceSize    m_estimatedMemory;  // Estimated memory size of the new image, used for the memory budget while the request is in progress
+	string          m_path;             // Path of the texture file, copied so the worker thread doesn't access the texture
+	thread          m_thread;           // Worker thread decoding the texture file
+	atomic<bool>    m_decoded;          // True once the worker thread has finished decoding the texture file
+	gli::texture2D* m_imageGLI2D;       // Texture decoded by the worker thread
+	TextureInfo*    m_textureInfo;      // Mip map information of the decoded texture
+	VkImage         m_image;            // New image, VK_NULL_HANDLE until the copy is submitted
+	VkDeviceMemory  m_memory;           // Memory of the new image
+	VkDeviceSize    m_memorySize;       // Size of the memory of the new image
+	VkExtent3D      m_extent;           // Extent of the finest mip level of the new image
+	uint32_t        m_mipMapLevels;     // Number of mip levels of the new image
+	Buffer*         m_stagingBuffer;    // Staging buffer with the data of the new image
+	VkCommandBuffer m_commandBuffer;    // Command buffer with the copy to the new image
+	VkFence         m_fence;            // Fence signaled once the copy to the new image has completed
+	bool            m_copyFromResident; // True if the new image is copied on the GPU from the coarser mip levels of the resident image, with no texture file decoding
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -129,6 +182,54 @@ public:
 	* @return built VkSampler */
 	VkSampler buildSampler(float minLod, float maxLod, VkSamplerMipmapMode mipmapMode, VkFilter minMagFilter);
 
+	/** Starts a texture upload batch: KTX textures built with build2DTextureFromFile from now on get their image, memory
+	* and view built immediately, but their data is decoded and uploaded in endTextureUploadBatch
+	* @return nothing */
+	void beginTextureUploadBatch();
+
+	/** Ends the texture upload batch started with beginTextureUploadBatch. The pending textures are decoded in chunks
+	* by worker threads and copied through the staging ring, with all the copies of a ring segment recorded in a
+	* single submission. Each texture is flagged as ready once its copy has completed. The method returns once all
+	* the pending textures are uploaded
+	* @return nothing */
+	void endTextureUploadBatch();
+
+	/** Updates the resident mip levels of the streamed textures: the residency feedback of the main camera gives the
+	* finest mip level needed for each texture, the textures with the biggest difference between the needed and the
+	* resident mip level get their finer mip levels streamed in (up to TEXTURE_STREAMING_MAX_UPDATE_PER_FRAME per
+	* call), and the least recently requested ones are evicted to keep the streamed textures under
+	* TEXTURE_STREAMING_MEMORY_BUDGET. The texture files are decoded by worker threads only to stream in finer mip
+	* levels, evictions copy the coarser mip levels from the resident image. The copies are not waited for, the images
+	* are replaced in a later call. Must be called while the GPU is idle, since images in use are replaced
+	* @return nothing */
+	void updateTextureStreaming();
+
+	/** Flags the texture given as parameter as output relative: its size follows the output resolution scaled by the
+	* scale given as parameter, and it is resized by resizeOutputRelativeTextures. Only textures built with
+	* buildTexture can be flagged
+	* @param texture [in] texture to flag
+	* @param scale   [in] scale applied to the output resolution to compute the texture size
+	* @return true if the texture was flagged, false otherwise */
+	bool setOutputRelative(Texture* texture, vec2 scale);
+
+	/** Replaces the image, memory and view of the texture given as parameter with new ones of the extent given as
+	* parameter, keeping the rest of its properties. The descriptor sets of the materials sampling it are updated and
+	* a MNT_CHANGED notification is emitted, so the framebuffers using it as attachment are rebuilt. Must be called
+	* while the GPU is idle, since images in use are replaced
+	* @param texture [in] texture to resize
+	* @param extent  [in] new texture extent
+	* @return true if the texture was resized, false otherwise */
+	bool resizeTexture(Texture* texture, VkExtent3D extent);
+
+	/** Resizes all the textures flagged as output relative to the output resolution given as parameter scaled by
+	* each texture's output relative scale
+	* @param width  [in] output width
+	* @param height [in] output height
+	* @return nothing */
+	void resizeOutputRelativeTextures(uint32_t width, uint32_t height);
+
+	REF(ShadowAtlas, m_shadowAtlas, ShadowAtlas)
+
 protected:
 	/** Builds an VkImage with the format, size, usage and mip level number given as parameter
 	* @param format        [in] image format
@@ -177,6 +278,132 @@ protected:
 		VkImageLayout             destinationLayout,
 		VkImageViewType           imageViewType);
 
+	/** Records in commandBufferTexture the layout transitions and the copies of all the mip map levels of the image
+	* given as parameter from buffer, starting at bufferOffset
+	* @param buffer             [in] buffer with the image data
+	* @param bufferOffset       [in] offset in bytes of the image data in buffer
+	* @param mipMap             [in] number of mip maps to copy
+	* @param image              [in] image to fill information
+	* @param vectorMipMapExtent [in] vector with the image dimensions of each of the mip map levels
+	* @param vectorMipMapSize   [in] vector with the size in bytes of each of the mip map levels
+	* @param destinationLayout  [in] layout used for the image as copy destination
+	* @param imageViewType      [in] image view type
+	* @return nothing */
+	void recordImageMemoryMipmapsCopy(
+		VkBuffer                  buffer,
+		VkDeviceSize              bufferOffset,
+		uint32_t                  mipMap,
+		VkImage                   image,
+		const vector<VkExtent3D>& vectorMipMapExtent,
+		const vector<uint>&       vectorMipMapSize,
+		VkImageLayout             destinationLayout,
+		VkImageViewType           imageViewType);
+
+	/** Reads the extent and number of mip map levels from the header of the KTX file given as parameter
+	* @param path      [in]  path to the KTX file
+	* @param extent    [out] extent of the first mip map level
+	* @param mipLevels [out] number of mip map levels
+	* @return true if the file is a valid KTX file, false otherwise */
+	static bool readKTXHeader(const string& path, VkExtent3D& extent, uint32_t& mipLevels);
+
+	/** Decodes in parallel the pending textures in m_vectorUploadRequest in the range [start, end)
+	* @param start [in] first request to decode
+	* @param end   [in] one past the last request to decode
+	* @return nothing */
+	void decodeUploadRequest(uint start, uint end);
+
+	/** Submits the copies recorded in the staging ring segment given as parameter, if any
+	* @param segment [in] segment to submit
+	* @return nothing */
+	void submitUploadSegment(TextureUploadSegment& segment);
+
+	/** Waits for the copies of the staging ring segment given as parameter to complete, flagging its textures as ready
+	* and leaving the segment empty
+	* @param segment [in] segment to wait for
+	* @return nothing */
+	void waitUploadSegment(TextureUploadSegment& segment);
+
+	/** Builds the extent and size of each mip level of the texture data given by textureInfo from the mip level
+	* firstMipLevel onwards, and the offset and size of those mip levels in the texture data
+	* @param texture            [in]  texture the data belongs to
+	* @param textureInfo        [in]  decoded texture data, with all the mip levels of the texture file
+	* @param firstMipLevel      [in]  first mip level of the texture file to take into account
+	* @param vectorMipMapExtent [out] extent of each mip level from firstMipLevel onwards
+	* @param vectorMipMapSize   [out] size in bytes of each mip level from firstMipLevel onwards
+	* @param dataOffset         [out] offset in bytes of the mip level firstMipLevel in the texture data
+	* @param dataSize           [out] size in bytes of the mip levels from firstMipLevel onwards
+	* @return true if the decoded data matches the texture file information of the texture, false otherwise */
+	static bool buildMipMapCopyData(
+		const Texture*      texture,
+		TextureInfo*        textureInfo,
+		uint32_t            firstMipLevel,
+		vector<VkExtent3D>& vectorMipMapExtent,
+		vector<uint>&       vectorMipMapSize,
+		VkDeviceSize&       dataOffset,
+		VkDeviceSize&       dataSize);
+
+	/** Fallback for a texture of an upload batch whose decoded data doesn't match its KTX header information: the image,
+	* memory and view built from the header are replaced by new ones built from the decoded data, which is uploaded with
+	* all its mip levels as build2DTextureFromFile does outside an upload batch. The texture is no longer streamed
+	* @param texture     [in] texture to rebuild
+	* @param textureInfo [in] decoded texture data
+	* @return nothing */
+	void rebuildTextureFromDecodedData(Texture* texture, TextureInfo* textureInfo);
+
+	/** Residency feedback: for each streamed texture used by a scene element inside the frustum of the camera given
+	* as parameter, computes from the projected size of the scene element the finest mip level needed, updating
+	* m_requestedMipLevel and m_lastRequestFrame
+	* @param camera [in] camera to compute the residency feedback for
+	* @return nothing */
+	void computeResidencyFeedback(Camera* camera);
+
+	/** Starts replacing the image of the streamed texture given as parameter with a new one with the mip levels of the
+	* texture file from mipLevel onwards. When mipLevel is finer than the resident one the texture file is decoded by a
+	* worker thread, otherwise the new image is copied from the resident one (see recordResidentMipLevelCopy). The
+	* request is completed by processStreamingRequest in later calls to updateTextureStreaming
+	* @param texture  [in] streamed texture to update
+	* @param mipLevel [in] new finest resident mip level of the texture file
+	* @return true if the request was started, false otherwise */
+	bool requestTextureResidentMipLevel(Texture* texture, uint32_t mipLevel);
+
+	/** Advances the streaming request given as parameter: once the texture file is decoded, the copy to the new image
+	* is recorded and submitted without waiting for it, and once the copy has completed the new image replaces the
+	* texture's one and the descriptor sets of the materials sampling it are updated
+	* @param request  [in]  request to advance
+	* @param replaced [out] true if the image of the texture was replaced
+	* @return true if the request is finished and can be destroyed, false otherwise */
+	bool processStreamingRequest(TextureStreamingRequest* request, bool& replaced);
+
+	/** Builds the new image of the eviction request given as parameter and records in the request command buffer the
+	* copy with vkCmdCopyImage of the mip levels from the request mip level onwards from the resident image of the
+	* texture, which is transitioned back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL so it can be sampled until replaced
+	* @param request [in] eviction request, with a mip level coarser than the resident one
+	* @return nothing */
+	void recordResidentMipLevelCopy(TextureStreamingRequest* request);
+
+	/** Submits the command buffer of the streaming request given as parameter, with a fence created to know when the
+	* copy has completed
+	* @param request [in] request to submit
+	* @return nothing */
+	void submitStreamingRequest(TextureStreamingRequest* request);
+
+	/** Destroys the streaming request given as parameter, joining its worker thread and freeing its resources
+	* @param request [in] request to destroy
+	* @return nothing */
+	void destroyStreamingRequest(TextureStreamingRequest* request);
+
+	/** Returns the streaming request in progress for the texture given as parameter, if any
+	* @param texture [in] texture to look for
+	* @return streaming request of the texture, nullptr if none */
+	TextureStreamingRequest* getStreamingRequest(const Texture* texture);
+
+	/** Estimates the memory size of the image of the streamed texture given as parameter with the mip levels of the
+	* texture file from mipLevel onwards, from the size of its current image
+	* @param texture  [in] streamed texture
+	* @param mipLevel [in] finest resident mip level of the texture file
+	* @return estimated memory size */
+	static VkDeviceSize estimateResidentMemory(const Texture* texture, uint32_t mipLevel);
+
 	/** Transitions the layout of the image given as parameter from the old to the new layout
 	* @param image            [in] image to transition
 	* @param aspectMask       [in] image aspect mask
@@ -218,6 +445,16 @@ protected:
 		VkFormat          format,
 		VkImageViewType   imageViewType);
 
+	/** Updates a texture built with buildTextureFromExistingResources with the resources given by the swap chain
+	* after it has been built again, emitting a MNT_CHANGED notification so the framebuffers using it are rebuilt
+	* @param texture [in] texture to update
+	* @param image   [in] image handler
+	* @param view    [in] view handler
+	* @param width   [in] image width
+	* @param height  [in] image height
+	* @return nothing */
+	void updateTextureFromExistingResources(Texture* texture, VkImage image, VkImageView view, uint32_t width, uint32_t height);
+
 	/** To identify irradiance texture loading
 	* @return true if the texture name present in the path parameter has extension ".irrt" and false otherwise */
 	bool isIrradianceTexture(string&& path);
@@ -228,6 +465,15 @@ protected:
 	VkImageType getImageType(VkImageViewType imageViewType);
 
 	static VkCommandBuffer commandBufferTexture; //!< Command buffer for operations related with this manager
+	bool                             m_batchUpload;            //!< True while a texture upload batch is in progress (between beginTextureUploadBatch and endTextureUploadBatch)
+	vector<TextureUploadRequest>     m_vectorUploadRequest;    //!< Textures pending to be uploaded in the current texture upload batch
+	vector<TextureUploadSegment>     m_vectorUploadSegment;    //!< Segments of the texture upload staging ring
+	Buffer*                          m_uploadStagingBuffer;    //!< Host visible buffer used as texture upload staging ring
+	uint8_t*                         m_uploadStagingPointer;   //!< Persistently mapped pointer to m_uploadStagingBuffer memory during endTextureUploadBatch
+	uint                             m_streamingFrame;         //!< Number of calls to updateTextureStreaming, used as frame counter for the residency feedback
+	vectorTexturePtr                 m_vectorStreamedTexture;  //!< Streamed textures, the ones loaded during a texture upload batch
+	vector<TextureStreamingRequest*> m_vectorStreamingRequest; //!< Changes of the resident mip level of streamed textures in progress
+	ShadowAtlas                      m_shadowAtlas;            //!< Allocator of the regions of the shadow maps and of the depth scratch textures shared by the shadow casting passes
 };
 
 static TextureManager* s_pTextureManager;
@@ -100,6 +100,13 @@ public:
 	* @return the available space in bytes at cell given by index parameter */
 	int getAvailableRoomAtCell(int index);
 
+	/** Replaces the data present at the cell given by index with the data given as parameter
+	* @param index [in] Index of the cell
+	* @param data  [in] Data to copy
+	* @param size  [in] Size in bytes of the data to copy
+	* @return true if there wasn't any problem setting the data, false otherwise (no enough room for the data) */
+	bool setDataAtCell(int index, const void* data, int size);
+
 	GETCOPY_SET(int, m_minCellSize, MinCellSize)
 	GETCOPY_SET(int, m_numCells, NumCells)
 	REF_PTR(void, m_UBHostMemory, UBHostMemory)
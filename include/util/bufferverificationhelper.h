@@ -22,6 +22,7 @@ limitations under the License.
 // PROJECT INCLUDES
 #include "../headers.h"
 #include "../../include/util/getsetmacros.h"
+#include "../../include/model/scenecache.h"
 
 // CLASS FORWARDING
 
@@ -201,6 +202,45 @@ public:
 	* @return nothing */
 	static void verifyClusterVisibilityFirstIndexBuffer();
 
+	/** Verifies that MathUtil::transformPointArray gives bit by bit the same results when the points are split in chunks
+	* transformed concurrently with ParallelUtil::parallelFor, when all of them are transformed serially in the calling
+	* thread, and when each one is transformed with MathUtil::transformPoint. The AABB of the transformed points is
+	* compared as well. Must not be called from inside a ParallelUtil::parallelFor call, nested calls run serially
+	* @param matrix      [in] matrix used to transform the points
+	* @param vectorPoint [in] points to transform (a copy is transformed in each test)
+	* @param numChunk    [in] number of chunks the points are split in for the concurrent test
+	* @return true if all the results are equal, false otherwise */
+	static bool verifyParallelTransformPointArray(const mat4& matrix, const vectorVec3& vectorPoint, uint numChunk);
+
+	/** CPU benchmark of MeshSimplifier: for each error budget factor given as parameter, decimates all the meshes with
+	* the same target triangle count used in Model::decimateMesh, first serially and then concurrently with
+	* ParallelUtil::parallelFor, writing to console the input and output triangle count and the time taken by both. The
+	* concurrent results are verified to be equal to the serial ones. Must not be called from inside a
+	* ParallelUtil::parallelFor call, nested calls run serially
+	* @param vectorMesh              [in] meshes to decimate
+	* @param vectorErrorBudgetFactor [in] error budget factors to test, multiplied by the squared AABB diagonal of each mesh
+	* @return true if the serial and concurrent results are equal for all the factors, false otherwise */
+	static bool benchmarkMeshDecimation(const vector<SceneCacheMesh>& vectorMesh, const vectorFloat& vectorErrorBudgetFactor);
+
+	/** CPU micro-benchmark of the material uniform packing: for each material with exposed struct fields, packs the fields
+	* numIteration times with the previous path (ShaderReflection::setResourceCPUValue and
+	* ShaderReflection::appendExposedStructFieldDataToUniformBufferCell, a type switch per field) and with a UniformLayout
+	* built from the same fields (a comparison per field and a single copy to the cell), writing both times to console.
+	* The packed data of both paths is verified to be equal. Scratch CPUBuffer instances are used, the material uniform
+	* buffer is not modified
+	* @param numIteration [in] number of times each material is packed with each path
+	* @return true if the packed data of both paths is equal for all the materials, false otherwise */
+	static bool benchmarkUniformLayout(uint numIteration);
+
+	/** CPU benchmark of the per node lookups done in SceneLightingTechnique::record, over a synthetic scene of numNode
+	* nodes each one with its own material in a ManagerTemplate. The previous path (a material name built per node, a
+	* lookup by name in the manager and a linear scan for the scene index) is compared with the handles and scene
+	* indices resolved once at setup, writing the time of numIteration record loops of each path to console
+	* @param numNode      [in] number of nodes of the synthetic scene
+	* @param numIteration [in] number of record loops over all the nodes done with each path
+	* @return true if both paths resolve the same elements and indices, false otherwise */
+	static bool benchmarkRecordHandleLookup(uint numNode, uint numIteration);
+
 	static uint m_accumulatedReductionLevelBase; //!< Debug variable to know the accumulated value of non null elements at base level of the algorithm during the reduction step
 	static uint m_accumulatedReductionLevel0;    //!< Debug variable to know the accumulated value of non null elements at level 0 of the algorithm during the reduction step
 	static uint m_accumulatedReductionLevel1;    //!< Debug variable to know the accumulated value of non null elements at level 1 of the algorithm during the reduction step
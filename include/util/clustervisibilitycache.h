@@ -0,0 +1,131 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _CLUSTERVISIBILITYCACHE_H_
+#define _CLUSTERVISIBILITYCACHE_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+#include "../../include/util/getsetmacros.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+#define CLUSTER_VISIBILITY_CACHE_MAGIC     0x56435643    // "CVCV"
+#define CLUSTER_VISIBILITY_CACHE_VERSION   1             // Increase each time the layout of the cache file or the cluster visibility algorithm changes
+#define CLUSTER_VISIBILITY_CACHE_EXTENSION ".visibility" // Extension added to the scene file name to build the cache file name
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Sparse, delta coded version of the cluster visibility buffers (clusterVisibilityNumberBuffer, clusterVisibilityFirstIndexBuffer
+*   and clusterVisibilityCompactedBuffer) that can be saved, loaded and validated so the cluster visibility computation is done only
+*   once per scene. For each occupied voxel a six bit mask flags the faces with at least one visible cluster, and for each of those
+*   faces the number of visible clusters and the zigzag encoded difference between consecutive cluster indices are stored as
+*   variable length integers. The first index of each face is not stored since it is the exclusive prefix sum of the number of
+*   visible clusters of the previous faces. The cluster indices are kept in the same order as in clusterVisibilityCompactedBuffer */
+
+class ClusterVisibilityCache
+{
+public:
+	/** Default constructor
+	* @return nothing */
+	ClusterVisibilityCache();
+
+	/** Computes the key of the cluster visibility data, hashing the voxelization and clusterization data it depends on
+	* @param vectorVoxelHashed  [in]  content of voxelHashedPositionCompactedBuffer for the occupied voxels
+	* @param vectorClusterData  [in]  content of clusterizationFinalBuffer for the final clusters
+	* @param voxelizationWidth  [in]  voxelization texture size
+	* @param numThreadPerFace   [in]  maximum number of visible clusters per voxel face
+	* @return key computed */
+	static uint64_t computeKey(const vectorUint8& vectorVoxelHashed, const vectorUint8& vectorClusterData, uint voxelizationWidth, uint numThreadPerFace);
+
+	/** Builds the sparse delta coded data from the content of the cluster visibility buffers, validating that the first index
+	* of each voxel face is consistent with the number of visible clusters of the previous faces
+	* @param vectorNumber     [in] content of clusterVisibilityNumberBuffer
+	* @param vectorFirstIndex [in] content of clusterVisibilityFirstIndexBuffer
+	* @param vectorCompacted  [in] content of clusterVisibilityCompactedBuffer (two 16 bit cluster indices per element)
+	* @param numOccupiedVoxel [in] number of occupied voxels
+	* @param numCluster       [in] number of clusters
+	* @return true if the buffers are consistent and were encoded, false otherwise */
+	bool encode(const vectorUint& vectorNumber, const vectorUint& vectorFirstIndex, const vectorUint& vectorCompacted, uint numOccupiedVoxel, uint numCluster);
+
+	/** Rebuilds the content of the cluster visibility buffers from the sparse delta coded data, validating the cluster indices
+	* and the checksum of the decoded data
+	* @param vectorNumber     [out] content of clusterVisibilityNumberBuffer
+	* @param vectorFirstIndex [out] content of clusterVisibilityFirstIndexBuffer
+	* @param vectorCompacted  [out] content of clusterVisibilityCompactedBuffer (two 16 bit cluster indices per element)
+	* @return true if the data was decoded and validated, false otherwise */
+	bool decode(vectorUint& vectorNumber, vectorUint& vectorFirstIndex, vectorUint& vectorCompacted) const;
+
+	/** Loads the cache file given as parameter, if it exists and its magic, version and key match
+	* @param cachePath [in] path to the cache file
+	* @param key       [in] expected key
+	* @return true if the cache was loaded, false otherwise */
+	bool load(const string& cachePath, uint64_t key);
+
+	/** Saves the cache content in the file given as parameter
+	* @param cachePath [in] path to the cache file
+	* @param key       [in] key to store
+	* @return true if the cache was saved, false otherwise */
+	bool save(const string& cachePath, uint64_t key) const;
+
+	/** Clears all the cache content
+	* @return nothing */
+	void clear();
+
+	GETCOPY(uint, m_numOccupiedVoxel, NumOccupiedVoxel)
+	GETCOPY(uint, m_numCluster, NumCluster)
+	GETCOPY(uint, m_numVisibleCluster, NumVisibleCluster)
+	GET(vectorUint8, m_vectorFaceMask, VectorFaceMask)
+	GET(vectorUint8, m_vectorDeltaStream, VectorDeltaStream)
+
+protected:
+	/** Appends to vectorData the value given as parameter as a variable length integer (seven bits per byte)
+	* @param value      [in] value to append
+	* @param vectorData [in] vector to append to
+	* @return nothing */
+	static void writeVarUint(uint value, vectorUint8& vectorData);
+
+	/** Reads a variable length integer written with writeVarUint from vectorData at the offset given as parameter, advancing it
+	* @param vectorData [in]    data to read from
+	* @param offset     [inout] offset to read from
+	* @param value      [out]   value read
+	* @return true if the value could be read, false otherwise */
+	static bool readVarUint(const vectorUint8& vectorData, size_t& offset, uint& value);
+
+	/** Computes the checksum of the cluster visibility data, only taking into account the 16 bit cluster indices in use
+	* @param vectorNumber      [in] content of clusterVisibilityNumberBuffer
+	* @param vectorCompacted   [in] content of clusterVisibilityCompactedBuffer
+	* @param numOccupiedVoxel  [in] number of occupied voxels
+	* @param numVisibleCluster [in] number of 16 bit cluster indices in use in vectorCompacted
+	* @return checksum computed */
+	static uint64_t computeChecksum(const vectorUint& vectorNumber, const vectorUint& vectorCompacted, uint numOccupiedVoxel, uint numVisibleCluster);
+
+	uint        m_numOccupiedVoxel;  //!< Number of occupied voxels
+	uint        m_numCluster;        //!< Number of clusters, all the cluster indices must be smaller than this value
+	uint        m_numVisibleCluster; //!< Total number of visible clusters from all the voxel faces (number of 16 bit elements in clusterVisibilityCompactedBuffer)
+	uint64_t    m_checksum;          //!< Checksum of the decoded data, to validate it after loading
+	vectorUint8 m_vectorFaceMask;    //!< Per occupied voxel, bit mask with the faces having at least one visible cluster
+	vectorUint8 m_vectorDeltaStream; //!< For each face flagged in m_vectorFaceMask, number of visible clusters and zigzag delta coded cluster indices, as variable length integers
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _CLUSTERVISIBILITYCACHE_H_
@@ -0,0 +1,165 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _LIGHTINGREFERENCEHELPER_H_
+#define _LIGHTINGREFERENCEHELPER_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../headers.h"
+#include "../../include/util/getsetmacros.h"
+#include "../../include/rastertechnique/lightbouncevoxelirradiancetechnique.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+using namespace commonnamespace;
+
+// DEFINES
+// The constants below mirror the shaders in data/vulkanshaders the reference is validated against, and have to be
+// updated together with them:
+//  - Direct irradiance and lit test: litclusterfirstpart.comp and litclustersecondpart.comp (MaterialLitCluster)
+//  - Light bounce: lightbouncevoxelirradiancefirstpart.comp and lightbouncevoxelirradiancesecondpart.comp (MaterialLightBounceVoxelIrradiance)
+//  - Gaussian filter: lightbouncevoxelgaussianfilterfirstpart.comp and lightbouncevoxelgaussianfiltersecondpart.comp (MaterialLightBounceVoxelGaussianFilter)
+// The cluster layout is the ClusterData struct shared with ClusterizationBuildFinalBufferTechnique, and the per voxel layout of
+// the light bounce buffers is LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER shared with LightBounceVoxelIrradianceTechnique
+#define LIGHTING_REFERENCE_NUM_FACE                   6                                                                // Number of faces per voxel, in the order +x, -x, +y, -y, +z, -z
+#define LIGHTING_REFERENCE_FILTER_SIGMA               1.0f                                                             // Standard deviation in voxels of the gaussian filter applied to the light bounce irradiance
+#define LIGHTING_REFERENCE_FLOAT_PER_FACE             (LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER / LIGHTING_REFERENCE_NUM_FACE) // Number of floats per voxel face in lightBounceVoxelIrradianceBuffer and lightBounceVoxelFilteredIrradianceBuffer, the irradiance is the first one
+#define LIGHTING_REFERENCE_FORM_FACTOR_ADDED_DIVISOR  10.0f                                                            // The FORM_FACTOR_CLUSTER_TO_VOXEL_ADDED raster flag is divided by this value in the light bounce shader
+#define LIGHTING_REFERENCE_IRRADIANCE_DIVISOR         100000.0f                                                        // The IRRADIANCE_MULTIPLIER raster flag is divided by this value in the light bounce shader
+#define LIGHTING_REFERENCE_DIRECT_IRRADIANCE_DIVISOR  10.0f                                                            // The DIRECT_IRRADIANCE_MULTIPLIER raster flag is divided by this value in the lit cluster shader
+
+/** Copy of the GPU buffers and parameters the lit cluster and light bounce passes work with */
+struct LightingReferenceInput
+{
+	uint        m_voxelizationWidth;             //!< Voxelization texture size
+	vec3        m_sceneMin;                      //!< Minimum value of the scene's aabb
+	vec3        m_sceneExtent;                   //!< Scene extent
+	vec3        m_voxelWorldSize;                //!< World space size of a voxel
+	vec3        m_lightPosition;                 //!< Emitter world space position
+	vec3        m_lightForward;                  //!< Emitter forward direction
+	float       m_emitterRadiance;               //!< Emitter radiance
+	vec4        m_arrayFrustumPlane[6];          //!< Emitter frustum planes
+	float       m_formFactorClusterToVoxelAdded; //!< FORM_FACTOR_CLUSTER_TO_VOXEL_ADDED raster flag divided by LIGHTING_REFERENCE_FORM_FACTOR_ADDED_DIVISOR
+	float       m_irradianceMultiplier;          //!< IRRADIANCE_MULTIPLIER raster flag divided by LIGHTING_REFERENCE_IRRADIANCE_DIVISOR, applied to the light bounce irradiance
+	float       m_directIrradianceMultiplier;    //!< DIRECT_IRRADIANCE_MULTIPLIER raster flag divided by LIGHTING_REFERENCE_DIRECT_IRRADIANCE_DIVISOR, applied to the direct irradiance
+	vectorUint  m_vectorVoxelHashed;             //!< Content of voxelHashedPositionCompactedBuffer (sorted hashed position of each occupied voxel)
+	vectorUint  m_vectorVoxelOccupied;           //!< Content of voxelOccupiedBuffer (one bit per voxel of the voxelization volume)
+	vectorUint8 m_vectorClusterData;             //!< Content of clusterizationFinalBuffer (ClusterData structs)
+	uint        m_numCluster;                    //!< Number of ClusterData structs in m_vectorClusterData
+	vectorUint  m_vectorClusterVisibilityNumber; //!< Content of clusterVisibilityNumberBuffer (number of visible clusters per voxel face)
+	vectorUint  m_vectorClusterVisibilityFirst;  //!< Content of clusterVisibilityFirstIndexBuffer (first visible cluster per voxel face in m_vectorClusterVisibility)
+	vectorUint  m_vectorClusterVisibility;       //!< Content of clusterVisibilityCompactedBuffer (indices of the visible clusters, two 16 bit indices per element)
+};
+
+/** Results of the CPU reference implementation */
+struct LightingReferenceResult
+{
+	vectorUint8 m_vectorVoxelLitFace;       //!< Per voxel bit mask of the faces receiving direct irradiance from the emitter
+	vectorFloat m_vectorDirectIrradiance;   //!< Per voxel face direct irradiance from the emitter
+	vectorFloat m_vectorClusterIrradiance;  //!< Per cluster irradiance, mean direct irradiance of the faces of its voxels oriented as the cluster
+	vectorFloat m_vectorBounceIrradiance;   //!< Per voxel face irradiance arriving from the visible clusters
+	vectorFloat m_vectorFilteredIrradiance; //!< Per voxel face bounce irradiance after the gaussian filter
+	float       m_directMilliseconds;       //!< Time spent computing the direct irradiance and lit test
+	float       m_bounceMilliseconds;       //!< Time spent computing the cluster and bounce irradiance
+	float       m_filterMilliseconds;       //!< Time spent computing the gaussian filter
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** CPU reference implementation of the per voxel face direct irradiance, lit test visibility, light bounce and gaussian
+* filtering over the same compacted voxel and cluster buffers the GPU uses, to validate the lit cluster and light bounce
+* techniques without a GPU and to measure the throughput of the algorithm. All steps are multithreaded */
+class LightingReferenceHelper
+{
+public:
+	/** Copies from the GPU buffers and the lit cluster technique the data needed by the CPU reference implementation
+	* @param input [out] gathered data
+	* @return true if all the buffers were available, false otherwise */
+	static bool gatherInput(LightingReferenceInput& input);
+
+	/** Runs all the steps of the CPU reference implementation, measuring the time spent in each one
+	* @param input  [in]  data to work with
+	* @param result [out] results
+	* @return nothing */
+	static void compute(const LightingReferenceInput& input, LightingReferenceResult& result);
+
+	/** Computes, for each voxel face, the direct irradiance from the emitter: faces inside the emitter frustum, facing
+	* the emitter and with no occupied voxel between the voxel and the emitter receive radiance * cos / distance^2, scaled
+	* by m_directIrradianceMultiplier
+	* @param input  [in]    data to work with
+	* @param result [inout] m_vectorVoxelLitFace and m_vectorDirectIrradiance are filled
+	* @return nothing */
+	static void computeDirectIrradiance(const LightingReferenceInput& input, LightingReferenceResult& result);
+
+	/** Computes the irradiance of each cluster and, for each voxel face, the irradiance arriving from all the clusters
+	* visible from it, with a cluster to voxel face form factor cos * cos * area / (distance^2 + formFactorClusterToVoxelAdded),
+	* scaled by m_irradianceMultiplier
+	* @param input  [in]    data to work with
+	* @param result [inout] m_vectorClusterIrradiance and m_vectorBounceIrradiance are filled
+	* @return nothing */
+	static void computeLightBounce(const LightingReferenceInput& input, LightingReferenceResult& result);
+
+	/** Applies a gaussian filter to the bounce irradiance of each voxel face, using the same face of the occupied voxels
+	* in the 3x3x3 neighbourhood
+	* @param input  [in]    data to work with
+	* @param result [inout] m_vectorFilteredIrradiance is filled
+	* @return nothing */
+	static void computeGaussianFilter(const LightingReferenceInput& input, LightingReferenceResult& result);
+
+	/** Compares the voxels with any lit face in result with the voxels flagged in litTestVoxelBuffer
+	* @param result    [in] CPU reference results
+	* @param tolerance [in] maximum ratio of voxels with a different lit test result
+	* @return true if the ratio of different voxels is within tolerance, false otherwise */
+	static bool compareLitVoxel(const LightingReferenceResult& result, float tolerance);
+
+	/** Compares the per voxel face irradiance given as parameter with the one in the buffer with name bufferName
+	* (lightBounceVoxelIrradianceBuffer or lightBounceVoxelFilteredIrradianceBuffer)
+	* @param vectorIrradiance [in] CPU reference per voxel face irradiance
+	* @param bufferName       [in] name of the GPU buffer to compare with
+	* @param tolerance        [in] maximum relative difference for a voxel face to be considered equal
+	* @param vectorVoxelMask  [in] if not nullptr, only the voxels with a non zero value at their index are compared
+	* @return true if all compared voxel faces are equal within tolerance, false otherwise */
+	static bool compareIrradiance(const vectorFloat& vectorIrradiance, string&& bufferName, float tolerance, const vectorUint8* vectorVoxelMask = nullptr);
+
+	/** Returns the index in m_vectorVoxelHashed of the voxel with hashed position given as parameter
+	* @param input  [in] data to work with
+	* @param hashed [in] hashed voxel position
+	* @return index of the voxel in m_vectorVoxelHashed, -1 if the voxel is not occupied */
+	static int findVoxelIndex(const LightingReferenceInput& input, uint hashed);
+
+	/** Returns true if the voxel with coordinates given as parameter is occupied
+	* @param input       [in] data to work with
+	* @param coordinates [in] voxel coordinates
+	* @return true if the voxel is occupied, false otherwise */
+	static bool isVoxelOccupied(const LightingReferenceInput& input, const ivec3& coordinates);
+
+	/** Traverses the voxelization volume from the voxel with coordinates given as parameter towards the world space
+	* position given as parameter, testing if any occupied voxel blocks the path
+	* @param input       [in] data to work with
+	* @param coordinates [in] voxel coordinates to start from (the voxel itself is not tested)
+	* @param target      [in] world space position to reach
+	* @return true if no occupied voxel blocks the path, false otherwise */
+	static bool isPathFree(const LightingReferenceInput& input, const uvec3& coordinates, const vec3& target);
+
+	static const vec3 m_arrayFaceNormal[LIGHTING_REFERENCE_NUM_FACE]; //!< Normal of each voxel face, in the order +x, -x, +y, -y, +z, -z
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _LIGHTINGREFERENCEHELPER_H_
@@ -34,6 +34,7 @@ using namespace resourceenum;
 
 // DEFINES
 typedef Nano::Signal<void(const char*, string&&, ManagerNotificationType)> SignalElementNotification;
+#define INVALID_ELEMENT_HANDLE 0xFFFFFFFF // Value returned by getElementHandle for names never added to the manager
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +62,18 @@ public:
 	* @return pointer to an element of m_mapElement if it does exist and nullptr otherwise */
 	T *getElement(string &&name);
 
+	/** Returns the handle of the elment with name given as parameter, to be resolved once at setup and used in per-frame code
+	* through getElementByHandle. Handles are stable for the whole lifetime of the manager: an element removed and added again
+	* with the same name (like when rebuilding resources) gets back its previous handle
+	* @param name [in] name of the element to return the handle for
+	* @return handle of the element if it was ever added to the manager and INVALID_ELEMENT_HANDLE otherwise */
+	uint getElementHandle(string &&name) const;
+
+	/** Returns a pointer to the elment with handle given as parameter, in constant time
+	* @param handle [in] handle of the element to return, obtained through getElementHandle
+	* @return pointer to the element if the handle is valid and the element is currently in the manager, nullptr otherwise */
+	T *getElementByHandle(uint handle) const;
+
 	/** Returns true if the elment with name given as parameter exists in m_mapElement, and false if it doesn't
 	* @param name [in] name of the element to test if it's present in m_mapElement
 	* @return true if the elment with name given as parameter exists in m_mapElement, and false if it doesn't */
@@ -84,6 +97,11 @@ protected:
 	* @return nothing */
 	void emitSignalElement(string&& elementName, ManagerNotificationType NotificationType);
 
+	/** Sets to nullptr all the elements in m_vectorHandleElement, to be called by the managers once the elements have been
+	* destroyed. Handles remain assigned to their names so they are valid again once the elements are rebuilt
+	* @return nothing */
+	void invalidateElementHandles();
+
 	// TODO: use crtp to avoid this virtual method call
 	/** Assigns the corresponding slots to listen to signals affecting the resources
 	* managed by this manager */
@@ -97,9 +115,11 @@ protected:
 	* @return nothing */
 	virtual void slotElement(const char* managerName, string&& elementName, ManagerNotificationType notificationType);
 
-	map<string, T*>           m_mapElement;    //!< A map with the elements to the managed by the implementation of this manager, string should be really a shashed version of the string
-	const char*               m_managerName;   //!< Manager name
-	SignalElementNotification m_elementSignal; //!< Signal for elements in the manager: added, removed, changed
+	map<string, T*>             m_mapElement;          //!< A map with the elements to the managed by the implementation of this manager, string should be really a shashed version of the string
+	const char*                 m_managerName;         //!< Manager name
+	SignalElementNotification   m_elementSignal;       //!< Signal for elements in the manager: added, removed, changed
+	unordered_map<string, uint> m_mapElementHandle;    //!< Hashed map with the handle assigned to each element name ever added to the manager, never erased to keep handles stable
+	vector<T*>                  m_vectorHandleElement; //!< Element currently owning each handle, indexed by handle, nullptr if the element was removed
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +136,17 @@ template <class T> inline bool ManagerTemplate<T>::addElement(string &&name, T *
 	bool result = addIfNoPresent(move(string(name)), element, m_mapElement);
 	if (result)
 	{
+		unordered_map<string, uint>::iterator itHandle = m_mapElementHandle.find(name);
+		if (itHandle == m_mapElementHandle.end())
+		{
+			m_mapElementHandle.insert(pair<string, uint>(name, uint(m_vectorHandleElement.size())));
+			m_vectorHandleElement.push_back(element);
+		}
+		else
+		{
+			m_vectorHandleElement[itHandle->second] = element;
+		}
+
 		emitSignalElement(move(name), ManagerNotificationType::MNT_ADDED);
 	}
 
@@ -126,10 +157,16 @@ template <class T> inline bool ManagerTemplate<T>::addElement(string &&name, T *
 
 template <class T> inline bool ManagerTemplate<T>::removeElement(string &&name)
 {
-	bool result = removeByKey(move(name), m_mapElement);
+	bool result = removeByKey(move(string(name)), m_mapElement);
 
 	if (result)
 	{
+		unordered_map<string, uint>::iterator itHandle = m_mapElementHandle.find(name);
+		if (itHandle != m_mapElementHandle.end())
+		{
+			m_vectorHandleElement[itHandle->second] = nullptr;
+		}
+
 		emitSignalElement(move(name), ManagerNotificationType::MNT_REMOVED);
 	}
 
@@ -145,6 +182,21 @@ template <class T> inline T *ManagerTemplate<T>::getElement(string &&name)
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+template <class T> inline uint ManagerTemplate<T>::getElementHandle(string &&name) const
+{
+	unordered_map<string, uint>::const_iterator it = m_mapElementHandle.find(name);
+	return (it != m_mapElementHandle.end()) ? it->second : INVALID_ELEMENT_HANDLE;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T> inline T *ManagerTemplate<T>::getElementByHandle(uint handle) const
+{
+	return (handle < uint(m_vectorHandleElement.size())) ? m_vectorHandleElement[handle] : nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 template <class T> inline bool ManagerTemplate<T>::existsElement(string &&name)
 {
 	return existsByKey(move(name), m_mapElement);
@@ -190,6 +242,13 @@ template <class T> inline void ManagerTemplate<T>::emitSignalElement(string&& el
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+template <class T> inline void ManagerTemplate<T>::invalidateElementHandles()
+{
+	fill(m_vectorHandleElement.begin(), m_vectorHandleElement.end(), nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 template <class T> inline void ManagerTemplate<T>::assignSlots()
 {
 
@@ -50,6 +50,16 @@ public:
 	* @return nothing */
 	static void transformPoint(const mat4 &tMat, vec3 &vP);
 
+	/** Transforms in place each point in vectorPoint by the matrix tMat using SSE instructions (with a scalar fallback
+	* when SSE is not available), computing as well the AABB of the transformed points. The operations are done in the
+	* same order as in glm mat4 * vec4, so the results match bit by bit the ones of transformPoint
+	* @param tMat        [in]     matrix used to transform the points
+	* @param vectorPoint [in/out] points to transform
+	* @param aabbMin     [out]    minimum value of the AABB of the transformed points
+	* @param aabbMax     [out]    maximum value of the AABB of the transformed points
+	* @return nothing */
+	static void transformPointArray(const mat4 &tMat, vectorVec3 &vectorPoint, vec3& aabbMin, vec3& aabbMax);
+
 	/** Transforms the given vector (x,y,z) coordinates into OpenGL coordinates (-x,z,y), used for info from modelas loaded with
 	* z up, x front and y right coordinate systems (like 3ds studio max)
 	* @param vertices [in / out] vector to transform each position with the change (x,y,z) -> (-x,z,y)
@@ -89,6 +99,22 @@ public:
 	* @param value [in] value to compute if it is a power of two
 	* @return true in value is power of two, false otherwise */
 	static bool isPowerOfTwo(uint value);
+
+	/** Test whether the axis aligned bounding box given by min and max is at least partially inside the frustum
+	* given by its six normalized planes (in the same format as Camera::m_arrayFrustumPlane, normals pointing inside)
+	* @param arrayPlane [in] pointer to the six frustum planes
+	* @param min        [in] aabb minimum world coordinates
+	* @param max        [in] aabb maximum world coordinates
+	* @return true if the aabb intersects or is inside the frustum, false if it is completely outside */
+	static bool aabbIntersectsFrustum(const vec4* arrayPlane, const vec3& min, const vec3& max);
+
+	/** Test whether the sphere given by center and radius is at least partially inside the frustum given by its six
+	* normalized planes (in the same format as Camera::m_arrayFrustumPlane, normals pointing inside)
+	* @param arrayPlane [in] pointer to the six frustum planes
+	* @param center     [in] sphere center world coordinates
+	* @param radius     [in] sphere radius
+	* @return true if the sphere intersects or is inside the frustum, false if it is completely outside */
+	static bool sphereIntersectsFrustum(const vec4* arrayPlane, const vec3& center, float radius);
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////
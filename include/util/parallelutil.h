@@ -0,0 +1,86 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _PARALLELUTIL_H_
+#define _PARALLELUTIL_H_
+
+// GLOBAL INCLUDES
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+class ParallelUtil
+{
+public:
+	/** Calls function for each index in [0, numElement) distributing the calls among a persistent pool of worker threads
+	* (as many as hardware threads are available minus the calling thread, created in the first call). Each index is
+	* processed exactly once, function must be safe to call concurrently for different indices. The method returns once
+	* all the indices have been processed. Calls made while the pool is busy (from a worker thread or from another
+	* thread) process all the indices in the calling thread
+	* @param numElement [in] number of indices to process
+	* @param function   [in] function to call for each index
+	* @return nothing */
+	static void parallelFor(uint numElement, const function<void(uint)>& function);
+
+	/** Returns the number of threads used by parallelFor, including the calling one
+	* @return number of threads used by parallelFor */
+	static uint getNumWorkerThread();
+
+protected:
+	/** Creates the worker threads if they were not created yet, must be called with m_submitMutex locked
+	* @return nothing */
+	static void initializeWorkerThread();
+
+	/** Body of each worker thread: waits for a new job and processes indices of it until none is left
+	* @return nothing */
+	static void workerThreadLoop();
+
+	/** Processes indices of the current job until none is left
+	* @return nothing */
+	static void processJob();
+
+	/** Stops and joins the worker threads, registered with atexit when they are created
+	* @return nothing */
+	static void destroyWorkerThread();
+
+	static vector<thread>                  m_vectorWorkerThread; //!< Persistent worker threads
+	static mutex                           m_submitMutex;        //!< Held by the thread submitting a job for as long as the job lasts
+	static mutex                           m_jobMutex;           //!< Protects the job state below
+	static condition_variable              m_jobStart;           //!< Notified when a new job is available or the workers have to stop
+	static condition_variable              m_jobFinish;          //!< Notified when a worker finishes its part of the current job
+	static const function<void(uint)>*     m_jobFunction;        //!< Function of the current job
+	static uint                            m_jobNumElement;      //!< Number of indices of the current job
+	static atomic<uint>                    m_jobNextIndex;       //!< Next index of the current job to process
+	static uint                            m_jobGeneration;      //!< Incremented for each new job, so each worker takes part in each job once
+	static uint                            m_jobNumActiveWorker; //!< Number of workers still processing the current job
+	static bool                            m_stopWorker;         //!< If true, the worker threads finish
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _PARALLELUTIL_H_
@@ -0,0 +1,78 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef _VOXELGREEDYMESHER_H_
+#define _VOXELGREEDYMESHER_H_
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/headers.h"
+
+// CLASS FORWARDING
+
+// NAMESPACE
+
+// DEFINES
+
+/** Rectangle of coplanar visible voxel faces. For a face with axis d (0, 1, 2 for x, y, z), the rectangle spans m_width
+*   voxels along axis u = (d + 1) % 3 and m_height voxels along axis v = (d + 2) % 3, starting at m_voxel */
+struct VoxelFaceRectangle
+{
+	uvec3 m_voxel;  // Occupied voxel at the (u, v) minimum corner of the rectangle
+	uint  m_face;   // Face index, 2 * d for the face in the positive direction of axis d and 2 * d + 1 for the negative one
+	uint  m_width;  // Number of voxel faces along axis u
+	uint  m_height; // Number of voxel faces along axis v
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Extraction of the visible faces of a voxelization (faces of occupied voxels whose neighbour in the face direction is
+*   empty), optionally merging each slice coplanar faces into maximal rectangles (greedy meshing) */
+
+class VoxelGreedyMesher
+{
+public:
+	/** Builds a bit array with the occupied voxels given as parameter, using the same hashing as voxelHashedPositionCompactedBuffer
+	* (x * size * size + y * size + z)
+	* @param pHashedPosition   [in]  hashed positions of the occupied voxels
+	* @param numHashedPosition [in]  number of elements in pHashedPosition
+	* @param voxelizationSize  [in]  voxelization resolution (same in the three axes)
+	* @param vectorOccupancy   [out] bit array with the occupied voxels
+	* @return nothing */
+	static void buildOccupancy(const uint* pHashedPosition, uint numHashedPosition, uint voxelizationSize, vectorUint& vectorOccupancy);
+
+	/** Extracts the visible faces of the occupied voxels in vectorOccupancy. Each slice of each face direction is processed
+	* in parallel
+	* @param vectorOccupancy  [in]  bit array with the occupied voxels, built with buildOccupancy
+	* @param voxelizationSize [in]  voxelization resolution (same in the three axes)
+	* @param mergeCoplanar    [in]  if true, coplanar visible faces are merged into maximal rectangles, if false one rectangle of size one is generated per visible face
+	* @param vectorRectangle  [out] rectangles generated, in face and slice order
+	* @return nothing */
+	static void extractVisibleFace(const vectorUint& vectorOccupancy, uint voxelizationSize, bool mergeCoplanar, vector<VoxelFaceRectangle>& vectorRectangle);
+
+	/** Returns the voxel corner of the rectangle given as parameter in the face plane, offset by the amounts given as parameter along the
+	* u and v axes of the face
+	* @param rectangle [in] rectangle
+	* @param offsetU   [in] offset along the u axis of the face
+	* @param offsetV   [in] offset along the v axis of the face
+	* @return corner in voxel coordinates */
+	static ivec3 getRectangleCorner(const VoxelFaceRectangle& rectangle, uint offsetU, uint offsetV);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif _VOXELGREEDYMESHER_H_
@@ -109,13 +109,78 @@ bool Buffer::getContentCopy(vectorUint8& vectorData)
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+bool Buffer::getContentRange(void* data, VkDeviceSize offset, VkDeviceSize size)
+{
+	if ((offset + size) > m_dataSize)
+	{
+		cout << "ERROR in Buffer::getContentRange, range out of the buffer size" << endl;
+		return false;
+	}
+
+	if ((m_requirementsMask & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+	{
+		cout << "ERROR in Buffer::getContentRange, buffer memory is not host coherent" << endl;
+		return false;
+	}
+
+	if (size == 0)
+	{
+		return true;
+	}
+
+	void* mappedMemory;
+	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_memory, offset, size, 0, &mappedMemory);
+	assert(result == VK_SUCCESS);
+
+	if (result != VK_SUCCESS)
+	{
+		return false;
+	}
+
+	memcpy(data, mappedMemory, size);
+
+	vkUnmapMemory(coreM->getLogicalDevice(), m_memory);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void* Buffer::mapContent()
+{
+	if ((m_requirementsMask & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+	{
+		cout << "ERROR in Buffer::mapContent, buffer memory is not host coherent" << endl;
+		return nullptr;
+	}
+
+	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_memory, 0, m_mappingSize, 0, (void **)&m_mappedPointer);
+	assert(result == VK_SUCCESS);
+
+	if (result != VK_SUCCESS)
+	{
+		return nullptr;
+	}
+
+	return (void*)m_mappedPointer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Buffer::unmapContent()
+{
+	vkUnmapMemory(coreM->getLogicalDevice(), m_memory);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 bool Buffer::setContent(const void* dataPointer)
 {
 	bool resultToReturn = true;
 
 	VkCommandBuffer	commandBuffer; //!< Command buffer for vertex buffer - Triangle geometry
 
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBuffer);
+	commandBuffer = coreM->acquireFrameCommandBuffer();
 	coreM->beginCommandBuffer(commandBuffer);
 
 	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_memory, 0, m_mappingSize, 0, (void **)&m_mappedPointer);
@@ -133,10 +198,41 @@ bool Buffer::setContent(const void* dataPointer)
 
 	coreM->endCommandBuffer(commandBuffer);
 	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBuffer);
-	VkCommandBuffer cmdBufs[] = { commandBuffer };
-	vkFreeCommandBuffers(coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), sizeof(cmdBufs) / sizeof(VkCommandBuffer), cmdBufs);
+	coreM->releaseFrameCommandBuffer(commandBuffer);
 
 	return resultToReturn;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Buffer::setContentRange(const void* dataPointer, VkDeviceSize offset, VkDeviceSize size)
+{
+	if ((offset + size) > m_dataSize)
+	{
+		cout << "ERROR in Buffer::setContentRange, range out of the buffer size" << endl;
+		return false;
+	}
+
+	if ((m_requirementsMask & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+	{
+		cout << "ERROR in Buffer::setContentRange, buffer memory is not host coherent" << endl;
+		return false;
+	}
+
+	// Only host coherent memory is written here, no flush nor command buffer submission is needed
+	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_memory, offset, size, 0, (void **)&m_mappedPointer);
+	assert(result == VK_SUCCESS);
+
+	if (result != VK_SUCCESS)
+	{
+		return false;
+	}
+
+	memcpy(m_mappedPointer, dataPointer, size);
+
+	vkUnmapMemory(coreM->getLogicalDevice(), m_memory);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
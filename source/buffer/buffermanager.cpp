@@ -54,6 +54,8 @@ void BufferManager::destroyResources()
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,8 +348,7 @@ void BufferManager::printBufferInformation(const map<string, Buffer*>& mapData)
 
 void BufferManager::copyBuffer(Buffer* source, Buffer* destination, int sourceOffset, int destinationOffset, int size)
 {
-	VkCommandBuffer commandBuffer;
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBuffer);
+	VkCommandBuffer commandBuffer = coreM->acquireFrameCommandBuffer();
 	coreM->beginCommandBuffer(commandBuffer);
 
 	VkBufferCopy vertexCopyRegion = { static_cast<VkDeviceSize>(sourceOffset), static_cast<VkDeviceSize>(destinationOffset), static_cast<VkDeviceSize>(size) };
@@ -364,7 +365,7 @@ void BufferManager::copyBuffer(Buffer* source, Buffer* destination, int sourceOf
 
 	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBuffer);
 
-	vkFreeCommandBuffers(coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), 1, &commandBuffer);
+	coreM->releaseFrameCommandBuffer(commandBuffer);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
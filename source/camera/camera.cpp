@@ -98,6 +98,10 @@ Camera::Camera(string &&name,
 	, m_useRecordedCamera(false)
 	, m_isAnimated(false)
 	, m_animationElapsedTime(0.0f)
+	, m_animationFrameIndex(0)
+	, m_moving(false)
+	, m_positionLastFrame(vec3(0.0f))
+	, m_lookAtLastFrame(vec3(0.0f))
 {
 	m_lookAt           *= -1.0f;
 	m_right             = normalize(cross(vec3(0.0f, 1.0f, 0.0f), m_lookAt));
@@ -121,6 +125,9 @@ Camera::Camera(string &&name,
 	m_horAngle               = acos(cosHorizontalAngle);
 	m_verAngle               = acos(cosVerticalAngle);
 	m_horAngle              += pi<float>();
+
+	m_positionLastFrame = m_position;
+	m_lookAtLastFrame   = m_lookAt;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,72 +420,86 @@ void Camera::updateMovementState(float deltaTime, float offsetFactor)
 			offsetPosition(normalize(m_lastMovementDirection) * offsetFactor);
 		}
 	}
+
+	// Any change of the pose (mouse, keyboard, animation) since the previous call counts as movement
+	bool moved = (m_position != m_positionLastFrame) || (m_lookAt != m_lookAtLastFrame);
+
+	if (!moved && m_moving)
+	{
+		m_cameraStoppedSignal.emit();
+	}
+
+	m_moving            = moved;
+	m_positionLastFrame = m_position;
+	m_lookAtLastFrame   = m_lookAt;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 void Camera::updateCameraAnimation(float deltaTime)
 {
-	// NOTE: This is temporal code
-	//vec3 position0          = vec3(4.09118, 22.985, -5.47123);
-	//vec3 position1          = vec3(4.09118, 22.985, 4.63346);
-	vec3 position0          = vec3(-11.09118, 31.2, -5.47123);
-	vec3 position1          = vec3(-11.09118, 31.2, 4.63346);
-
-
-	//(-10.1624, 31.2414, 1.67363)
-	vec3 midPoint           = (position0 + position1) * 0.5f;
-	vec3 directionOffset    = vec3(0.0f, 0.0f, 5.0f);
-	//float totalTime         = 100000.0f;
-	//float totalTime         = 250000.0f;
-	float totalTime         = 150000.0f;
-	m_animationElapsedTime += deltaTime;
-
-	if (m_animationElapsedTime > totalTime)
+	if (m_cameraPath.getVectorKey().size() < 2)
 	{
-		m_animationElapsedTime -= totalTime;
+		return;
 	}
 
-	float normalizedValue = m_animationElapsedTime / totalTime;
-	float value           = 2.0f * glm::pi<float>() * normalizedValue;
-	float pointOffset     = sin(value);
-	vec3 finalPoint       = midPoint + pointOffset * directionOffset;
-	m_position            = finalPoint;
-	m_view                = lookAt(m_position, m_position + m_lookAt, m_up);
-
-	updateViewProjectionMatrix();
-	updateFrustumPlanes();
-
-	m_positionPrevious = m_position;
+	if (m_cameraPath.getFixedTimeStep() > 0.0f)
+	{
+		// Fixed time step: the path time only depends on the number of frames rendered, not on the frame duration
+		m_animationElapsedTime = m_cameraPath.getFrameTime(m_animationFrameIndex);
+		m_animationFrameIndex++;
+	}
+	else
+	{
+		m_animationElapsedTime += deltaTime;
+	}
 
-	m_cameraDirtySignal.emit();
+	applyCameraPathTime(m_animationElapsedTime);
+}
 
-	/*vec3 position0          = vec3(4.09118, 22.985, -5.47123);
-	vec3 position1          = vec3(4.09118, 22.985, 4.63346);
-	vec3 midPoint           = (position0 + position1) * 0.5f;
-	vec3 directionOffset    = vec3(5.0f, 0.0f, 0.0f);
-	//float totalTime         = 5000.0f;
-	float totalTime         = 25000.0f;
-	m_animationElapsedTime += deltaTime;
+/////////////////////////////////////////////////////////////////////////////////////////////
 
-	if (m_animationElapsedTime > totalTime)
+bool Camera::loadCameraPath(const string& filePath)
+{
+	if (!m_cameraPath.load(filePath))
 	{
-		m_animationElapsedTime -= totalTime;
+		return false;
 	}
 
-	float normalizedValue = m_animationElapsedTime / totalTime;
-	float value           = 2.0f * glm::pi<float>() * normalizedValue;
-	float pointOffset     = sin(value);
-	vec3 finalPoint       = midPoint + pointOffset * directionOffset;
-	m_position            = finalPoint;
-	m_view                = lookAt(m_position, m_position + m_lookAt, m_up);
+	m_isAnimated = true;
+	setCameraPathFrame(0);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Camera::setCameraPathFrame(uint frameIndex)
+{
+	m_animationFrameIndex  = frameIndex;
+	m_animationElapsedTime = m_cameraPath.getFrameTime(frameIndex);
+
+	applyCameraPathTime(m_animationElapsedTime);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Camera::applyCameraPathTime(float time)
+{
+	vec3 direction;
+	m_cameraPath.evaluate(time, m_position, direction);
+
+	m_lookAt = direction;
+	m_right  = normalize(cross(vec3(0.0f, 1.0f, 0.0f), m_lookAt));
+	m_up     = normalize(cross(m_lookAt, m_right));
+	m_view   = lookAt(m_position, m_position + m_lookAt, m_up);
 
 	updateViewProjectionMatrix();
 	updateFrustumPlanes();
 
 	m_positionPrevious = m_position;
 
-	m_cameraDirtySignal.emit();*/
+	m_cameraDirtySignal.emit();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
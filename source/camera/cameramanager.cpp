@@ -100,6 +100,8 @@ void CameraManager::destroyResources()
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +192,52 @@ void CameraManager::writeCameraRecordingData()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+bool CameraManager::loadCameraPathData()
+{
+	if (m_mainCamera == nullptr)
+	{
+		return false;
+	}
+
+	string sceneName = sceneM->getSceneName();
+	string filePath  = "../data/scenes/temp/" + sceneName + "_camera_path";
+
+	if (!ifstream(filePath))
+	{
+		return false;
+	}
+
+	return m_mainCamera->loadCameraPath(filePath);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraManager::setCameraPathFrame(uint frameIndex)
+{
+	if ((m_mainCamera == nullptr) || (m_mainCamera->refCameraPath().getVectorKey().size() < 2))
+	{
+		return false;
+	}
+
+	m_mainCamera->setCameraPathFrame(frameIndex);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint CameraManager::getCameraPathNumFrame()
+{
+	if (m_mainCamera == nullptr)
+	{
+		return 0;
+	}
+
+	return m_mainCamera->refCameraPath().getNumFrame();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void CameraManager::takeCameraRecording(vec3 position, vec3 lookAt, vec3 up, vec3 right, const mat4& view, const mat4& projection)
 {
 	m_vectorRecordedCamera.push_back(RecordedCamera({ position, lookAt, up, right, view, projection }));
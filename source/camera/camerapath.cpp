@@ -0,0 +1,287 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <sstream>
+#include <glm/gtx/spline.hpp>
+
+// PROJECT INCLUDES
+#include "../../include/camera/camerapath.h"
+#include "../../include/model/scenecache.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+CameraPath::CameraPath()
+	: m_fixedTimeStep(CAMERA_PATH_DEFAULT_TIME_STEP)
+	, m_loop(false)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraPath::load(const string& filePath)
+{
+	clear();
+
+	ifstream file(filePath, ios::binary | ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	vectorUint8 vectorData(size_t(file.tellg()));
+	file.seekg(0, ios::beg);
+	file.read(reinterpret_cast<char*>(vectorData.data()), vectorData.size());
+
+	uint magic    = 0;
+	size_t offset = 0;
+	SceneCache::readValue(vectorData, offset, magic);
+
+	bool result = (magic == CAMERA_PATH_MAGIC) ? parseBinary(vectorData) : parseText(vectorData);
+
+	if (result)
+	{
+		stable_sort(m_vectorKey.begin(), m_vectorKey.end(), [](const CameraPathKey& a, const CameraPathKey& b) { return a.m_time < b.m_time; });
+	}
+
+	if (!result || (m_vectorKey.size() < 2) || (m_fixedTimeStep < 0.0f))
+	{
+		cout << "ERROR in CameraPath::load, camera path file " << filePath << " not valid (at least two keys are needed)" << endl;
+		clear();
+		return false;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraPath::save(const string& filePath) const
+{
+	vectorUint8 vectorData;
+
+	SceneCache::writeValue(uint(CAMERA_PATH_MAGIC), vectorData);
+	SceneCache::writeValue(uint(CAMERA_PATH_VERSION), vectorData);
+	SceneCache::writeValue(m_fixedTimeStep, vectorData);
+	SceneCache::writeValue(uint(m_loop ? 1 : 0), vectorData);
+	SceneCache::writeArray(m_vectorKey, vectorData);
+
+	ofstream file(filePath, ios::binary | ios::trunc);
+
+	if (!file.is_open())
+	{
+		cout << "ERROR in CameraPath::save, unable to open file " << filePath << endl;
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(vectorData.data()), vectorData.size());
+
+	return file.good();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CameraPath::clear()
+{
+	m_vectorKey.clear();
+	m_fixedTimeStep = CAMERA_PATH_DEFAULT_TIME_STEP;
+	m_loop          = false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CameraPath::evaluate(float time, vec3& position, vec3& direction) const
+{
+	const int numKey = int(m_vectorKey.size());
+
+	if (numKey == 0)
+	{
+		return;
+	}
+
+	const float startTime = m_vectorKey[0].m_time;
+	const float duration  = m_vectorKey[numKey - 1].m_time - startTime;
+	float pathTime        = time;
+
+	if (m_loop && (duration > 0.0f))
+	{
+		pathTime = startTime + glm::mod(time - startTime, duration);
+	}
+	else
+	{
+		pathTime = glm::clamp(time, startTime, startTime + duration);
+	}
+
+	// Segment [index, index + 1] containing pathTime
+	int index = int(upper_bound(m_vectorKey.begin(), m_vectorKey.end(), pathTime, [](float value, const CameraPathKey& key) { return value < key.m_time; }) - m_vectorKey.begin()) - 1;
+	index     = glm::clamp(index, 0, numKey - 2);
+
+	const CameraPathKey& key0 = m_vectorKey[getKeyIndex(index - 1)];
+	const CameraPathKey& key1 = m_vectorKey[index];
+	const CameraPathKey& key2 = m_vectorKey[index + 1];
+	const CameraPathKey& key3 = m_vectorKey[getKeyIndex(index + 2)];
+
+	const float segmentTime = key2.m_time - key1.m_time;
+	const float t           = (segmentTime > 0.0f) ? glm::clamp((pathTime - key1.m_time) / segmentTime, 0.0f, 1.0f) : 0.0f;
+
+	position  = glm::catmullRom(key0.m_position,  key1.m_position,  key2.m_position,  key3.m_position,  t);
+	direction = glm::catmullRom(key0.m_direction, key1.m_direction, key2.m_direction, key3.m_direction, t);
+
+	float directionLength = glm::length(direction);
+	direction = (directionLength > 0.0f) ? (direction / directionLength) : glm::normalize(key1.m_direction);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+float CameraPath::getFrameTime(uint frameIndex) const
+{
+	const float startTime = (m_vectorKey.size() > 0) ? m_vectorKey[0].m_time : 0.0f;
+
+	// Computed from the frame index instead of accumulated, so there is no drift for long runs
+	return startTime + float(double(frameIndex) * double(m_fixedTimeStep));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint CameraPath::getNumFrame() const
+{
+	if (m_fixedTimeStep <= 0.0f)
+	{
+		return 0;
+	}
+
+	return uint(ceil(getDuration() / m_fixedTimeStep)) + 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+float CameraPath::getDuration() const
+{
+	if (m_vectorKey.size() < 2)
+	{
+		return 0.0f;
+	}
+
+	return m_vectorKey.back().m_time - m_vectorKey.front().m_time;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraPath::parseText(const vectorUint8& vectorData)
+{
+	istringstream stream(string(reinterpret_cast<const char*>(vectorData.data()), vectorData.size()));
+	string line;
+	uint lineNumber = 0;
+
+	while (getline(stream, line))
+	{
+		lineNumber++;
+
+		size_t commentStart = line.find('#');
+		if (commentStart != string::npos)
+		{
+			line = line.substr(0, commentStart);
+		}
+
+		istringstream lineStream(line);
+		string keyword;
+
+		if (!(lineStream >> keyword))
+		{
+			continue;
+		}
+
+		bool result = true;
+
+		if (keyword == "timestep")
+		{
+			result = bool(lineStream >> m_fixedTimeStep);
+		}
+		else if (keyword == "loop")
+		{
+			int value = 0;
+			result    = bool(lineStream >> value);
+			m_loop    = (value != 0);
+		}
+		else if (keyword == "key")
+		{
+			CameraPathKey key;
+			result = bool(lineStream >> key.m_time >> key.m_position.x >> key.m_position.y >> key.m_position.z >> key.m_direction.x >> key.m_direction.y >> key.m_direction.z);
+			m_vectorKey.push_back(key);
+		}
+		else
+		{
+			result = false;
+		}
+
+		if (!result)
+		{
+			cout << "ERROR in CameraPath::parseText, unable to parse line " << lineNumber << ": " << line << endl;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraPath::parseBinary(const vectorUint8& vectorData)
+{
+	size_t offset = 0;
+	uint magic    = 0;
+	uint version  = 0;
+	uint loop     = 0;
+
+	bool result = true;
+	result &= SceneCache::readValue(vectorData, offset, magic);
+	result &= SceneCache::readValue(vectorData, offset, version);
+	result &= (version == CAMERA_PATH_VERSION);
+	result &= SceneCache::readValue(vectorData, offset, m_fixedTimeStep);
+	result &= SceneCache::readValue(vectorData, offset, loop);
+	result &= SceneCache::readArray(vectorData, offset, m_vectorKey);
+
+	m_loop = (loop != 0);
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+int CameraPath::getKeyIndex(int index) const
+{
+	const int numKey = int(m_vectorKey.size());
+
+	if (m_loop)
+	{
+		// The last key is equal to the first one in a looping path, so it is skipped when wrapping
+		const int numDistinctKey = glm::max(numKey - 1, 1);
+		return ((index % numDistinctKey) + numDistinctKey) % numDistinctKey;
+	}
+
+	return glm::clamp(index, 0, numKey - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/core/commandbufferpool.h"
+#include "../../include/core/coremanager.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+CommandBufferPool::CommandBufferPool():
+	  m_commandPool(VK_NULL_HANDLE)
+	, m_resetCommandBufferFlag(false)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CommandBufferPool::createCommandPool(uint32_t queueFamilyIndex, VkCommandPoolCreateFlags flags)
+{
+	VkCommandPoolCreateInfo cmdPoolInfo = {};
+	cmdPoolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	cmdPoolInfo.pNext            = NULL;
+	cmdPoolInfo.queueFamilyIndex = queueFamilyIndex;
+	cmdPoolInfo.flags            = flags;
+
+	VkResult result = vkCreateCommandPool(coreM->getLogicalDevice(), &cmdPoolInfo, NULL, &m_commandPool);
+	assert(result == VK_SUCCESS);
+
+	m_resetCommandBufferFlag = ((flags & VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CommandBufferPool::destroyCommandPool()
+{
+	if (m_commandPool == VK_NULL_HANDLE)
+	{
+		return;
+	}
+
+	forIT(m_vectorCommandBuffer)
+	{
+		CoreManager::freeCommandBuffer(&coreM->getLogicalDevice(), m_commandPool, &(*it));
+	}
+
+	vkDestroyCommandPool(coreM->getLogicalDevice(), m_commandPool, NULL);
+
+	m_vectorCommandBuffer.clear();
+	m_vectorFreeCommandBuffer.clear();
+	m_commandPool = VK_NULL_HANDLE;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+VkCommandBuffer CommandBufferPool::acquireCommandBuffer()
+{
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+
+	if (m_vectorFreeCommandBuffer.size() > 0)
+	{
+		commandBuffer = m_vectorFreeCommandBuffer.back();
+		m_vectorFreeCommandBuffer.pop_back();
+		return commandBuffer;
+	}
+
+	CoreManager::allocCommandBuffer(&coreM->getLogicalDevice(), m_commandPool, &commandBuffer);
+	m_vectorCommandBuffer.push_back(commandBuffer);
+
+	return commandBuffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CommandBufferPool::releaseCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	if (m_resetCommandBufferFlag)
+	{
+		VkResult result = vkResetCommandBuffer(commandBuffer, 0);
+		assert(result == VK_SUCCESS);
+		m_vectorFreeCommandBuffer.push_back(commandBuffer);
+	}
+	else
+	{
+		// Without VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT command buffers can only be reset through the pool,
+		// this command buffer will be available again after the next resetCommandPool call
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CommandBufferPool::resetCommandPool()
+{
+	VkResult result = vkResetCommandPool(coreM->getLogicalDevice(), m_commandPool, 0);
+	assert(result == VK_SUCCESS);
+
+	m_vectorFreeCommandBuffer = m_vectorCommandBuffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
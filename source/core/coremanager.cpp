@@ -52,6 +52,7 @@ using namespace attributedefines;
 // STATIC MEMBER INITIALIZATION
 int CoreManager::m_vectorRecordIndex   = -1;
 uint CoreManager::m_commandBufferIndex = 0;
+uint CoreManager::m_liveCommandBufferCounter = 0;
 
 static vector<const char *> instanceExtensionNames =
 {
@@ -105,6 +106,8 @@ CoreManager::CoreManager() :
 	, m_maxImageNumberAdquired(0)
 	, m_endApplicationMessage(false)
 	, m_firstFrameFinished(false)
+	, m_headless(false)
+	, m_headlessNumFrame(0)
 {
 
 }
@@ -216,6 +219,7 @@ void CoreManager::initialize()
 	// Create the render pass now..
 	createRenderPass(includeDepth);
 	m_swapChain.createFrameBuffer();
+	createFrameCommandPools();
 
 	initHardwareLimitValues();
 	showHardwareLimits();
@@ -231,10 +235,57 @@ void CoreManager::initialize()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void CoreManager::parseCommandLineArguments(int argc, char** argv)
+{
+	for (int i = 1; i < (argc - 1); ++i)
+	{
+		string argument = string(argv[i]);
+		string value    = string(argv[i + 1]);
+
+		if (argument == "-presentmode")
+		{
+			VkPresentModeKHR presentMode = Surface::getPresentModeFromName(value);
+
+			if (presentMode == VK_PRESENT_MODE_MAX_ENUM_KHR)
+			{
+				cout << "ERROR in CoreManager::parseCommandLineArguments, unknown present mode " << value << endl;
+			}
+
+			m_surface.setPreferredPresentMode(presentMode);
+			m_framePacer.setPresentMode(presentMode);
+		}
+		else if (argument == "-swapchainimages")
+		{
+			m_surface.setPreferredNumberOfSwapChainImages(uint32_t(atoi(value.c_str())));
+		}
+		else if (argument == "-targetframetime")
+		{
+			m_framePacer.setTargetFrameTime(float(atof(value.c_str())));
+		}
+		else if (argument == "-framestatistics")
+		{
+			m_framePacer.setStatisticsInterval(uint(atoi(value.c_str())));
+		}
+		else if (argument == "-headless")
+		{
+			m_headless         = true;
+			m_headlessNumFrame = uint(atoi(value.c_str()));
+		}
+		else
+		{
+			continue;
+		}
+
+		i++;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void CoreManager::resize()
 {
 	// If prepared then only proceed for 
-	if (!m_isPrepared)
+	if (!m_isPrepared || (m_surface.getWidth() == 0) || (m_surface.getHeight() == 0))
 	{
 		return;
 	}
@@ -242,20 +293,29 @@ void CoreManager::resize()
 	m_isResizing = true;
 
 	vkDeviceWaitIdle(m_logicalDevice.getLogicalDevice());
-	destroyCommandPools();
-	shaderM->destroyResources();
 
-	destroyRenderpass();
-	m_swapChain.destroySwapChain();
-	m_surface.destroySurface();
+	// The previous swap chain is destroyed when building the new one, the textures wrapping its images are updated
+	// in createFrameBuffer before resizing the depth texture, so no framebuffer is built with a destroyed view
+	m_swapChain.destroyColorImageView();
+	m_surface.getSurfaceCapabilitiesAndPresentMode();
+	m_swapChain.createSwapChain();
+
+	// The frame command pools are indexed by swap chain image, the new swap chain can have a different number of images
+	if (m_vectorFrameCommandPool.size() != m_swapChain.getArraySwapchainImages().size())
+	{
+		destroyFrameCommandPools();
+		createFrameCommandPools();
+		m_currentColorBuffer = UINT32_MAX; // The previous index might be out of range until the next image is acquired
+	}
 
-	textureM->destroyResources();
-	buildSwapChainAndDepthImage();
 	m_swapChain.createFrameBuffer();
-	gpuPipelineM->init();
 
-	destroyQueryPool();
-	m_queryPoolsInitialized = false;
+	textureM->resizeOutputRelativeTextures(getWidth(), getHeight());
+
+	forIT(gpuPipelineM->refVectorRasterTechnique())
+	{
+		(*it)->outputResized();
+	}
 
 	prepare();
 
@@ -269,6 +329,7 @@ void CoreManager::deInitialize()
 	materialM->destroyResources();
 	gpuPipelineM->destroyResources();
 
+	destroyFrameCommandPools();
 	destroyCommandPools();
 
 	m_swapChain.destroySwapChain();
@@ -316,6 +377,8 @@ void CoreManager::buildSwapChainAndDepthImage()
 void CoreManager::setSwapChainExtent(uint32_t width, uint32_t height)
 {
 	m_swapChain.setSwapChainExtent(VkExtent2D({ width, height }));
+	m_surface.setWidth(width);
+	m_surface.setHeight(height);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,10 +403,17 @@ void CoreManager::prepare()
 void CoreManager::render()
 {
 	vectorRasterTechniquePtr& vectorTechnique  = gpuPipelineM->refVectorRasterTechnique();
+
+	m_framePacer.beginFrame();
   
  	// Get the index of the next available swapchain image:
  	VkResult result = m_swapChain.acquireNextImageKHR(m_logicalDevice.getLogicalDevice(), m_swapChain.getSwapChain(),
  		UINT64_MAX, m_presentCompleteSemaphore, VK_NULL_HANDLE, &m_currentColorBuffer);
+
+	m_framePacer.endAcquire();
+
+	// All the work submitted the last time this swap chain image was used has completed, its short lived command buffers can be recycled
+	m_vectorFrameCommandPool[m_currentColorBuffer].resetCommandPool();
  
  	uint maxIndex                              = uint(vectorTechnique.size());
  	VkQueue computeQueue                       = m_logicalDevice.getLogicalDeviceComputeQueue();
@@ -481,7 +551,10 @@ void CoreManager::render()
  	// Queue the image for presentation,
  	result = m_swapChain.queuePresent(m_logicalDevice.getLogicalDeviceGraphicsQueue(), &present);
  	assert(result == VK_SUCCESS);
+
+	m_framePacer.endPresent();
  
+	// The end of frame wait is kept: postRender and the frame command pools rely on the GPU being idle here
  	result = vkQueueWaitIdle(graphicsQueue);
  	assert(result == VK_SUCCESS);
 
@@ -490,6 +563,8 @@ void CoreManager::render()
 		result = vkQueueWaitIdle(computeQueue);
 		assert(result == VK_SUCCESS);
 	}
+
+	m_framePacer.endFrame();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,8 +574,14 @@ void CoreManager::postRender()
 	if (!m_firstFrameFinished)
 	{
 		bufferM->printWholeBufferInformation();
+		cout << "INFO: Number of live command buffers after first frame " << m_liveCommandBufferCounter << endl;
 		m_firstFrameFinished = true;
 	}
+
+	materialM->endFrameMaterialUniformUpload();
+
+	// The GPU is idle after CoreManager::render, streamed textures can have their images replaced
+	textureM->updateTextureStreaming();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,7 +592,7 @@ void CoreManager::createCommandPools()
 	cmdPoolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
 	cmdPoolInfo.pNext            = NULL;
 	cmdPoolInfo.queueFamilyIndex = m_surface.getGraphicsQueueWithPresentIndex();
-	cmdPoolInfo.flags            = 0;
+	cmdPoolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // Allows raster techniques to recycle their command buffers when re-recording
 
 	VkResult res = vkCreateCommandPool(m_logicalDevice.getLogicalDevice(), &cmdPoolInfo, NULL, &m_graphicsCommandPool);
 	assert(res == VK_SUCCESS);
@@ -528,6 +609,61 @@ void CoreManager::createCommandPools()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void CoreManager::createFrameCommandPools()
+{
+	m_vectorFrameCommandPool.resize(m_swapChain.getArraySwapchainImages().size());
+
+	forIT(m_vectorFrameCommandPool)
+	{
+		it->createCommandPool(m_surface.getGraphicsQueueWithPresentIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CoreManager::destroyFrameCommandPools()
+{
+	forIT(m_vectorFrameCommandPool)
+	{
+		it->destroyCommandPool();
+	}
+
+	m_vectorFrameCommandPool.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+VkCommandBuffer CoreManager::acquireFrameCommandBuffer()
+{
+	if (m_vectorFrameCommandPool.size() == 0)
+	{
+		// Per frame command pools not built yet (or being rebuilt after a resize), fall back to the graphics command pool
+		VkCommandBuffer commandBuffer;
+		allocCommandBuffer(&m_logicalDevice.getLogicalDevice(), m_graphicsCommandPool, &commandBuffer);
+		return commandBuffer;
+	}
+
+	// Before the first swap chain image is acquired, the pool of the first swap chain image is used
+	uint index = (m_currentColorBuffer == UINT32_MAX) ? 0 : m_currentColorBuffer;
+	return m_vectorFrameCommandPool[index].acquireCommandBuffer();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CoreManager::releaseFrameCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	if (m_vectorFrameCommandPool.size() == 0)
+	{
+		freeCommandBuffer(&m_logicalDevice.getLogicalDevice(), m_graphicsCommandPool, &commandBuffer);
+		return;
+	}
+
+	uint index = (m_currentColorBuffer == UINT32_MAX) ? 0 : m_currentColorBuffer;
+	m_vectorFrameCommandPool[index].releaseCommandBuffer(commandBuffer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void CoreManager::createRenderPass(bool isDepthSupported, bool clear)
 {
 	VkAttachmentReference* depthReference = new VkAttachmentReference({ 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL });
@@ -637,6 +773,7 @@ void CoreManager::allocCommandBuffer(const VkDevice* device, const VkCommandPool
 	{
 		result = vkAllocateCommandBuffers(*device, commandBufferInfo, cmdBuf);
 		assert(!result);
+		m_liveCommandBufferCounter += commandBufferInfo->commandBufferCount;
 		return;
 	}
 
@@ -651,6 +788,23 @@ void CoreManager::allocCommandBuffer(const VkDevice* device, const VkCommandPool
 
 	result = vkAllocateCommandBuffers(*device, &cmdInfo, cmdBuf);
 	assert(!result);
+	m_liveCommandBufferCounter += cmdInfo.commandBufferCount;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CoreManager::freeCommandBuffer(const VkDevice* device, const VkCommandPool cmdPool, VkCommandBuffer* cmdBuf)
+{
+	if (*cmdBuf == VK_NULL_HANDLE)
+	{
+		return;
+	}
+
+	vkFreeCommandBuffers(*device, cmdPool, 1, cmdBuf);
+	*cmdBuf = VK_NULL_HANDLE;
+
+	assert(m_liveCommandBufferCounter > 0);
+	m_liveCommandBufferCounter--;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -763,6 +917,7 @@ void CoreManager::initializeQueryPools()
 	vkCmdResetQueryPool(commandBuffer0, m_graphicsQueueQueryPool, 0, queryPoolCreateInfo.queryCount);
 	endCommandBuffer(commandBuffer0);
 	submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBuffer0);
+	freeCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBuffer0);
 
 	// Build compute queue query poool
 	result = vkCreateQueryPool(m_logicalDevice.getLogicalDevice(), &queryPoolCreateInfo, nullptr, &m_computeQueueQueryPool);
@@ -774,6 +929,7 @@ void CoreManager::initializeQueryPools()
 	vkCmdResetQueryPool(commandBuffer1, m_computeQueueQueryPool, 0, queryPoolCreateInfo.queryCount);
 	endCommandBuffer(commandBuffer1);
 	submitCommandBuffer(coreM->getLogicalDeviceComputeQueue(), &commandBuffer1);
+	freeCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), &commandBuffer1);
 
 	uint counter = 0;
 	forI(numRasterTechnique)
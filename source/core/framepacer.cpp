@@ -0,0 +1,237 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <thread>
+
+// PROJECT INCLUDES
+#include "../../include/core/framepacer.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+FramePacer::FramePacer():
+	  m_targetFrameTime(0.0f)
+	, m_statisticsInterval(0)
+	, m_presentMode(VK_PRESENT_MODE_FIFO_KHR)
+	, m_refreshInterval(FRAME_PACER_REFRESH_TIME)
+	, m_numFrame(0)
+	, m_headlessStarted(false)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::beginFrame()
+{
+	m_frameBegin = std::chrono::high_resolution_clock::now();
+	m_acquireEnd = m_frameBegin;
+	m_presentEnd = m_frameBegin;
+
+	if (m_numFrame == 0)
+	{
+		m_previousFrameEnd = m_frameBegin;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::endAcquire()
+{
+	m_acquireEnd = std::chrono::high_resolution_clock::now();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::endPresent()
+{
+	m_presentEnd = std::chrono::high_resolution_clock::now();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::headlessPresent()
+{
+	FramePacerTime now = std::chrono::high_resolution_clock::now();
+
+	if (!m_headlessStarted)
+	{
+		m_headlessStart   = now;
+		m_headlessStarted = true;
+	}
+
+	bool waitForRefresh = (m_presentMode == VK_PRESENT_MODE_FIFO_KHR);
+
+	if (m_presentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR)
+	{
+		// A late frame is presented right away (tearing) instead of waiting for the next refresh
+		waitForRefresh = (getElapsed(m_presentEnd, now) < m_refreshInterval);
+	}
+
+	if (waitForRefresh && (m_refreshInterval > 0.0f))
+	{
+		// MAILBOX and IMMEDIATE never block, FIFO waits for the next simulated refresh
+		double elapsed     = double(getElapsed(m_headlessStart, now));
+		double nextRefresh  = ceil(elapsed / double(m_refreshInterval)) * double(m_refreshInterval);
+		waitUntil(m_headlessStart + std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<double, std::milli>(nextRefresh)));
+	}
+
+	endPresent();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::endFrame()
+{
+	FramePacerTime limiterStart = std::chrono::high_resolution_clock::now();
+
+	if (m_targetFrameTime > 0.0f)
+	{
+		waitUntil(m_previousFrameEnd + std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<float, std::milli>(m_targetFrameTime)));
+	}
+
+	FramePacerTime frameEnd = std::chrono::high_resolution_clock::now();
+
+	FramePacerSample sample;
+	sample.m_acquireWait      = getElapsed(m_frameBegin, m_acquireEnd);
+	sample.m_acquireToPresent = getElapsed(m_acquireEnd, m_presentEnd);
+	sample.m_presentToIdle    = getElapsed(m_presentEnd, limiterStart);
+	sample.m_limiterWait      = getElapsed(limiterStart, frameEnd);
+	sample.m_frameTime        = getElapsed(m_previousFrameEnd, frameEnd);
+
+	if (m_vectorSample.size() < FRAME_PACER_NUM_SAMPLE)
+	{
+		m_vectorSample.push_back(sample);
+	}
+	else
+	{
+		m_vectorSample[m_numFrame % FRAME_PACER_NUM_SAMPLE] = sample;
+	}
+
+	m_previousFrameEnd = frameEnd;
+	m_numFrame++;
+
+	if ((m_statisticsInterval > 0) && ((m_numFrame % m_statisticsInterval) == 0))
+	{
+		printStatistics();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::reset()
+{
+	m_numFrame        = 0;
+	m_headlessStarted = false;
+	m_vectorSample.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+FramePacerSample FramePacer::getAverageSample() const
+{
+	FramePacerSample result = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	if (m_vectorSample.size() == 0)
+	{
+		return result;
+	}
+
+	forIT(m_vectorSample)
+	{
+		result.m_acquireWait      += it->m_acquireWait;
+		result.m_acquireToPresent += it->m_acquireToPresent;
+		result.m_presentToIdle    += it->m_presentToIdle;
+		result.m_limiterWait      += it->m_limiterWait;
+		result.m_frameTime        += it->m_frameTime;
+	}
+
+	float numSample = float(m_vectorSample.size());
+
+	result.m_acquireWait      /= numSample;
+	result.m_acquireToPresent /= numSample;
+	result.m_presentToIdle    /= numSample;
+	result.m_limiterWait      /= numSample;
+	result.m_frameTime        /= numSample;
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+FramePacerSample FramePacer::getMaximumSample() const
+{
+	FramePacerSample result = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	forIT(m_vectorSample)
+	{
+		result.m_acquireWait      = glm::max(result.m_acquireWait,      it->m_acquireWait);
+		result.m_acquireToPresent = glm::max(result.m_acquireToPresent, it->m_acquireToPresent);
+		result.m_presentToIdle    = glm::max(result.m_presentToIdle,    it->m_presentToIdle);
+		result.m_limiterWait      = glm::max(result.m_limiterWait,      it->m_limiterWait);
+		result.m_frameTime        = glm::max(result.m_frameTime,        it->m_frameTime);
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::printStatistics() const
+{
+	FramePacerSample average = getAverageSample();
+	FramePacerSample maximum = getMaximumSample();
+
+	cout << "INFO: Frame pacing over the last " << m_vectorSample.size() << " frames (average / maximum, ms):" << endl;
+	cout << "  acquire wait        " << average.m_acquireWait      << " / " << maximum.m_acquireWait      << endl;
+	cout << "  acquire to present  " << average.m_acquireToPresent << " / " << maximum.m_acquireToPresent << endl;
+	cout << "  present to idle     " << average.m_presentToIdle    << " / " << maximum.m_presentToIdle    << endl;
+	cout << "  limiter wait        " << average.m_limiterWait      << " / " << maximum.m_limiterWait      << endl;
+	cout << "  frame time          " << average.m_frameTime        << " / " << maximum.m_frameTime        << endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+float FramePacer::getElapsed(const FramePacerTime& start, const FramePacerTime& end)
+{
+	return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void FramePacer::waitUntil(const FramePacerTime& deadline)
+{
+	float remaining = getElapsed(std::chrono::high_resolution_clock::now(), deadline);
+
+	if (remaining > FRAME_PACER_SPIN_THRESHOLD)
+	{
+		std::this_thread::sleep_for(std::chrono::duration<float, std::milli>(remaining - FRAME_PACER_SPIN_THRESHOLD));
+	}
+
+	while (std::chrono::high_resolution_clock::now() < deadline)
+	{
+		std::this_thread::yield();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,7 +98,6 @@ void GPUPipeline::init()
 
 	MultiTypeUnorderedMap* attribute = new MultiTypeUnorderedMap();
 	attribute->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapDistanceTextureCodeChunk),      string("distanceShadowMappingTexture")));
-	attribute->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapOffscreenTextureCodeChunk),     string("offscreenDistanceDepthTexture")));
 	attribute->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapMaterialNameCodeChunk),         string("MaterialDistanceShadowMapping")));
 	attribute->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapFramebufferNameCodeChunk),      string("distanceshadowmapframebuffer")));
 	attribute->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapCameraNameCodeChunk),           string("maincamera")));
@@ -106,7 +105,6 @@ void GPUPipeline::init()
 
 	MultiTypeUnorderedMap* attribute2 = new MultiTypeUnorderedMap();
 	attribute2->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapDistanceTextureCodeChunk),      string("mainCameradistanceShadowMappingTexture")));
-	attribute2->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapOffscreenTextureCodeChunk),     string("mainCameraOffscreenDistanceDepthTexture")));
 	attribute2->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapMaterialNameCodeChunk),         string("MainCameraMaterialDistanceShadowMapping")));
 	attribute2->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapFramebufferNameCodeChunk),      string("mainCameraDistanceshadowmapframebuffer")));
 	attribute2->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_distanceShadowMapCameraNameCodeChunk),           string("emitter")));
@@ -555,7 +553,7 @@ void GPUPipeline::preSceneLoadResources()
 	Texture* renderTargetDepth = textureM->buildTexture(move(string("scenelightingdepth")),
 														VK_FORMAT_D24_UNORM_S8_UINT,
 														{ uint32_t(coreM->getWidth()), uint32_t(coreM->getHeight()), 1 },
-														VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+														VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
 														VK_IMAGE_ASPECT_DEPTH_BIT,
 														VK_IMAGE_ASPECT_DEPTH_BIT,
 														VK_IMAGE_LAYOUT_UNDEFINED,
@@ -566,6 +564,10 @@ void GPUPipeline::preSceneLoadResources()
 														VK_IMAGE_VIEW_TYPE_2D,
 														0);
 
+	// Both render targets follow the output resolution, resized together with the swap chain in CoreManager::resize
+	textureM->setOutputRelative(renderTargetColor, vec2(1.0f));
+	textureM->setOutputRelative(renderTargetDepth, vec2(1.0f));
+
 	VkAttachmentReference* depthReference  = new VkAttachmentReference({ 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL });
 	VkPipelineBindPoint* pipelineBindPoint = new VkPipelineBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
 
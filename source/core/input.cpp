@@ -14,7 +14,9 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 // GLOBAL INCLUDES
+#ifdef _WIN32
 #include <windowsx.h>
+#endif // _WIN32
 
 // PROJECT INCLUDES
 #include "../../include/core/input.h"
@@ -46,6 +48,7 @@ Input::Input():
 	, m_leftMouseButtonUp(false)
 	, m_centerMouseButtonUp(false)
 	, m_rightMouseButtonUp(false)
+	, m_frameIndex(0)
 {
 	// Camera keyboard controls
 	m_eventSignalSlot.addKeyDownSignal(KeyCode::KEY_CODE_UP);
@@ -73,70 +76,133 @@ Input::~Input()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#ifdef _WIN32
 void Input::updateInput(MSG& message)
 {
 	int32_t x = GET_X_LPARAM(message.lParam);
 	int32_t y = GET_Y_LPARAM(message.lParam);
 
-	uint8_t bestBtn = ButtonState(1) ? 1 : ButtonState(2) ? 2 : ButtonState(3) ? 3 : 0;
-
 	switch (message.message)
 	{
 		case WM_KEYDOWN:
 		{
-			return KeyEvent(ActionCode::ACTION_CODE_DOWN, WIN32_TO_HID[message.wParam]);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_KEY, ActionCode::ACTION_CODE_DOWN, static_cast<KeyCode>(WIN32_TO_HID[message.wParam]), x, y, 0, 0 });
 		}
 		case WM_KEYUP:
 		{
-			return KeyEvent(ActionCode::ACTION_CODE_UP, WIN32_TO_HID[message.wParam]);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_KEY, ActionCode::ACTION_CODE_UP, static_cast<KeyCode>(WIN32_TO_HID[message.wParam]), x, y, 0, 0 });
 		}
 		case WM_MOUSEMOVE:
 		{
-			if (m_settingCursorPosition)
-			{
-				m_settingCursorPosition = false;
-				return;
-			}
-
-			if (cameraM->getOperatingCamera())
-			{
-				cameraM->refCameraOperated()->update(x, y);
-			}
-			else
-			{
-				cameraM->refMainCamera()->update(x, y);
-			}
-			return MouseEvent(ActionCode::ACTION_CODE_MOVE, x, y, bestBtn, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_MOVE, KeyCode::KEY_CODE_NONE, x, y, 0, 0 });
 		}
 		case WM_LBUTTONDOWN:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_DOWN, x, y, 1, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_DOWN, KeyCode::KEY_CODE_NONE, x, y, 1, 0 });
 		}
 		case WM_MBUTTONDOWN:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_DOWN, x, y, 2, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_DOWN, KeyCode::KEY_CODE_NONE, x, y, 2, 0 });
 		}
 		case WM_RBUTTONDOWN:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_DOWN, x, y, 3, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_DOWN, KeyCode::KEY_CODE_NONE, x, y, 3, 0 });
 		}
 		case WM_LBUTTONUP:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_UP, x, y, 1, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_UP, KeyCode::KEY_CODE_NONE, x, y, 1, 0 });
 		}
 		case WM_MBUTTONUP:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_UP, x, y, 2, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_UP, KeyCode::KEY_CODE_NONE, x, y, 2, 0 });
 		}
 		case WM_RBUTTONUP:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_UP, x, y, 3, 0);
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_UP, KeyCode::KEY_CODE_NONE, x, y, 3, 0 });
 		}
 		case WM_MOUSEWHEEL:
 		{
-			return MouseEvent(ActionCode::ACTION_CODE_MOUSE_WHEEL, x, y, 0, int8_t(GET_WHEEL_DELTA_WPARAM(message.wParam)));
+			return pushEvent({ InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_MOUSE_WHEEL, KeyCode::KEY_CODE_NONE, x, y, 0, int8_t(GET_WHEEL_DELTA_WPARAM(message.wParam)) });
+		}
+	}
+}
+#endif // _WIN32
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Input::pushEvent(const InputEvent& event)
+{
+	m_vectorEvent.push_back(event);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Input::processEventQueue()
+{
+	m_inputScript.getFrameEvent(m_frameIndex, m_vectorEvent);
+
+	// Copy in case a slot reached while processing the events queues new ones, which will be processed next frame
+	vector<InputEvent> vectorEventCopy = m_vectorEvent;
+	m_vectorEvent.clear();
+
+	forIT(vectorEventCopy)
+	{
+		processEvent(*it);
+	}
+
+	m_frameIndex++;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Input::loadInputScript(const string& filePath)
+{
+	if (!m_inputScript.load(filePath))
+	{
+		return false;
+	}
+
+	// Script frame indices are relative to the moment the script is loaded
+	m_frameIndex = 0;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Input::processEvent(const InputEvent& event)
+{
+	if (event.m_type == InputEventType::INPUT_EVENT_TYPE_KEY)
+	{
+		return KeyEvent(event.m_action, static_cast<uint8_t>(event.m_key));
+	}
+
+	int32_t x = (event.m_x < 0) ? m_mouseX : event.m_x;
+	int32_t y = (event.m_y < 0) ? m_mouseY : event.m_y;
+
+	if (event.m_action == ActionCode::ACTION_CODE_MOVE)
+	{
+		if (m_settingCursorPosition)
+		{
+			m_settingCursorPosition = false;
+			return;
+		}
+
+		if (cameraM->getOperatingCamera())
+		{
+			cameraM->refCameraOperated()->update(x, y);
 		}
+		else
+		{
+			cameraM->refMainCamera()->update(x, y);
+		}
+
+		uint8_t bestBtn = ButtonState(1) ? 1 : ButtonState(2) ? 2 : ButtonState(3) ? 3 : 0;
+
+		return MouseEvent(ActionCode::ACTION_CODE_MOVE, x, y, bestBtn, 0);
 	}
+
+	MouseEvent(event.m_action, x, y, event.m_button, event.m_wheelDelta);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,11 +352,13 @@ void Input::getCursorPos(int32_t &x, int32_t &y)
 
 void Input::setCursorPos(int32_t x, int32_t y)
 {
+#ifdef _WIN32
 	tagPOINT point;
 	point.x = x;
 	point.y = y;
 	ClientToScreen(coreM->getWindowPlatformHandle(), &point);
 	SetCursorPos(point.x, point.y);
+#endif // _WIN32
 
 	m_mouseX = x;
 	m_mouseY = y;
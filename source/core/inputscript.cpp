@@ -0,0 +1,275 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <sstream>
+
+// PROJECT INCLUDES
+#include "../../include/core/inputscript.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+InputScript::InputScript()
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputScript::load(const string& filePath)
+{
+	clear();
+
+	ifstream file(filePath);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	string line;
+	uint lineNumber = 0;
+
+	while (getline(file, line))
+	{
+		lineNumber++;
+
+		size_t commentStart = line.find('#');
+		if (commentStart != string::npos)
+		{
+			line = line.substr(0, commentStart);
+		}
+
+		if (!parseLine(line))
+		{
+			cout << "ERROR in InputScript::load, unable to parse line " << lineNumber << " of " << filePath << ": " << line << endl;
+			clear();
+			return false;
+		}
+	}
+
+	stable_sort(m_vectorEvent.begin(), m_vectorEvent.end(), [](const InputScriptEvent& a, const InputScriptEvent& b) { return a.m_frame < b.m_frame; });
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputScript::clear()
+{
+	m_vectorEvent.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputScript::getFrameEvent(uint frameIndex, vector<InputEvent>& vectorEvent) const
+{
+	vector<InputScriptEvent>::const_iterator it = lower_bound(m_vectorEvent.begin(), m_vectorEvent.end(), frameIndex, [](const InputScriptEvent& event, uint value) { return event.m_frame < value; });
+
+	for (; (it != m_vectorEvent.end()) && (it->m_frame == frameIndex); ++it)
+	{
+		vectorEvent.push_back(it->m_event);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint InputScript::getNumFrame() const
+{
+	return (m_vectorEvent.size() > 0) ? (m_vectorEvent.back().m_frame + 1) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+KeyCode InputScript::getKeyCode(const string& name)
+{
+	string upperName = name;
+	transform(upperName.begin(), upperName.end(), upperName.begin(), ::toupper);
+
+	if ((upperName.size() == 1) && (upperName[0] >= 'A') && (upperName[0] <= 'Z'))
+	{
+		return static_cast<KeyCode>(int(KeyCode::KEY_CODE_A) + (upperName[0] - 'A'));
+	}
+
+	if ((upperName.size() == 1) && (upperName[0] >= '1') && (upperName[0] <= '9'))
+	{
+		return static_cast<KeyCode>(int(KeyCode::KEY_CODE_1) + (upperName[0] - '1'));
+	}
+
+	if (upperName == "0")
+	{
+		return KeyCode::KEY_CODE_0;
+	}
+
+	if ((upperName.size() > 1) && (upperName[0] == 'F') && isdigit(upperName[1]))
+	{
+		int functionIndex = atoi(upperName.c_str() + 1);
+
+		if ((functionIndex >= 1) && (functionIndex <= 12))
+		{
+			return static_cast<KeyCode>(int(KeyCode::KEY_CODE_F1) + (functionIndex - 1));
+		}
+	}
+
+	static const map<string, KeyCode> mapKeyName =
+	{
+		{ "UP",     KeyCode::KEY_CODE_UP },
+		{ "DOWN",   KeyCode::KEY_CODE_DOWN },
+		{ "LEFT",   KeyCode::KEY_CODE_LEFT },
+		{ "RIGHT",  KeyCode::KEY_CODE_RIGHT },
+		{ "SPACE",  KeyCode::KEY_CODE_SPACE },
+		{ "ENTER",  KeyCode::KEY_CODE_ENTER },
+		{ "ESCAPE", KeyCode::KEY_CODE_ESCAPE },
+		{ "TAB",    KeyCode::KEY_CODE_TAB }
+	};
+
+	map<string, KeyCode>::const_iterator it = mapKeyName.find(upperName);
+
+	if (it != mapKeyName.end())
+	{
+		return it->second;
+	}
+
+	// USB HID code given as a number
+	char* end    = nullptr;
+	long hidCode = strtol(name.c_str(), &end, 10);
+
+	if ((end != name.c_str()) && (*end == '\0') && (hidCode > 0) && (hidCode < 256))
+	{
+		return static_cast<KeyCode>(hidCode);
+	}
+
+	return KeyCode::KEY_CODE_NONE;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputScript::parseLine(const string& line)
+{
+	istringstream lineStream(line);
+	uint frame;
+	string command;
+
+	if (!(lineStream >> frame))
+	{
+		// Only empty lines are allowed not to start with a frame index
+		lineStream.clear();
+		lineStream.seekg(0);
+		return !(lineStream >> command);
+	}
+
+	if (!(lineStream >> command))
+	{
+		return false;
+	}
+
+	if ((command == "key_down") || (command == "key_up") || (command == "key_press") || (command == "key_hold"))
+	{
+		string keyName;
+		if (!(lineStream >> keyName))
+		{
+			return false;
+		}
+
+		KeyCode key = getKeyCode(keyName);
+		if (key == KeyCode::KEY_CODE_NONE)
+		{
+			return false;
+		}
+
+		if (command == "key_down")
+		{
+			addKeyEvent(frame, ActionCode::ACTION_CODE_DOWN, key);
+		}
+		else if (command == "key_up")
+		{
+			addKeyEvent(frame, ActionCode::ACTION_CODE_UP, key);
+		}
+		else if (command == "key_press")
+		{
+			addKeyEvent(frame,     ActionCode::ACTION_CODE_DOWN, key);
+			addKeyEvent(frame + 1, ActionCode::ACTION_CODE_UP,   key);
+		}
+		else
+		{
+			// Pressed keys are consumed each frame by Input::updateKeyboard, so a held key needs a key down event per frame
+			uint numFrame;
+			if (!(lineStream >> numFrame))
+			{
+				return false;
+			}
+
+			forI(numFrame)
+			{
+				addKeyEvent(frame + uint(i), ActionCode::ACTION_CODE_DOWN, key);
+			}
+
+			addKeyEvent(frame + numFrame, ActionCode::ACTION_CODE_UP, key);
+		}
+
+		return true;
+	}
+
+	InputEvent event = { InputEventType::INPUT_EVENT_TYPE_MOUSE, ActionCode::ACTION_CODE_MOVE, KeyCode::KEY_CODE_NONE, -1, -1, 0, 0 };
+	bool result      = true;
+
+	if (command == "mouse_move")
+	{
+		result = bool(lineStream >> event.m_x >> event.m_y);
+	}
+	else if ((command == "mouse_down") || (command == "mouse_up"))
+	{
+		int button     = 0;
+		result         = bool(lineStream >> button >> event.m_x >> event.m_y) && (button >= 1) && (button <= 3);
+		event.m_action = (command == "mouse_down") ? ActionCode::ACTION_CODE_DOWN : ActionCode::ACTION_CODE_UP;
+		event.m_button = uint8_t(button);
+	}
+	else if (command == "mouse_wheel")
+	{
+		int delta          = 0;
+		result             = bool(lineStream >> delta);
+		event.m_action     = ActionCode::ACTION_CODE_MOUSE_WHEEL;
+		event.m_wheelDelta = int8_t(glm::clamp(delta, -127, 127));
+	}
+	else
+	{
+		return false;
+	}
+
+	if (result)
+	{
+		m_vectorEvent.push_back({ frame, event });
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputScript::addKeyEvent(uint frame, ActionCode action, KeyCode key)
+{
+	InputEvent event = { InputEventType::INPUT_EVENT_TYPE_KEY, action, key, -1, -1, 0, 0 };
+	m_vectorEvent.push_back({ frame, event });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,7 +153,7 @@ void Instance::createInstance(vector<const char*>& arrayLayer, vector<const char
 	appInfo.applicationVersion = 1;
 	appInfo.pEngineName        = applicationName;
 	appInfo.engineVersion      = 1;
-	appInfo.apiVersion         = VK_MAKE_VERSION(1, 0, 0); // VK_API_VERSION is now deprecated, use VK_MAKE_VERSION instead.
+	appInfo.apiVersion         = VK_MAKE_VERSION(1, 1, 0); // VK_API_VERSION is now deprecated, use VK_MAKE_VERSION instead. Vulkan 1.1 is needed for vkCmdDispatchBase
 
 	// Define the Vulkan instance create info structure 
 	VkInstanceCreateInfo instInfo = {};
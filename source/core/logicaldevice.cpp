@@ -70,6 +70,8 @@ void LogicalDevice::createDevice(vector<const char*>& extensions, uint32_t graph
 	setEnabledFeatures.shaderStorageImageWriteWithoutFormat   = VK_TRUE;
 	setEnabledFeatures.shaderFloat64                          = VK_TRUE;
 	setEnabledFeatures.shaderInt64                            = VK_TRUE;
+	setEnabledFeatures.multiDrawIndirect                      = VK_TRUE;
+	setEnabledFeatures.drawIndirectFirstInstance              = VK_TRUE;
 
 	VkDeviceCreateInfo deviceInfo = {};
 	deviceInfo.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
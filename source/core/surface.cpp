@@ -44,6 +44,8 @@ Surface::Surface():
 	, m_width(0)
 	, m_height(0)
 	, m_graphicsQueueWithPresentIndex(UINT_MAX)
+	, m_preferredPresentMode(VK_PRESENT_MODE_MAX_ENUM_KHR)
+	, m_preferredNumberOfSwapChainImages(0)
 {
 
 }
@@ -468,35 +470,100 @@ void Surface::destroySurface()
 
 void Surface::managePresentMode(VkPresentModeKHR& presentMode, uint32_t& numberOfSwapChainImages)
 {
-	// If mailbox mode is available, use it, as is the lowest-latency non-
-	// tearing mode.  If not, try IMMEDIATE which will usually be available,
-	// and is fastest (though it tears).  If not, fall back to FIFO which is
-	// always available.
-	presentMode = VK_PRESENT_MODE_FIFO_KHR;
-	for (size_t i = 0; i < m_arrayPresentMode.size(); i++)
-	{
-		if (m_arrayPresentMode[i] == VK_PRESENT_MODE_MAILBOX_KHR)
-		{
-			presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
-			break;
-		}
-		if ((presentMode != VK_PRESENT_MODE_MAILBOX_KHR) &&
-			(m_arrayPresentMode[i] == VK_PRESENT_MODE_IMMEDIATE_KHR))
+	bool preferredSupported = (find(m_arrayPresentMode.begin(), m_arrayPresentMode.end(), m_preferredPresentMode) != m_arrayPresentMode.end());
+
+	if ((m_preferredPresentMode != VK_PRESENT_MODE_MAX_ENUM_KHR) && !preferredSupported)
+	{
+		cout << "WARNING in Surface::managePresentMode, present mode " << getPresentModeName(m_preferredPresentMode) << " not supported, choosing it automatically" << endl;
+	}
+
+	if (preferredSupported)
+	{
+		presentMode = m_preferredPresentMode;
+	}
+	else
+	{
+		// If mailbox mode is available, use it, as is the lowest-latency non-
+		// tearing mode.  If not, try IMMEDIATE which will usually be available,
+		// and is fastest (though it tears).  If not, fall back to FIFO which is
+		// always available.
+		presentMode = VK_PRESENT_MODE_FIFO_KHR;
+		for (size_t i = 0; i < m_arrayPresentMode.size(); i++)
 		{
-			presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+			if (m_arrayPresentMode[i] == VK_PRESENT_MODE_MAILBOX_KHR)
+			{
+				presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+				break;
+			}
+			if ((presentMode != VK_PRESENT_MODE_MAILBOX_KHR) &&
+				(m_arrayPresentMode[i] == VK_PRESENT_MODE_IMMEDIATE_KHR))
+			{
+				presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+			}
 		}
 	}
 
 	// Determine the number of VkImage's to use in the swap chain (we desire to
 	// own only 1 image at a time, besides the images being displayed and
-	// queued for display):
-	numberOfSwapChainImages = m_surfaceCapabilities.minImageCount + 1;
+	// queued for display), unless a specific number was requested:
+	numberOfSwapChainImages = (m_preferredNumberOfSwapChainImages > 0) ? m_preferredNumberOfSwapChainImages : (m_surfaceCapabilities.minImageCount + 1);
+	numberOfSwapChainImages = glm::max(numberOfSwapChainImages, m_surfaceCapabilities.minImageCount);
 	if ((m_surfaceCapabilities.maxImageCount > 0) &&
 		(numberOfSwapChainImages > m_surfaceCapabilities.maxImageCount))
 	{
 		// Application must settle for fewer images than desired:
 		numberOfSwapChainImages = m_surfaceCapabilities.maxImageCount;
 	}
+
+	cout << "INFO: Swap chain present mode " << getPresentModeName(presentMode) << " with " << numberOfSwapChainImages << " images" << endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+VkPresentModeKHR Surface::getPresentModeFromName(const string& name)
+{
+	if (name == "fifo")
+	{
+		return VK_PRESENT_MODE_FIFO_KHR;
+	}
+	else if (name == "fifo_relaxed")
+	{
+		return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+	}
+	else if (name == "mailbox")
+	{
+		return VK_PRESENT_MODE_MAILBOX_KHR;
+	}
+	else if (name == "immediate")
+	{
+		return VK_PRESENT_MODE_IMMEDIATE_KHR;
+	}
+
+	return VK_PRESENT_MODE_MAX_ENUM_KHR;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+string Surface::getPresentModeName(VkPresentModeKHR presentMode)
+{
+	if (presentMode == VK_PRESENT_MODE_FIFO_KHR)
+	{
+		return "fifo";
+	}
+	else if (presentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR)
+	{
+		return "fifo_relaxed";
+	}
+	else if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR)
+	{
+		return "mailbox";
+	}
+	else if (presentMode == VK_PRESENT_MODE_IMMEDIATE_KHR)
+	{
+		return "immediate";
+	}
+
+	return "unknown";
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
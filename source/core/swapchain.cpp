@@ -77,8 +77,8 @@ void SwapChain::createSwapChain()
 	// The real size of textures is the size of the swapchain surface made, which can be
 	// different from the size of the built window in some cases
 	m_swapChainExtent = coreM->setSwapChainExtent();
-	m_width           = glm::min(m_width,  m_swapChainExtent.width);
-	m_height          = glm::min(m_height, m_swapChainExtent.height);
+	m_width           = glm::min(coreM->getWidth(),  m_swapChainExtent.width);
+	m_height          = glm::min(coreM->getHeight(), m_swapChainExtent.height);
 
 	cout << "INFO: Final swapchain resolution (" << m_width << ", " << m_height << ")" << endl;
 
@@ -141,6 +141,18 @@ void SwapChain::createSwapChainColorImages()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void SwapChain::destroyColorImageView()
+{
+	forI(m_arraySwapChainImageView.size())
+	{
+		vkDestroyImageView(coreM->getLogicalDevice(), m_arraySwapChainImageView[i], NULL);
+	}
+
+	m_arraySwapChainImageView.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void SwapChain::createColorImageView()
 {
 	m_arraySwapChainImageView.clear();
@@ -182,6 +194,16 @@ void SwapChain::createFrameBuffer()
 	forI(m_arraySwapchainImages.size())
 	{
 		name = "swapchain_" + to_string(i);
+
+		// When resizing, the textures of the previous swap chain images are updated, rebuilding their framebuffers
+		Texture* texture = textureM->getElement(move(string(name)));
+		if (texture != nullptr)
+		{
+			textureM->updateTextureFromExistingResources(texture, m_arraySwapchainImages[i], m_arraySwapChainImageView[i], m_width, m_height);
+			vectorSwapChainColorImage[i] = texture;
+			continue;
+		}
+
 		vectorSwapChainColorImage[i] = textureM->buildTextureFromExistingResources(
 			move(string(name)),
 			m_arraySwapchainImages[i],
@@ -194,6 +216,20 @@ void SwapChain::createFrameBuffer()
 		vectorSwapChainColorImage[i]->setIsSwapChainTex(true);
 	}
 
+	// When the new swap chain has fewer images than the previous one, the framebuffers and textures of the remaining
+	// previous images are removed. Their views were already destroyed in destroyColorImageView
+	uint staleIndex = uint(m_arraySwapchainImages.size());
+	Texture* stale  = textureM->getElement(move("swapchain_" + to_string(staleIndex)));
+	while (stale != nullptr)
+	{
+		framebufferM->removeElement(move("swapchain_" + to_string(staleIndex)));
+		textureM->updateTextureFromExistingResources(stale, VK_NULL_HANDLE, VK_NULL_HANDLE, m_width, m_height);
+		textureM->removeElement(move("swapchain_" + to_string(staleIndex)));
+
+		staleIndex++;
+		stale = textureM->getElement(move("swapchain_" + to_string(staleIndex)));
+	}
+
 	Framebuffer* fb;
 	m_arrayFramebuffers.clear();
 	m_arrayFramebuffers.resize(m_arraySwapchainImages.size());
@@ -224,6 +260,8 @@ void SwapChain::createDepthImage()
 		VK_IMAGE_TILING_OPTIMAL,
 		VK_IMAGE_VIEW_TYPE_2D,
 		0);
+
+	textureM->setOutputRelative(depth, vec2(1.0f));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
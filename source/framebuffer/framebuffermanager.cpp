@@ -56,6 +56,8 @@ void FramebufferManager::destroyResources()
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +210,54 @@ void FramebufferManager::slotElement(const char* managerName, string&& elementNa
 				}
 			}
 
+			break;
+		}
+		case ManagerNotificationType::MNT_CHANGED:
+		{
+			// An attachment has been resized or had its resources replaced: the framebuffer is built again, taking
+			// as size the smallest one among its attachments
+			if (managerName != g_textureManager)
+			{
+				break;
+			}
+
+			vector<Framebuffer*> vectorFramebuffer = computeNotifyAffectedElements(managerName, move(string(elementName)), notificationType);
+
+			forI(vectorFramebuffer.size())
+			{
+				Framebuffer* framebuffer = vectorFramebuffer[i];
+				framebuffer->destroyFramebufferResources();
+
+				uint32_t width  = UINT_MAX;
+				uint32_t height = UINT_MAX;
+				forJ(framebuffer->m_arrayAttachmentName.size())
+				{
+					Texture* texture = textureM->getElement(move(string(framebuffer->m_arrayAttachmentName[j])));
+					if (texture != nullptr)
+					{
+						width  = glm::min(width,  texture->getWidth());
+						height = glm::min(height, texture->getHeight());
+					}
+				}
+
+				if ((width != UINT_MAX) && (height != UINT_MAX))
+				{
+					framebuffer->m_width  = width;
+					framebuffer->m_height = height;
+				}
+
+				framebuffer->setReady(verifyCanBeBuilt(framebuffer));
+				if (framebuffer->getReady())
+				{
+					framebuffer->setReady(buildFramebufferResources(framebuffer));
+				}
+
+				if (gpuPipelineM->getPipelineInitialized())
+				{
+					emitSignalElement(move(string(framebuffer->getName())), ManagerNotificationType::MNT_CHANGED);
+				}
+			}
+
 			break;
 		}
 	}
@@ -150,6 +150,46 @@ void BBox3D::computeFromVertList(const vectorVec3 &vecData, Node* pModel)
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void BBox3D::computeFromPointList(const vectorVec3 &vecData)
+{
+	if (vecData.size() == 0)
+	{
+		reset();
+		return;
+	}
+
+	m_min = vecData[0];
+	m_max = vecData[0];
+
+	forI(vecData.size())
+	{
+		m_min = glm::min(m_min, vecData[i]);
+		m_max = glm::max(m_max, vecData[i]);
+	}
+
+	computeMaxDist();
+	computeCenter();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void BBox3D::computeFromTransformedBox(const BBox3D &box, const mat4 &matrix)
+{
+	vec3 center = vec3(matrix * vec4((box.m_min + box.m_max) * 0.5f, 1.0f));
+	vec3 extent = (box.m_max - box.m_min) * 0.5f;
+
+	// Each world axis extent is the sum of the object space extents projected with the absolute value of the rotation and scale part
+	extent = glm::abs(vec3(matrix[0])) * extent.x + glm::abs(vec3(matrix[1])) * extent.y + glm::abs(vec3(matrix[2])) * extent.z;
+
+	m_min = center - extent;
+	m_max = center + extent;
+
+	computeMaxDist();
+	computeCenter();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void BBox3D::computeMaxDist()
 {
 	m_maxDistance = l2Norm(m_max - m_min);
@@ -0,0 +1,613 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <chrono>
+
+// PROJECT INCLUDES
+#include "../../include/geometry/meshsimplifier.h"
+#include "../../include/util/loopMacroDefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Builds the quadric of the plane ax + by + cz + d = 0
+* @param a [in] plane equation coefficient
+* @param b [in] plane equation coefficient
+* @param c [in] plane equation coefficient
+* @param d [in] plane equation coefficient
+* @return plane quadric */
+static MeshSimplifierQuadric buildPlaneQuadric(double a, double b, double c, double d)
+{
+	return { { a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d } };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Adds the two quadrics given as parameter
+* @param q0 [in] first quadric
+* @param q1 [in] second quadric
+* @return sum of both quadrics */
+static MeshSimplifierQuadric addQuadric(const MeshSimplifierQuadric& q0, const MeshSimplifierQuadric& q1)
+{
+	MeshSimplifierQuadric result;
+	forI(10)
+	{
+		result.m_data[i] = q0.m_data[i] + q1.m_data[i];
+	}
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Determinant of the 3x3 matrix made of the quadric elements given by the indices a11 to a33
+* @param q   [in] quadric
+* @param a11 [in] index of the quadric element used as first row, first column element (same for the rest of parameters)
+* @return determinant value */
+static double quadricDeterminant(const MeshSimplifierQuadric& q, int a11, int a12, int a13, int a21, int a22, int a23, int a31, int a32, int a33)
+{
+	const double* m = q.m_data;
+	return m[a11] * m[a22] * m[a33] + m[a13] * m[a21] * m[a32] + m[a12] * m[a23] * m[a31] - m[a13] * m[a22] * m[a31] - m[a11] * m[a23] * m[a32] - m[a12] * m[a21] * m[a33];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Evaluates the quadric error of the point p
+* @param q [in] quadric
+* @param p [in] point
+* @return quadric error */
+static double quadricError(const MeshSimplifierQuadric& q, const dvec3& p)
+{
+	const double* m = q.m_data;
+	return m[0] * p.x * p.x + 2.0 * m[1] * p.x * p.y + 2.0 * m[2] * p.x * p.z + 2.0 * m[3] * p.x + m[4] * p.y * p.y + 2.0 * m[5] * p.y * p.z + 2.0 * m[6] * p.y + m[7] * p.z * p.z + 2.0 * m[8] * p.z + m[9];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+MeshSimplifier::MeshSimplifier():
+	  m_numDeletedTriangle(0)
+	, m_maxCollapseError(0.0)
+	, m_numIteration(0)
+	, m_errorBudgetReached(false)
+	, m_elapsedTime(0.0f)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::setMesh(const vectorUint& vectorIndex, const vectorVec3& vectorVertex)
+{
+	uint numTriangle = uint(vectorIndex.size()) / 3;
+	uint numVertex   = uint(vectorVertex.size());
+
+	m_vectorReference.clear();
+	m_vectorTriangle.resize(numTriangle);
+	m_vectorVertex.resize(numVertex);
+
+	forI(numVertex)
+	{
+		MeshSimplifierVertex& vertex = m_vectorVertex[i];
+		vertex.m_position            = dvec3(vectorVertex[i]);
+		vertex.m_triangleStart       = 0;
+		vertex.m_triangleCount       = 0;
+		vertex.m_border              = false;
+	}
+
+	forI(numTriangle)
+	{
+		MeshSimplifierTriangle& triangle = m_vectorTriangle[i];
+		triangle.m_vertex[0]             = vectorIndex[3 * i + 0];
+		triangle.m_vertex[1]             = vectorIndex[3 * i + 1];
+		triangle.m_vertex[2]             = vectorIndex[3 * i + 2];
+		triangle.m_deleted               = false;
+		triangle.m_dirty                 = false;
+	}
+
+	m_numDeletedTriangle = 0;
+	m_maxCollapseError   = 0.0;
+	m_numIteration       = 0;
+	m_errorBudgetReached = false;
+	m_elapsedTime        = 0.0f;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::simplify(uint targetTriangleCount, double errorBudget)
+{
+	auto startTime = chrono::high_resolution_clock::now();
+
+	m_numDeletedTriangle = 0;
+	m_maxCollapseError   = 0.0;
+	m_errorBudgetReached = false;
+
+	forIT(m_vectorTriangle)
+	{
+		it->m_deleted = false;
+	}
+
+	uint numTriangle = uint(m_vectorTriangle.size());
+	vectorBool vectorDeleted0;
+	vectorBool vectorDeleted1;
+
+	for (m_numIteration = 0; m_numIteration < MESH_SIMPLIFIER_MAX_ITERATION; ++m_numIteration)
+	{
+		if ((numTriangle - m_numDeletedTriangle) <= targetTriangleCount)
+		{
+			break;
+		}
+
+		// Update the mesh from time to time
+		if ((m_numIteration % 5) == 0)
+		{
+			updateMesh(m_numIteration);
+		}
+
+		forIT(m_vectorTriangle)
+		{
+			it->m_dirty = false;
+		}
+
+		uint numDeletedTriangleStart = m_numDeletedTriangle;
+
+		// All the triangles with edges below the threshold will be removed, the threshold grows with the iterations
+		double threshold = 0.000000001 * pow(double(m_numIteration + 3), MESH_SIMPLIFIER_AGGRESSIVENESS);
+
+		if (threshold > errorBudget)
+		{
+			threshold            = errorBudget;
+			m_errorBudgetReached = true;
+		}
+
+		forI(m_vectorTriangle.size())
+		{
+			const MeshSimplifierTriangle& triangle = m_vectorTriangle[i];
+
+			if ((triangle.m_error[3] > threshold) || triangle.m_deleted || triangle.m_dirty)
+			{
+				continue;
+			}
+
+			forJ(3)
+			{
+				if (m_vectorTriangle[i].m_error[j] >= threshold)
+				{
+					continue;
+				}
+
+				uint index0                   = m_vectorTriangle[i].m_vertex[j];
+				uint index1                   = m_vectorTriangle[i].m_vertex[(j + 1) % 3];
+				MeshSimplifierVertex& vertex0 = m_vectorVertex[index0];
+				MeshSimplifierVertex& vertex1 = m_vectorVertex[index1];
+
+				// Border check
+				if (vertex0.m_border != vertex1.m_border)
+				{
+					continue;
+				}
+
+				// Compute the vertex to collapse to
+				dvec3 position;
+				double error = computeError(index0, index1, position);
+
+				vectorDeleted0.assign(vertex0.m_triangleCount, false);
+				vectorDeleted1.assign(vertex1.m_triangleCount, false);
+
+				// Don't remove if flipped
+				if (flipped(position, index1, vertex0, vectorDeleted0) || flipped(position, index0, vertex1, vectorDeleted1))
+				{
+					continue;
+				}
+
+				// Not flipped, so remove the edge
+				vertex0.m_position = position;
+				vertex0.m_quadric  = addQuadric(vertex1.m_quadric, vertex0.m_quadric);
+				m_maxCollapseError = glm::max(m_maxCollapseError, error);
+
+				uint triangleStart = uint(m_vectorReference.size());
+
+				updateTriangle(index0, vertex0, vectorDeleted0);
+				updateTriangle(index0, vertex1, vectorDeleted1);
+
+				uint triangleCount = uint(m_vectorReference.size()) - triangleStart;
+
+				if (triangleCount <= vertex0.m_triangleCount)
+				{
+					// Save memory reusing the previous references of vertex0
+					if (triangleCount > 0)
+					{
+						memcpy(&m_vectorReference[vertex0.m_triangleStart], &m_vectorReference[triangleStart], triangleCount * sizeof(MeshSimplifierReference));
+					}
+				}
+				else
+				{
+					// Append
+					vertex0.m_triangleStart = triangleStart;
+				}
+
+				vertex0.m_triangleCount = triangleCount;
+				break;
+			}
+
+			// Done?
+			if ((numTriangle - m_numDeletedTriangle) <= targetTriangleCount)
+			{
+				break;
+			}
+		}
+
+		// No edge below the error budget was collapsed, further iterations would not collapse anything either
+		if (m_errorBudgetReached && (numDeletedTriangleStart == m_numDeletedTriangle))
+		{
+			break;
+		}
+	}
+
+	compactMesh();
+
+	m_elapsedTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::getResult(vectorUint& vectorIndex, vectorVec3& vectorVertex) const
+{
+	uint numTriangle = uint(m_vectorTriangle.size());
+	uint numVertex   = uint(m_vectorVertex.size());
+
+	vectorIndex.resize(3 * numTriangle);
+	vectorVertex.resize(numVertex);
+
+	forI(numVertex)
+	{
+		vectorVertex[i] = vec3(m_vectorVertex[i].m_position);
+	}
+
+	forI(numTriangle)
+	{
+		vectorIndex[3 * i + 0] = m_vectorTriangle[i].m_vertex[0];
+		vectorIndex[3 * i + 1] = m_vectorTriangle[i].m_vertex[1];
+		vectorIndex[3 * i + 2] = m_vectorTriangle[i].m_vertex[2];
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint MeshSimplifier::getNumTriangle() const
+{
+	return uint(m_vectorTriangle.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint MeshSimplifier::getNumVertex() const
+{
+	return uint(m_vectorVertex.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::updateMesh(uint iteration)
+{
+	if (iteration > 0)
+	{
+		// Compact triangles
+		uint destination = 0;
+		forI(m_vectorTriangle.size())
+		{
+			if (!m_vectorTriangle[i].m_deleted)
+			{
+				m_vectorTriangle[destination++] = m_vectorTriangle[i];
+			}
+		}
+		m_vectorTriangle.resize(destination);
+	}
+
+	// Initialize quadrics by plane and edge errors, only needed at the beginning
+	if (iteration == 0)
+	{
+		forIT(m_vectorVertex)
+		{
+			it->m_quadric = buildPlaneQuadric(0.0, 0.0, 0.0, 0.0);
+		}
+
+		forIT(m_vectorTriangle)
+		{
+			dvec3 p0     = m_vectorVertex[it->m_vertex[0]].m_position;
+			dvec3 p1     = m_vectorVertex[it->m_vertex[1]].m_position;
+			dvec3 p2     = m_vectorVertex[it->m_vertex[2]].m_position;
+			dvec3 normal = cross(p1 - p0, p2 - p0);
+			double size  = length(normal);
+			normal       = (size > 0.0) ? (normal / size) : dvec3(0.0);
+			it->m_normal = normal;
+
+			MeshSimplifierQuadric quadric = buildPlaneQuadric(normal.x, normal.y, normal.z, -dot(normal, p0));
+			forJ(3)
+			{
+				MeshSimplifierVertex& vertex = m_vectorVertex[it->m_vertex[j]];
+				vertex.m_quadric             = addQuadric(vertex.m_quadric, quadric);
+			}
+		}
+
+		forIT(m_vectorTriangle)
+		{
+			dvec3 position;
+			forJ(3)
+			{
+				it->m_error[j] = computeError(it->m_vertex[j], it->m_vertex[(j + 1) % 3], position);
+			}
+			it->m_error[3] = glm::min(it->m_error[0], glm::min(it->m_error[1], it->m_error[2]));
+		}
+	}
+
+	// Initialize the vertex to triangle references
+	forIT(m_vectorVertex)
+	{
+		it->m_triangleStart = 0;
+		it->m_triangleCount = 0;
+	}
+
+	forIT(m_vectorTriangle)
+	{
+		forJ(3)
+		{
+			m_vectorVertex[it->m_vertex[j]].m_triangleCount++;
+		}
+	}
+
+	uint triangleStart = 0;
+	forIT(m_vectorVertex)
+	{
+		it->m_triangleStart = triangleStart;
+		triangleStart      += it->m_triangleCount;
+		it->m_triangleCount = 0;
+	}
+
+	m_vectorReference.resize(m_vectorTriangle.size() * 3);
+	forI(m_vectorTriangle.size())
+	{
+		const MeshSimplifierTriangle& triangle = m_vectorTriangle[i];
+		forJ(3)
+		{
+			MeshSimplifierVertex& vertex       = m_vectorVertex[triangle.m_vertex[j]];
+			MeshSimplifierReference& reference = m_vectorReference[vertex.m_triangleStart + vertex.m_triangleCount];
+			reference.m_triangle       = i;
+			reference.m_triangleVertex = j;
+			vertex.m_triangleCount++;
+		}
+	}
+
+	// Identify the border vertices, those whose edges are used by a single triangle
+	if (iteration == 0)
+	{
+		vectorUint vectorCount;
+		vectorUint vectorId;
+
+		forIT(m_vectorVertex)
+		{
+			it->m_border = false;
+		}
+
+		forIT(m_vectorVertex)
+		{
+			vectorCount.clear();
+			vectorId.clear();
+
+			forI(it->m_triangleCount)
+			{
+				const MeshSimplifierTriangle& triangle = m_vectorTriangle[m_vectorReference[it->m_triangleStart + i].m_triangle];
+
+				forJ(3)
+				{
+					uint id = triangle.m_vertex[j];
+					auto itFound = find(vectorId.begin(), vectorId.end(), id);
+					if (itFound == vectorId.end())
+					{
+						vectorCount.push_back(1);
+						vectorId.push_back(id);
+					}
+					else
+					{
+						vectorCount[itFound - vectorId.begin()]++;
+					}
+				}
+			}
+
+			forI(vectorCount.size())
+			{
+				if (vectorCount[i] == 1)
+				{
+					m_vectorVertex[vectorId[i]].m_border = true;
+				}
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::updateTriangle(uint vertexIndex, const MeshSimplifierVertex& vertex, const vectorBool& vectorDeleted)
+{
+	dvec3 position;
+
+	forI(vertex.m_triangleCount)
+	{
+		MeshSimplifierReference reference = m_vectorReference[vertex.m_triangleStart + i];
+		MeshSimplifierTriangle& triangle  = m_vectorTriangle[reference.m_triangle];
+
+		if (triangle.m_deleted)
+		{
+			continue;
+		}
+
+		if (vectorDeleted[i])
+		{
+			triangle.m_deleted = true;
+			m_numDeletedTriangle++;
+			continue;
+		}
+
+		triangle.m_vertex[reference.m_triangleVertex] = vertexIndex;
+		triangle.m_dirty    = true;
+		triangle.m_error[0] = computeError(triangle.m_vertex[0], triangle.m_vertex[1], position);
+		triangle.m_error[1] = computeError(triangle.m_vertex[1], triangle.m_vertex[2], position);
+		triangle.m_error[2] = computeError(triangle.m_vertex[2], triangle.m_vertex[0], position);
+		triangle.m_error[3] = glm::min(triangle.m_error[0], glm::min(triangle.m_error[1], triangle.m_error[2]));
+		m_vectorReference.push_back(reference);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MeshSimplifier::flipped(dvec3 position, uint index1, const MeshSimplifierVertex& vertex0, vectorBool& vectorDeleted) const
+{
+	forI(vertex0.m_triangleCount)
+	{
+		const MeshSimplifierReference& reference = m_vectorReference[vertex0.m_triangleStart + i];
+		const MeshSimplifierTriangle& triangle   = m_vectorTriangle[reference.m_triangle];
+
+		if (triangle.m_deleted)
+		{
+			continue;
+		}
+
+		uint id1 = triangle.m_vertex[(reference.m_triangleVertex + 1) % 3];
+		uint id2 = triangle.m_vertex[(reference.m_triangleVertex + 2) % 3];
+
+		// The triangle shares the collapsed edge, it will be removed
+		if ((id1 == index1) || (id2 == index1))
+		{
+			vectorDeleted[i] = true;
+			continue;
+		}
+
+		dvec3 d1 = normalize(m_vectorVertex[id1].m_position - position);
+		dvec3 d2 = normalize(m_vectorVertex[id2].m_position - position);
+
+		if (glm::abs(dot(d1, d2)) > 0.999)
+		{
+			return true;
+		}
+
+		dvec3 normal     = normalize(cross(d1, d2));
+		vectorDeleted[i] = false;
+
+		if (dot(normal, triangle.m_normal) < 0.2)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+double MeshSimplifier::computeError(uint index0, uint index1, dvec3& position) const
+{
+	// Compute the interpolated vertex
+	const MeshSimplifierVertex& vertex0 = m_vectorVertex[index0];
+	const MeshSimplifierVertex& vertex1 = m_vectorVertex[index1];
+	MeshSimplifierQuadric quadric       = addQuadric(vertex0.m_quadric, vertex1.m_quadric);
+	bool border                         = vertex0.m_border && vertex1.m_border;
+	double determinant                  = quadricDeterminant(quadric, 0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+	if ((determinant != 0.0) && !border)
+	{
+		// The quadric is invertible, use the optimal position
+		position.x = -1.0 / determinant * quadricDeterminant(quadric, 1, 2, 3, 4, 5, 6, 5, 7, 8);
+		position.y =  1.0 / determinant * quadricDeterminant(quadric, 0, 2, 3, 1, 5, 6, 2, 7, 8);
+		position.z = -1.0 / determinant * quadricDeterminant(quadric, 0, 1, 3, 1, 4, 6, 2, 5, 8);
+		return quadricError(quadric, position);
+	}
+
+	// Otherwise, use the best of the edge end points and the edge middle point
+	dvec3 p0      = vertex0.m_position;
+	dvec3 p1      = vertex1.m_position;
+	dvec3 p2      = (p0 + p1) * 0.5;
+	double error0 = quadricError(quadric, p0);
+	double error1 = quadricError(quadric, p1);
+	double error2 = quadricError(quadric, p2);
+	double error  = glm::min(error0, glm::min(error1, error2));
+
+	if (error0 == error)
+	{
+		position = p0;
+	}
+	else if (error1 == error)
+	{
+		position = p1;
+	}
+	else
+	{
+		position = p2;
+	}
+
+	return error;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MeshSimplifier::compactMesh()
+{
+	forIT(m_vectorVertex)
+	{
+		it->m_triangleCount = 0;
+	}
+
+	uint destination = 0;
+	forI(m_vectorTriangle.size())
+	{
+		if (!m_vectorTriangle[i].m_deleted)
+		{
+			m_vectorTriangle[destination] = m_vectorTriangle[i];
+			forJ(3)
+			{
+				m_vectorVertex[m_vectorTriangle[destination].m_vertex[j]].m_triangleCount = 1;
+			}
+			destination++;
+		}
+	}
+	m_vectorTriangle.resize(destination);
+
+	// Remove the vertices not referenced by any triangle, m_triangleStart stores the new index of each vertex
+	destination = 0;
+	forI(m_vectorVertex.size())
+	{
+		if (m_vectorVertex[i].m_triangleCount > 0)
+		{
+			m_vectorVertex[i].m_triangleStart      = destination;
+			m_vectorVertex[destination].m_position = m_vectorVertex[i].m_position;
+			destination++;
+		}
+	}
+
+	forIT(m_vectorTriangle)
+	{
+		forJ(3)
+		{
+			it->m_vertex[j] = m_vectorVertex[it->m_vertex[j]].m_triangleStart;
+		}
+	}
+	m_vectorVertex.resize(destination);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
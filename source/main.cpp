@@ -31,21 +31,84 @@ limitations under the License.
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+/** Processes the queued input events and updates and renders a frame
+* @param deltaTimeMiliseconds     [in] time spent in the previous frame
+* @param executionTimeMiliseconds [in] time since the application started
+* @return nothing */
+static void renderFrame(float deltaTimeMiliseconds, float executionTimeMiliseconds)
+{
+	sceneM->setDeltaTime(deltaTimeMiliseconds);
+	sceneM->setExecutionTime(executionTimeMiliseconds);
+	inputM->processEventQueue();
+	inputM->updateKeyboard();
+	sceneM->update();
+	gpuPipelineM->update();
+	coreM->prepare();
+	RedrawWindow(coreM->getWindowPlatformHandle(), NULL, NULL, RDW_INTERNALPAINT);
+	coreM->render();
+	coreM->postRender();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 int main(int argc, char **argv)
 {
 	s_pCoreManager = Singleton<CoreManager>::init();
 
+	coreM->parseCommandLineArguments(argc, argv);
 	coreM->initialize();
 	sceneM->init();
 	gpuPipelineM->init();
 
 	bool isWindowOpen = true;
-	float elapsedTimeMiliseconds;
-	float elapsedSinceApplicationStartMiliseconds;
+	float elapsedTimeMiliseconds = 0.0f;
+	float elapsedSinceApplicationStartMiliseconds = 0.0f;
 	std::chrono::steady_clock::time_point timeInit = std::chrono::high_resolution_clock::now();
 	std::chrono::steady_clock::time_point rasterTime0;
 	std::chrono::steady_clock::time_point rasterTime1;
 
+	if (coreM->getHeadless())
+	{
+		// One frame per loop iteration, input comes only from the input script. Window messages are still dispatched
+		// to keep the window responsive, but are not translated into input events
+		uint numFrame = coreM->getHeadlessNumFrame();
+		if (numFrame == 0)
+		{
+			numFrame = inputM->refInputScript().getNumFrame();
+		}
+
+		while (inputM->getFrameIndex() < numFrame)
+		{
+			MSG msg;
+			while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+			{
+				TranslateMessage(&msg);
+				DispatchMessage(&msg);
+			}
+
+			if (coreM->getEndApplicationMessage())
+			{
+				break;
+			}
+
+			if (coreM->getReachedFirstRaster() && !coreM->getIsPrepared())
+			{
+				continue;
+			}
+
+			rasterTime0 = std::chrono::high_resolution_clock::now();
+
+			renderFrame(elapsedTimeMiliseconds, elapsedSinceApplicationStartMiliseconds);
+
+			rasterTime1 = std::chrono::high_resolution_clock::now();
+			elapsedTimeMiliseconds = float(std::chrono::duration_cast<std::chrono::milliseconds>(rasterTime1 - rasterTime0).count());
+			elapsedSinceApplicationStartMiliseconds = float(std::chrono::duration_cast<std::chrono::milliseconds>(rasterTime1 - timeInit).count());
+		}
+
+		coreM->deInitialize();
+		return 0;
+	}
+
 	while (isWindowOpen)
 	{
 		if (coreM->getReachedFirstRaster() && !coreM->getIsPrepared())
@@ -68,16 +131,8 @@ int main(int argc, char **argv)
 				return false;
 			}
 
-			sceneM->setDeltaTime(elapsedTimeMiliseconds);
-			sceneM->setExecutionTime(elapsedSinceApplicationStartMiliseconds);
 			inputM->updateInput(msg);
-			inputM->updateKeyboard();
-			sceneM->update();
-			gpuPipelineM->update();
-			coreM->prepare();
-			RedrawWindow(coreM->getWindowPlatformHandle(), NULL, NULL, RDW_INTERNALPAINT);
-			coreM->render();
-			coreM->postRender();
+			renderFrame(elapsedTimeMiliseconds, elapsedSinceApplicationStartMiliseconds);
 
 			rasterTime1 = std::chrono::high_resolution_clock::now();
 			elapsedTimeMiliseconds = float(std::chrono::duration_cast<std::chrono::milliseconds>(rasterTime1 - rasterTime0).count());
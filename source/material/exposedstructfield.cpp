@@ -30,6 +30,7 @@ limitations under the License.
 ExposedStructField::ExposedStructField() :
 	m_internalType(ResourceInternalType::RIT_SIZE)
 	, m_data(nullptr)
+	, m_size(0)
 	, m_structFieldResource(nullptr)
 {
 
@@ -37,9 +38,10 @@ ExposedStructField::ExposedStructField() :
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-ExposedStructField::ExposedStructField(ResourceInternalType internalType, string&& structName, string&& structFieldName, void* data) :
+ExposedStructField::ExposedStructField(ResourceInternalType internalType, string&& structName, string&& structFieldName, void* data, uint32_t size) :
 	m_internalType(internalType)
 	, m_data(data)
+	, m_size(size)
 	, m_structFieldResource(nullptr)
 	, m_structName(move(structName))
 	, m_structFieldName(move(structFieldName))
@@ -52,8 +52,12 @@ Material::Material(string &&name, string &&className) : GenericResource(move(nam
 	, m_pushConstantExposedStructFieldSize(0)
 	, m_materialUniformBufferIndex(-1)
 	, m_isCompute(false)
+	, m_computePipelineCreateFlags(0)
 	, m_isEmitter(false)
 	, m_resourcesUsed(MaterialBufferResource::MBR_MODEL | MaterialBufferResource::MBR_CAMERA | MaterialBufferResource::MBR_MATERIAL)
+	, m_descriptorSet(VK_NULL_HANDLE)
+	, m_descriptorPool(VK_NULL_HANDLE)
+	, m_descriptorSetLayout(VK_NULL_HANDLE)
 	, m_materialInstanceIndex(shaderM->getNextInstanceSuffix())
 	, m_materialSurfaceType(MaterialSurfaceType::MST_OPAQUE)
 {
@@ -170,6 +174,8 @@ void Material::unmatchExposedResources()
 
 	m_exposedStructFieldSize             = 0;
 	m_pushConstantExposedStructFieldSize = 0;
+	m_uniformLayout.clear();
+	m_vectorDirtyFieldIndex.clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -369,7 +375,7 @@ void Material::buildPipeline()
 		VkComputePipelineCreateInfo computePipelineCreateInfo;
 		computePipelineCreateInfo.sType              = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
 		computePipelineCreateInfo.pNext              = nullptr;
-		computePipelineCreateInfo.flags              = 0;
+		computePipelineCreateInfo.flags              = m_computePipelineCreateFlags;
 		computePipelineCreateInfo.stage              = m_shader->refArrayShaderStages()[0];
 		computePipelineCreateInfo.layout             = m_pipelineLayout;
 		computePipelineCreateInfo.basePipelineHandle = nullptr;
@@ -399,12 +405,16 @@ void Material::update(float dt)
 void Material::updateExposedResources()
 {
 	m_vectorDirtyExposedStructField.clear();
+	m_vectorDirtyFieldIndex.clear();
 
-	forIT(m_vectorExposedStructField)
+	if (m_uniformLayout.update(m_vectorDirtyFieldIndex))
 	{
-		if (ShaderReflection::setResourceCPUValue((*it)))
+		forIT(m_vectorDirtyFieldIndex)
 		{
-			addIfNoPresent(&(*it), m_vectorDirtyExposedStructField);
+			// The CPU copy of the shader struct field is only needed to be kept in sync for the fields that changed
+			ExposedStructField* exposedStructField = &m_vectorExposedStructField[*it];
+			ShaderReflection::setResourceCPUValue(*exposedStructField);
+			m_vectorDirtyExposedStructField.push_back(exposedStructField);
 		}
 	}
 
@@ -440,7 +450,8 @@ bool Material::loadShader()
 void Material::buildMaterialResources()
 {
 	exposeResources();
-	m_exposedStructFieldSize             = computeExposedStructFieldSize(m_vectorExposedStructField);
+	m_uniformLayout.build(m_vectorExposedStructField);
+	m_exposedStructFieldSize             = glm::max(computeExposedStructFieldSize(m_vectorExposedStructField), int(m_uniformLayout.getSize()));
 	m_pushConstantExposedStructFieldSize = computeExposedStructFieldSize(m_vectorPushConstantExposedStructField);
 	m_shader->initializeSamplerHandlers();
 	m_shader->initializeImageHandlers();
@@ -474,27 +485,27 @@ void Material::setupPipelineData()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-bool Material::exposeStructField(ResourceInternalType internalType, void* data, string&& structName, string&& structFieldName)
+bool Material::exposeStructField(ResourceInternalType internalType, void* data, uint32_t size, string&& structName, string&& structFieldName)
 {
 	if ((data == nullptr) || !ShaderReflection::isDataType(internalType))
 	{
 		return false;
 	}
 
-	m_vectorExposedStructField.push_back(ExposedStructField(internalType, move(structName), move(structFieldName), data));
+	m_vectorExposedStructField.push_back(ExposedStructField(internalType, move(structName), move(structFieldName), data, size));
 	return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-bool Material::pushConstantExposeStructField(ResourceInternalType internalType, void* data, string&& structName, string&& structFieldName)
+bool Material::pushConstantExposeStructField(ResourceInternalType internalType, void* data, uint32_t size, string&& structName, string&& structFieldName)
 {
 	if ((data == nullptr) || !ShaderReflection::isDataType(internalType))
 	{
 		return false;
 	}
 
-	m_vectorPushConstantExposedStructField.push_back(ExposedStructField(internalType, move(structName), move(structFieldName), data));
+	m_vectorPushConstantExposedStructField.push_back(ExposedStructField(internalType, move(structName), move(structFieldName), data, size));
 	return true;
 }
 
@@ -535,7 +546,7 @@ bool Material::assignShaderStorageBuffer(string &&storageBufferName, string&& bu
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-void Material::writeExposedDataToMaterialUB() const
+void Material::writeExposedDataToMaterialUB()
 {
 	if (m_materialUniformBufferIndex == -1)
 	{
@@ -543,13 +554,25 @@ void Material::writeExposedDataToMaterialUB() const
 		return;
 	}
 
+	// The packed values of the uniform layout are written to the cell with a single copy
 	UniformBuffer* ubo = materialM->refMaterialUniformData();
-	ubo->refCPUBuffer().resetDataAtCell(m_materialUniformBufferIndex);
+	if (!ubo->refCPUBuffer().setDataAtCell(m_materialUniformBufferIndex, m_uniformLayout.getData().data(), int(m_uniformLayout.getSize())))
+	{
+		cout << "ERROR: not enough room in the material uniform buffer cell in Material::writeExposedDataToMaterialUB" << endl;
+		return;
+	}
 
-	forIT(m_vectorExposedStructField)
+	if (m_vectorDirtyFieldIndex.size() == 0)
 	{
-		ShaderReflection::appendExposedStructFieldDataToUniformBufferCell(&ubo->refCPUBuffer(), m_materialUniformBufferIndex, &(*it));
+		return;
 	}
+
+	const vector<UniformLayoutField>& vectorField = m_uniformLayout.getVectorField();
+
+	uint dirtyStart = vectorField[m_vectorDirtyFieldIndex.front()].m_offset;
+	uint dirtyEnd   = vectorField[m_vectorDirtyFieldIndex.back()].m_offset + vectorField[m_vectorDirtyFieldIndex.back()].m_size;
+
+	materialM->markMaterialUniformDirty(m_materialUniformBufferIndex, dirtyStart, dirtyEnd);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -763,6 +786,52 @@ void Material::destroyMaterialResources()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+bool Material::updateTextureDescriptor(const Texture* texture)
+{
+	if ((m_shader == nullptr) || (m_descriptorSet == VK_NULL_HANDLE))
+	{
+		return false;
+	}
+
+	const vectorSamplerPtr& arraySampler = m_shader->getVecTextureSampler();
+
+	vector<VkDescriptorImageInfo> vectorDescriptorImageInfo;
+	vector<VkWriteDescriptorSet> vectorWriteDescriptorSet;
+	vectorDescriptorImageInfo.reserve(arraySampler.size());
+
+	forIT(arraySampler)
+	{
+		if ((*it)->getTexture() != texture)
+		{
+			continue;
+		}
+
+		vectorDescriptorImageInfo.push_back({ (*it)->getSamplerHandle(), texture->getView(), texture->getImageLayout() });
+
+		VkWriteDescriptorSet writeDescriptorSet = {};
+		writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		writeDescriptorSet.pNext           = NULL;
+		writeDescriptorSet.dstSet          = m_descriptorSet;
+		writeDescriptorSet.dstBinding      = uint32_t((*it)->getBindingIndex());
+		writeDescriptorSet.dstArrayElement = 0;
+		writeDescriptorSet.descriptorCount = 1;
+		writeDescriptorSet.descriptorType  = (*it)->getDescriptorType();
+		writeDescriptorSet.pImageInfo      = &vectorDescriptorImageInfo.back();
+		vectorWriteDescriptorSet.push_back(writeDescriptorSet);
+	}
+
+	if (vectorWriteDescriptorSet.size() == 0)
+	{
+		return false;
+	}
+
+	vkUpdateDescriptorSets(coreM->getLogicalDevice(), uint32_t(vectorWriteDescriptorSet.size()), vectorWriteDescriptorSet.data(), 0, NULL);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 bool Material::shaderResourceNotification(string&& shaderResourceName, ManagerNotificationType notificationType)
 {
 	if (shaderResourceName == m_shaderResourceName)
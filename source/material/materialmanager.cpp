@@ -64,7 +64,12 @@ using namespace attributedefines;
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-MaterialManager::MaterialManager()
+MaterialManager::MaterialManager():
+	  m_materialUniformData(nullptr)
+	, m_materialUBDynamicAllignment(0)
+	, m_materialUniformMappedPointer(nullptr)
+	, m_materialUniformByteUploaded(0)
+	, m_materialUniformByteUploadedLastFrame(0)
 {
 	m_managerName = g_materialManager;
 }
@@ -80,11 +85,22 @@ MaterialManager::~MaterialManager()
 
 void MaterialManager::destroyResources()
 {
+	if (m_materialUniformMappedPointer != nullptr)
+	{
+		vkUnmapMemory(coreM->getLogicalDevice(), m_materialUniformData->refBufferInstance()->getMemory());
+		m_materialUniformMappedPointer = nullptr;
+	}
+
+	m_vectorMaterialUniformDirtyRange.clear();
+	m_vectorDirtyMaterialUniformIndex.clear();
+
 	forIT(m_mapElement)
 	{
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,30 +631,108 @@ void MaterialManager::buildMaterialUniformBuffer()
 		counter++;
 	}
 
+	if (m_materialUniformMappedPointer != nullptr)
+	{
+		vkUnmapMemory(coreM->getLogicalDevice(), m_materialUniformData->refBufferInstance()->getMemory());
+		m_materialUniformMappedPointer = nullptr;
+	}
+
 	m_materialUniformData         = uniformBufferM->buildUniformBuffer(move(string("materialUniformBuffer")), maxSize, int(m_mapElement.size()));
 	m_materialUBDynamicAllignment = uint(m_materialUniformData->getDynamicAllignment());
 
-	forIT(m_mapElement)
+	// Mapped once for the whole application lifetime, only the dirty ranges of the material cells are written each frame
+	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_materialUniformData->refBufferInstance()->getMemory(), 0, VK_WHOLE_SIZE, 0, (void**)&m_materialUniformMappedPointer);
+	assert(result == VK_SUCCESS);
+
+	m_vectorMaterialUniformDirtyRange.resize(m_mapElement.size());
+	m_vectorDirtyMaterialUniformIndex.clear();
+
+	forI(m_vectorMaterialUniformDirtyRange.size())
 	{
-		updateGPUBufferMaterialData((*it).second);
+		m_vectorMaterialUniformDirtyRange[i] = { 0, 0 };
+		markMaterialUniformDirty(int(i), 0, m_materialUBDynamicAllignment);
 	}
+
+	flushMaterialUniformData();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-void MaterialManager::updateGPUBufferMaterialData(Material* materialToUpdate)
+void MaterialManager::markMaterialUniformDirty(int materialUniformBufferIndex, uint start, uint end)
 {
-	void *data;
-	uint32_t materialOffset = uint32_t(materialToUpdate->getMaterialUniformBufferIndex() * m_materialUBDynamicAllignment);
-	VkResult result         = vkMapMemory(coreM->getLogicalDevice(), m_materialUniformData->refBufferInstance()->getMemory(), materialOffset, m_materialUBDynamicAllignment, 0, &data);
+	if ((materialUniformBufferIndex < 0) || (materialUniformBufferIndex >= int(m_vectorMaterialUniformDirtyRange.size())) || (start >= end))
+	{
+		return;
+	}
+
+	MaterialUniformDirtyRange& range = m_vectorMaterialUniformDirtyRange[materialUniformBufferIndex];
 
+	if (range.m_start == range.m_end)
+	{
+		range.m_start = start;
+		range.m_end   = end;
+		m_vectorDirtyMaterialUniformIndex.push_back(uint(materialUniformBufferIndex));
+	}
+	else
+	{
+		range.m_start = glm::min(range.m_start, start);
+		range.m_end   = glm::max(range.m_end, end);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MaterialManager::flushMaterialUniformData()
+{
+	if ((m_vectorDirtyMaterialUniformIndex.size() == 0) || (m_materialUniformMappedPointer == nullptr))
+	{
+		return;
+	}
+
+	const uint8_t* cpuBufferSourceData = static_cast<const uint8_t*>(m_materialUniformData->refCPUBuffer().refUBHostMemory());
+	const VkDeviceSize atomSize        = coreM->getPhysicalDeviceProperties().limits.nonCoherentAtomSize;
+	const VkDeviceSize mappingSize     = m_materialUniformData->refBufferInstance()->getMappingSize();
+	const VkDeviceMemory memory        = m_materialUniformData->refBufferInstance()->getMemory();
+
+	vector<VkMappedMemoryRange> vectorMappedRange(m_vectorDirtyMaterialUniformIndex.size());
+
+	forI(m_vectorDirtyMaterialUniformIndex.size())
+	{
+		uint index                       = m_vectorDirtyMaterialUniformIndex[i];
+		MaterialUniformDirtyRange& range = m_vectorMaterialUniformDirtyRange[index];
+		VkDeviceSize offset              = VkDeviceSize(index) * m_materialUBDynamicAllignment + range.m_start;
+		VkDeviceSize size                = range.m_end - range.m_start;
+
+		memcpy(m_materialUniformMappedPointer + offset, cpuBufferSourceData + offset, size);
+		m_materialUniformByteUploaded += size;
+
+		// Flushed ranges need to be multiple of nonCoherentAtomSize or reach the end of the memory allocation
+		VkDeviceSize flushStart = offset - (offset % atomSize);
+		VkDeviceSize flushEnd   = ((offset + size + atomSize - 1) / atomSize) * atomSize;
+
+		vectorMappedRange[i]        = {};
+		vectorMappedRange[i].sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		vectorMappedRange[i].pNext  = nullptr;
+		vectorMappedRange[i].memory = memory;
+		vectorMappedRange[i].offset = flushStart;
+		vectorMappedRange[i].size   = (flushEnd >= mappingSize) ? VK_WHOLE_SIZE : (flushEnd - flushStart);
+
+		range.m_start = 0;
+		range.m_end   = 0;
+	}
+
+	VkResult result = vkFlushMappedMemoryRanges(coreM->getLogicalDevice(), uint32_t(vectorMappedRange.size()), vectorMappedRange.data());
 	assert(result == VK_SUCCESS);
 
-	uint8_t* cpuBufferSourceData = static_cast<uint8_t*>(m_materialUniformData->refCPUBuffer().refUBHostMemory());
-	cpuBufferSourceData         += materialOffset;
-	memcpy(data, cpuBufferSourceData, m_materialUBDynamicAllignment);
+	m_vectorDirtyMaterialUniformIndex.clear();
+}
 
-	vkUnmapMemory(coreM->getLogicalDevice(), m_materialUniformData->refBufferInstance()->getMemory());
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void MaterialManager::endFrameMaterialUniformUpload()
+{
+	m_materialUniformByteUploadedLastFrame = m_materialUniformByteUploaded;
+	m_materialUniformByteUploaded          = 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@ limitations under the License.
 // GLOBAL INCLUDES
 #include <cctype>
 #include <experimental/filesystem>
+#include <chrono>
 
 // PROJECT INCLUDES
 #include "../../include/model/model.h"
@@ -24,6 +25,9 @@ limitations under the License.
 #include "../../include/node/emitternode.h"
 #include "../../include/scene/scene.h"
 #include "../../include/util/mathutil.h"
+#include "../../include/util/parallelutil.h"
+#include "../../include/util/bufferverificationhelper.h"
+#include "../../include/geometry/meshsimplifier.h"
 #include "../../include/util/loopMacroDefines.h"
 #include "../../include/texture/texturemanager.h"
 #include "../../include/texture/texture.h"
@@ -48,6 +52,7 @@ Model::Model():
 	, m_name("")
 	, m_XYZToMinusXZY(false)
 	, m_makeMergedGeometryNode(false)
+	, m_loadedFromSceneCache(false)
 {
 
 }
@@ -59,6 +64,7 @@ Model::Model(const string &path, const string &name, bool XYZToMinusXZY, bool ma
 	, m_name(name)
 	, m_XYZToMinusXZY(XYZToMinusXZY)
 	, m_makeMergedGeometryNode(makeMergedGeometryNode)
+	, m_loadedFromSceneCache(false)
 {
 	bool result = loadModel(path + name);
 
@@ -78,6 +84,29 @@ Model::~Model()
 
 bool Model::loadModel(string path)
 {
+	auto startTime = chrono::high_resolution_clock::now();
+
+	const uint importFlags = aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_FlipWindingOrder | aiProcess_GenNormals | aiProcess_CalcTangentSpace | aiProcess_ImproveCacheLocality;
+
+	// Any parameter affecting the imported data is part of the scene cache key
+	vectorString vectorKeyExtra = sceneM->getAvoidDecimateKeywords();
+	vectorKeyExtra.push_back(to_string(m_XYZToMinusXZY) + to_string(m_makeMergedGeometryNode) + to_string(minNumberTriangleToDecimate) + to_string(maxAABBDiagonalSizeDecimate) + to_string(decimationErrorBudgetFactor));
+
+	uint64_t sceneCacheKey;
+	string sceneCachePath  = path + SCENE_CACHE_EXTENSION;
+	bool validSceneCacheKey = SceneCache::computeKey(path, importFlags, vectorKeyExtra, sceneCacheKey);
+
+	if (validSceneCacheKey && m_sceneCache.load(sceneCachePath, sceneCacheKey))
+	{
+		m_loadedFromSceneCache = true;
+		loadFromSceneCache();
+		m_sceneCache.clear();
+
+		cout << "Model " << path << " loaded from scene cache in " << chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count() << "ms" << endl;
+
+		return true;
+	}
+
 	Assimp::Importer import;
 	const aiScene* scene = import.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_FlipWindingOrder);
 
@@ -122,13 +151,89 @@ bool Model::loadModel(string path)
 
 	aiMatrix4x4 transform;
 	processNode(scene->mRootNode, scene, transform);
+	processMeshTask(scene);
 	m_aabb = BBox3D::computeFromNodeVector(m_vecMesh);
 
+	if (validSceneCacheKey)
+	{
+		m_sceneCache.refMergedIndex()    = m_mergedIndex;
+		m_sceneCache.refMergedVertex()   = m_mergedVertex;
+		m_sceneCache.refMergedTexCoord() = m_mergedTexCoord;
+		m_sceneCache.refMergedNormal()   = m_mergedNormal;
+		m_sceneCache.refMergedTangent()  = m_mergedTangent;
+
+		float importTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+		if (!m_sceneCache.save(sceneCachePath, sceneCacheKey))
+		{
+			cout << "ERROR in Model::loadModel, unable to save scene cache file " << sceneCachePath << endl;
+		}
+		else
+		{
+			// Benchmark of the CPU side of the loader: time needed to read and parse back the cache file just written
+			// (key computation included), compared against the assimp import and mesh processing it replaces
+			auto benchmarkStartTime = chrono::high_resolution_clock::now();
+			uint64_t benchmarkKey;
+			SceneCache benchmarkSceneCache;
+			bool benchmarkResult = SceneCache::computeKey(path, importFlags, vectorKeyExtra, benchmarkKey) && benchmarkSceneCache.load(sceneCachePath, benchmarkKey);
+			float cacheLoadTime  = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - benchmarkStartTime).count();
+
+			if (benchmarkResult)
+			{
+				cout << "Model " << path << " scene cache benchmark: import " << importTime << "ms, cache load " << cacheLoadTime << "ms (" << (importTime / max(cacheLoadTime, 0.001f)) << "x)" << endl;
+			}
+			else
+			{
+				cout << "ERROR in Model::loadModel, unable to load back scene cache file " << sceneCachePath << endl;
+			}
+		}
+
+		m_sceneCache.clear();
+	}
+
+	cout << "Model " << path << " imported in " << chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count() << "ms" << endl;
+
 	return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void Model::loadFromSceneCache()
+{
+	const vector<SceneCacheMaterial>& vectorMaterial = m_sceneCache.refVectorMaterial();
+	forI(vectorMaterial.size())
+	{
+		buildMaterial(vectorMaterial[i]);
+	}
+
+	const vector<SceneCacheCamera>& vectorCamera = m_sceneCache.refVectorCamera();
+	forI(vectorCamera.size())
+	{
+		buildCamera(vectorCamera[i]);
+	}
+
+	m_mergedIndex    = m_sceneCache.refMergedIndex();
+	m_mergedVertex   = m_sceneCache.refMergedVertex();
+	m_mergedTexCoord = m_sceneCache.refMergedTexCoord();
+	m_mergedNormal   = m_sceneCache.refMergedNormal();
+	m_mergedTangent  = m_sceneCache.refMergedTangent();
+
+	const vector<SceneCacheMesh>& vectorMesh = m_sceneCache.refVectorMesh();
+	forI(vectorMesh.size())
+	{
+		const SceneCacheMesh& mesh = vectorMesh[i];
+		Node* temp = buildNode(mesh.m_index, mesh.m_vertex, mesh.m_texCoord, mesh.m_normal, mesh.m_tangent, mesh.m_materialName, nullptr);
+		if (temp != nullptr)
+		{
+			m_vecMesh.push_back(temp);
+		}
+	}
+
+	m_aabb = BBox3D::computeFromNodeVector(m_vecMesh);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void Model::processNode(aiNode* node, const aiScene* scene, const aiMatrix4x4 accTransform)
 {
 	cout << "Node name is: " << node->mName.C_Str() << endl;
@@ -139,69 +244,36 @@ void Model::processNode(aiNode* node, const aiScene* scene, const aiMatrix4x4 ac
 
 	if (it != m_vectorEmitterName.end())
 	{
-		mat4 nodeMatrix = MathUtil::assimpAIMatrix4x4ToGLM(&transform);
+		SceneCacheCamera camera;
+		camera.m_name      = string(node->mName.C_Str());
+		camera.m_isEmitter = true;
+		camera.m_transform = MathUtil::assimpAIMatrix4x4ToGLM(&transform);
+		camera.m_up        = vec3(0.0f, 1.0f, 0.0f);
+		camera.m_zNear     = ZNEAR;
+		camera.m_zFar      = ZFAR;
 
-		glm::vec3 scale;
-		glm::quat rotation;
-		glm::vec3 translation;
-		glm::vec3 skew;
-		glm::vec4 perspective;
-		glm::decompose(nodeMatrix, scale, rotation, translation, skew, perspective);
-
-		const mat4 inverted      = inverse(nodeMatrix);
-		const vec3 lookAt        = normalize(glm::vec3(inverted[2]));
-		vec4 lookAtTransformed4D = nodeMatrix * vec4(lookAt, 0.0f);
-		vec3 lookAtTransformed   = vec3(lookAtTransformed4D.x, lookAtTransformed4D.y, lookAtTransformed4D.z);
-
-		Camera* sceneCamera = cameraM->buildCamera(move(string(node->mName.C_Str())),
-			CameraType::CT_FIRST_PERSON,
-			//translation, // overwritten by value below
-			vec3(-6.53219557f, 16.7277241f, -3.21760464f), // Render for comparison with Cyril Crassin, final emitter position used
-			lookAtTransformed,
-			vec3(0.0f, 1.0f, 0.0f),
-			ZNEAR,
-			ZFAR,
-			glm::pi<float>() * 0.25f);
-
-		//sceneCamera->setIsAnimated(true);
-
-		sceneM->addCamera(sceneCamera);
+		buildCamera(camera);
+		m_sceneCache.refVectorCamera().push_back(camera);
 	}
 
 	it = find(m_vectorCameraName.begin(), m_vectorCameraName.end(), string(node->mName.C_Str()));
 
 	if (it != m_vectorCameraName.end())
 	{
-		float zFar;
-		float zNear;
-
-		vec3 up;
+		SceneCacheCamera camera;
 		vec3 position;
 		vec3 lookAt;
 		
-		bool result = getCameraInformation(scene, move(string(node->mName.C_Str())), position, lookAt, up, zNear, zFar);
+		bool result = getCameraInformation(scene, move(string(node->mName.C_Str())), position, lookAt, camera.m_up, camera.m_zNear, camera.m_zFar);
 
 		if(result)
 		{
-			mat4 nodeMatrix          = MathUtil::assimpAIMatrix4x4ToGLM(&transform);
-			mat4 inverted            = inverse(nodeMatrix);
-			vec3 lookAt              = normalize(glm::vec3(inverted[2]));
-			vec4 lookAtTransformed4D = nodeMatrix * vec4(lookAt, 0.0f);
-			vec3 lookAtTransformed   = vec3(lookAtTransformed4D.x, lookAtTransformed4D.y, lookAtTransformed4D.z);
-			vec4 upTransformed4D     = nodeMatrix * vec4(up, 0.0f);
-			vec3 upTransformed       = vec3(upTransformed4D.x, upTransformed4D.y, upTransformed4D.z);
-
-			Camera* sceneCamera = cameraM->buildCamera(move(string(node->mName.C_Str())),
-													   CameraType::CT_FIRST_PERSON,
-													   // position, // overwritten by line below
-													   vec3(-9.16604, 5.5527, -2.12906), // Render for comparison with max FPS with VCT
-													   lookAtTransformed,
-													   upTransformed,
-													   zNear,
-													   zFar,
-													   glm::pi<float>() * 0.25f); // Assimp import from .fbx won't load correct fov value https://github.com/assimp/assimp/issues/245
-			
-			sceneM->addCamera(sceneCamera);
+			camera.m_name      = string(node->mName.C_Str());
+			camera.m_isEmitter = false;
+			camera.m_transform = MathUtil::assimpAIMatrix4x4ToGLM(&transform);
+
+			buildCamera(camera);
+			m_sceneCache.refVectorCamera().push_back(camera);
 		}
 	}
 
@@ -212,11 +284,7 @@ void Model::processNode(aiNode* node, const aiScene* scene, const aiMatrix4x4 ac
 		mesh = scene->mMeshes[node->mMeshes[i]];
 		if (mesh->HasTextureCoords(0)) // Avoid those meshes without texture coordinates
 		{
-			Node* temp = processMesh(mesh, scene, transform, string(node->mName.C_Str()));
-			if (temp != nullptr)
-			{
-				m_vecMesh.push_back(temp);
-			}
+			m_vectorMeshTask.push_back({ mesh, transform, string(node->mName.C_Str()) });
 		}
 		else
 		{
@@ -233,6 +301,63 @@ void Model::processNode(aiNode* node, const aiScene* scene, const aiMatrix4x4 ac
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void Model::buildCamera(const SceneCacheCamera& camera)
+{
+	const mat4& nodeMatrix = camera.m_transform;
+
+	if (camera.m_isEmitter)
+	{
+		glm::vec3 scale;
+		glm::quat rotation;
+		glm::vec3 translation;
+		glm::vec3 skew;
+		glm::vec4 perspective;
+		glm::decompose(nodeMatrix, scale, rotation, translation, skew, perspective);
+
+		const mat4 inverted      = inverse(nodeMatrix);
+		const vec3 lookAt        = normalize(glm::vec3(inverted[2]));
+		vec4 lookAtTransformed4D = nodeMatrix * vec4(lookAt, 0.0f);
+		vec3 lookAtTransformed   = vec3(lookAtTransformed4D.x, lookAtTransformed4D.y, lookAtTransformed4D.z);
+
+		Camera* sceneCamera = cameraM->buildCamera(move(string(camera.m_name)),
+			CameraType::CT_FIRST_PERSON,
+			//translation, // overwritten by value below
+			vec3(-6.53219557f, 16.7277241f, -3.21760464f), // Render for comparison with Cyril Crassin, final emitter position used
+			lookAtTransformed,
+			vec3(0.0f, 1.0f, 0.0f),
+			ZNEAR,
+			ZFAR,
+			glm::pi<float>() * 0.25f);
+
+		//sceneCamera->setIsAnimated(true);
+
+		sceneM->addCamera(sceneCamera);
+	}
+	else
+	{
+		mat4 inverted            = inverse(nodeMatrix);
+		vec3 lookAt              = normalize(glm::vec3(inverted[2]));
+		vec4 lookAtTransformed4D = nodeMatrix * vec4(lookAt, 0.0f);
+		vec3 lookAtTransformed   = vec3(lookAtTransformed4D.x, lookAtTransformed4D.y, lookAtTransformed4D.z);
+		vec4 upTransformed4D     = nodeMatrix * vec4(camera.m_up, 0.0f);
+		vec3 upTransformed       = vec3(upTransformed4D.x, upTransformed4D.y, upTransformed4D.z);
+
+		Camera* sceneCamera = cameraM->buildCamera(move(string(camera.m_name)),
+												   CameraType::CT_FIRST_PERSON,
+												   // position, // overwritten by line below
+												   vec3(-9.16604, 5.5527, -2.12906), // Render for comparison with max FPS with VCT
+												   lookAtTransformed,
+												   upTransformed,
+												   camera.m_zNear,
+												   camera.m_zFar,
+												   glm::pi<float>() * 0.25f); // Assimp import from .fbx won't load correct fov value https://github.com/assimp/assimp/issues/245
+			
+		sceneM->addCamera(sceneCamera);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 bool Model::hasTangentAndBitangent(const aiScene* scene)
 {
 	bool result = true;
@@ -308,8 +433,7 @@ void Model::loadMaterials(const aiScene* scene)
 	size_t found;
 	string reflectanceTextureFinalName;
 	string normalTextureFinalName;
-	Texture* reflectance;
-	Texture* normal;
+	SceneCacheMaterial cacheMaterial;
 
 	forI(scene->mNumMaterials)
 	{
@@ -320,11 +444,13 @@ void Model::loadMaterials(const aiScene* scene)
 		std::transform(materialString.begin(), materialString.end(), materialString.begin(), ::tolower);
 		found = materialString.find(string("emitter"));
 
-		if (found != string::npos)
-		{
-			materialM->buildMaterial(move(string("MaterialPlainColor")), move(string(materialName.C_Str())), nullptr);
-		}
-		else
+		cacheMaterial.m_name               = string(materialName.C_Str());
+		cacheMaterial.m_isEmitter          = (found != string::npos);
+		cacheMaterial.m_reflectanceTexture = "";
+		cacheMaterial.m_normalTexture      = "";
+		cacheMaterial.m_surfaceType        = uint(MaterialSurfaceType::MST_OPAQUE);
+
+		if (!cacheMaterial.m_isEmitter)
 		{
 			numReflectance                            = material->GetTextureCount(aiTextureType_DIFFUSE);
 			bool overwriteReflectanceTextureFinalName = true;
@@ -370,31 +496,51 @@ void Model::loadMaterials(const aiScene* scene)
 
 			MaterialSurfaceType surfaceType = getMaterialTextureType(reflectanceTextureFinalName);
 
-			reflectance = textureM->build2DTextureFromFile(
-				move(string(reflectanceTextureFinalName)),
-				move(m_path + reflectanceTextureFinalName),
-				VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
-				VK_FORMAT_R8G8B8A8_UNORM);
+			cacheMaterial.m_reflectanceTexture = reflectanceTextureFinalName;
+			cacheMaterial.m_normalTexture      = normalTextureFinalName;
+			cacheMaterial.m_surfaceType        = uint(surfaceType);
+		}
+
+		buildMaterial(cacheMaterial);
+		m_sceneCache.refVectorMaterial().push_back(cacheMaterial);
+	}
+}
 
-			normal = textureM->build2DTextureFromFile(
-				move(string(normalTextureFinalName)),
-				move(m_path + normalTextureFinalName),
-				VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
-				VK_FORMAT_R8G8B8A8_UNORM);
+/////////////////////////////////////////////////////////////////////////////////////////////
 
-			MultiTypeUnorderedMap *attributeMaterial = new MultiTypeUnorderedMap();
-			attributeMaterial->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_reflectanceTextureResourceName), string(reflectance->getName())));
-			attributeMaterial->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_normalTextureResourceName), string(normal->getName())));
+void Model::buildMaterial(const SceneCacheMaterial& material)
+{
+	if (material.m_isEmitter)
+	{
+		materialM->buildMaterial(move(string("MaterialPlainColor")), move(string(material.m_name)), nullptr);
+		return;
+	}
 
-			if (surfaceType != MaterialSurfaceType::MST_OPAQUE)
-			{
-				attributeMaterial->newElement<AttributeData<MaterialSurfaceType>*>(new AttributeData<MaterialSurfaceType>(string(g_materialSurfaceType), move(surfaceType)));
-			}
+	MaterialSurfaceType surfaceType = MaterialSurfaceType(material.m_surfaceType);
 
-			materialM->buildMaterial(move(string("MaterialColorTexture")), move(string(materialName.C_Str())), attributeMaterial);
-			materialM->buildMaterial(move(string("MaterialIndirectColorTexture")), move(string(materialName.C_Str()) + "Instanced"), attributeMaterial);
-		}
+	Texture* reflectance = textureM->build2DTextureFromFile(
+		move(string(material.m_reflectanceTexture)),
+		move(m_path + material.m_reflectanceTexture),
+		VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
+		VK_FORMAT_R8G8B8A8_UNORM);
+
+	Texture* normal = textureM->build2DTextureFromFile(
+		move(string(material.m_normalTexture)),
+		move(m_path + material.m_normalTexture),
+		VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
+		VK_FORMAT_R8G8B8A8_UNORM);
+
+	MultiTypeUnorderedMap *attributeMaterial = new MultiTypeUnorderedMap();
+	attributeMaterial->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_reflectanceTextureResourceName), string(reflectance->getName())));
+	attributeMaterial->newElement<AttributeData<string>*>(new AttributeData<string>(string(g_normalTextureResourceName), string(normal->getName())));
+
+	if (surfaceType != MaterialSurfaceType::MST_OPAQUE)
+	{
+		attributeMaterial->newElement<AttributeData<MaterialSurfaceType>*>(new AttributeData<MaterialSurfaceType>(string(g_materialSurfaceType), move(surfaceType)));
 	}
+
+	materialM->buildMaterial(move(string("MaterialColorTexture")), move(string(material.m_name)), attributeMaterial);
+	materialM->buildMaterial(move(string("MaterialIndirectColorTexture")), move(string(material.m_name) + "Instanced"), attributeMaterial);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,90 +581,73 @@ MaterialSurfaceType Model::getMaterialTextureType(const string& textureName)
 	return MaterialSurfaceType::MST_OPAQUE;
 }
 
-#include "Simplify.h"
-
-/////////////////////////////////////////////////////////////////////////////////////////////
-
 void Model::addMergedGeometryNodeInformation(const vectorUint& vectorIndex,
 											 const vectorVec3& vectorVertex,
 											 const vectorVec2& vectorTexCoord,
 											 const vectorVec3& vectorNormal,
 											 const vectorVec3& vectorTangent,
-											 vec3 aabbMin,
-											 vec3 aabbMax,
-											 const string& nodeName)
+											 const ModelMeshDecimation* decimation)
 {
-	bool addedToMergedGeometry = false;
-	const vectorString& refVectorAvoidDecimateKeywords = sceneM->getAvoidDecimateKeywords();
-	bool avoidDecimate = false;
-	forI(refVectorAvoidDecimateKeywords.size())
+	if ((decimation == nullptr) || !decimation->m_decimated)
 	{
-		if (nodeName.find(refVectorAvoidDecimateKeywords[i]) != string::npos)
-		{
-			avoidDecimate = true;
-			break;
-		}
+		addMergedGeometry(vectorIndex, vectorVertex, vectorTexCoord, vectorNormal, vectorTangent);
+		return;
 	}
 
-	float sizeOfAABB = distance(aabbMin, aabbMax);
+	uint finalVertexSize = static_cast<uint>(decimation->m_vertex.size());
 
-	if (!avoidDecimate && (vectorVertex.size() > minNumberTriangleToDecimate) && (sizeOfAABB < maxAABBDiagonalSizeDecimate))
-	{
-		int simplifyTargetCount = static_cast<int>(vectorVertex.size()) / 9;
-
-		// The bigger the object, the less aggressive the decimation
-		if((sizeOfAABB >= 15.0f) && (sizeOfAABB < 20.0f))
-		{
-			simplifyTargetCount = static_cast<int>(vectorVertex.size()) / 9;
-		}
-		else if ((sizeOfAABB >= 20.0f) && (sizeOfAABB < 25.0f))
-		{
-			simplifyTargetCount = static_cast<int>(vectorVertex.size()) / 9;
-		}
-		else if ((sizeOfAABB >= 25.0f) && (sizeOfAABB < 30.0f))
-		{
-			simplifyTargetCount = static_cast<int>(vectorVertex.size()) / 9;
-		}
+	vectorVec2 vectorTexCoordDecimated = vectorTexCoord;
+	vectorVec3 vectorNormalDecimated   = vectorNormal;
+	vectorVec3 vectorTangentDecimated  = vectorTangent;
 
-		prepareDecimationData(vectorIndex, vectorVertex);
-		Simplify::simplify_mesh(simplifyTargetCount);
+	vectorTexCoordDecimated.resize(finalVertexSize);
+	vectorNormalDecimated.resize(finalVertexSize);
+	vectorTangentDecimated.resize(finalVertexSize);
 
-		if ((Simplify::triangles.size() < (vectorIndex.size() / 3)) && (Simplify::triangles.size() > 3))
-		{
-			uint finalVertexSize   = static_cast<uint>(Simplify::vertices.size());
-			uint finalTriangleSize = static_cast<int>(Simplify::triangles.size()) * 3;
+	addMergedGeometry(decimation->m_index, decimation->m_vertex, vectorTexCoordDecimated, vectorNormalDecimated, vectorTangentDecimated);
+}
 
-			vectorVec3 vectorVertexDecimated(finalVertexSize);
-			forI(finalVertexSize)
-			{
-				vectorVertexDecimated[i] = vec3(Simplify::vertices[i].p.x, Simplify::vertices[i].p.y, Simplify::vertices[i].p.z);
-			}
+/////////////////////////////////////////////////////////////////////////////////////////////
 
-			vectorUint vectorIndexDecimated(finalTriangleSize);
-			forI(finalTriangleSize / 3)
-			{
-				vectorIndexDecimated[3 * i + 0] = Simplify::triangles[i].v[0];
-				vectorIndexDecimated[3 * i + 1] = Simplify::triangles[i].v[1];
-				vectorIndexDecimated[3 * i + 2] = Simplify::triangles[i].v[2];
-			}
+void Model::decimateMesh(const SceneCacheMesh& mesh, ModelMeshDecimation& decimation) const
+{
+	const vectorUint& vectorIndex  = mesh.m_index;
+	const vectorVec3& vectorVertex = mesh.m_vertex;
 
-			vectorVec2 vectorTexCoordDecimated = vectorTexCoord;
-			vectorVec3 vectorNormalDecimated   = vectorNormal;
-			vectorVec3 vectorTangentDecimated  = vectorTangent;
+	decimation.m_decimated        = false;
+	decimation.m_numTriangleInput = static_cast<uint>(vectorIndex.size()) / 3;
+	decimation.m_elapsedTime      = 0.0f;
 
-			vectorTexCoordDecimated.resize(finalVertexSize);
-			vectorNormalDecimated.resize(finalVertexSize);
-			vectorTangentDecimated.resize(finalVertexSize);
+	const vectorString& refVectorAvoidDecimateKeywords = sceneM->getAvoidDecimateKeywords();
+	forI(refVectorAvoidDecimateKeywords.size())
+	{
+		if (mesh.m_nodeName.find(refVectorAvoidDecimateKeywords[i]) != string::npos)
+		{
+			return;
+		}
+	}
 
-			addMergedGeometry(vectorIndexDecimated, vectorVertexDecimated, vectorTexCoordDecimated, vectorNormalDecimated, vectorTangentDecimated);
+	float sizeOfAABB = distance(mesh.m_aabbMin, mesh.m_aabbMax);
 
-			addedToMergedGeometry = true;
-		}
+	if ((vectorVertex.size() <= minNumberTriangleToDecimate) || (sizeOfAABB >= maxAABBDiagonalSizeDecimate))
+	{
+		return;
 	}
 
-	if (!addedToMergedGeometry)
+	uint simplifyTargetCount = static_cast<uint>(vectorVertex.size()) / 9;
+	double errorBudget       = double(decimationErrorBudgetFactor) * double(sizeOfAABB) * double(sizeOfAABB);
+
+	MeshSimplifier simplifier;
+	simplifier.setMesh(vectorIndex, vectorVertex);
+	simplifier.simplify(simplifyTargetCount, errorBudget);
+
+	decimation.m_elapsedTime = simplifier.getElapsedTime();
+
+	uint numTriangle = simplifier.getNumTriangle();
+	if ((numTriangle < decimation.m_numTriangleInput) && (numTriangle > 3))
 	{
-		addMergedGeometry(vectorIndex, vectorVertex, vectorTexCoord, vectorNormal, vectorTangent);
+		simplifier.getResult(decimation.m_index, decimation.m_vertex);
+		decimation.m_decimated = true;
 	}
 }
 
@@ -552,50 +681,57 @@ bool Model::getCameraInformation(const aiScene* scene, string&& cameraName, vec3
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-Node *Model::processMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4 &transform, const string& nodeName)
+void Model::processMesh(const aiMesh* mesh, const aiMatrix4x4 &transform, SceneCacheMesh& cacheMesh) const
 {
-	vectorUint indices;
-	vectorVec3 vertices;
-	vectorVec2 texCoord;
-	vectorVec3 normals;
-	vectorVec3 tangents;
+	vectorUint& indices  = cacheMesh.m_index;
+	vectorVec3& vertices = cacheMesh.m_vertex;
+	vectorVec2& texCoord = cacheMesh.m_texCoord;
+	vectorVec3& normals  = cacheMesh.m_normal;
+	vectorVec3& tangents = cacheMesh.m_tangent;
+
+	uint numVertex = mesh->mNumVertices;
 
-	vec3 vector3;
-	vec2 vector2;
+	// Output streams are sized once, the assimp per-vertex data is copied straight into them
+	vertices.resize(numVertex);
+	texCoord.resize(mesh->HasTextureCoords(0) ? numVertex : 0); // only first texture coordinate channel covered now
+	normals.resize(mesh->HasNormals() ? numVertex : 0);
+	tangents.resize(mesh->HasTangentsAndBitangents() ? numVertex : 0);
 
-	forI(mesh->mNumVertices)
+	forI(numVertex)
 	{
-		vector3 = vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
-		vertices.push_back(vector3);
+		vertices[i] = vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+	}
 
-		if (mesh->HasTextureCoords(0)) // only first texture coordinate channel covered now
-		{
-			vector2 = vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
-			texCoord.push_back(vector2);
-		}
+	forI(texCoord.size())
+	{
+		texCoord[i] = vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
+	}
 
-		if (mesh->HasNormals())
-		{
-			vector3 = vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
-			normals.push_back(vector3);
-		}
+	forI(normals.size())
+	{
+		normals[i] = vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
+	}
 
-		if (mesh->HasTangentsAndBitangents())
-		{
-			vector3 = vec3(mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z);
-			tangents.push_back(vector3);
-		}
+	forI(tangents.size())
+	{
+		tangents[i] = vec3(mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z);
 	}
 
 	// Process indices
-	aiFace face;
+	uint numIndex = 0;
 	forI(mesh->mNumFaces)
 	{
-		face = mesh->mFaces[i];
-		forJ(face.mNumIndices)
-		{
-			indices.push_back(face.mIndices[j]);
-		}
+		numIndex += mesh->mFaces[i].mNumIndices;
+	}
+
+	indices.resize(numIndex);
+
+	uint counter = 0;
+	forI(mesh->mNumFaces)
+	{
+		const aiFace& face = mesh->mFaces[i];
+		memcpy(&indices[counter], face.mIndices, face.mNumIndices * sizeof(uint));
+		counter += face.mNumIndices;
 	}
 
 	// If the model comes from a file with coordinate system as 3DS max ("z" up, "x" front and "y" right), then coordinates must be
@@ -609,43 +745,101 @@ Node *Model::processMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4 &
 
 	// Transform vertices
 	mat4 mat = MathUtil::assimpAIMatrix4x4ToGLM(&transform);
+	MathUtil::transformPointArray(mat, vertices, cacheMesh.m_aabbMin, cacheMesh.m_aabbMax);
+}
 
-	vec3 aabbMin = vec3( FLT_MAX,  FLT_MAX,  FLT_MAX);
-	vec3 aabbMax = vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+/////////////////////////////////////////////////////////////////////////////////////////////
 
-	forI(vertices.size())
+void Model::processMeshTask(const aiScene* scene)
+{
+	// Material names are resolved once per assimp material instead of once per mesh
+	vectorString vectorMaterialName(scene->mNumMaterials);
+	forI(scene->mNumMaterials)
 	{
-		vec3 v3D    = vertices[i];
-		vec4 v4D    = mat * vec4(v3D, 1.0f);
-		vertices[i] = vec3(v4D.x, v4D.y, v4D.z);
+		aiString materialName;
+		scene->mMaterials[i]->Get(AI_MATKEY_NAME, materialName);
+		vectorMaterialName[i] = string(materialName.C_Str());
+	}
 
-		aabbMax.x = glm::max(aabbMax.x, vertices[i].x);
-		aabbMax.y = glm::max(aabbMax.y, vertices[i].y);
-		aabbMax.z = glm::max(aabbMax.z, vertices[i].z);
-		
-		aabbMin.x = glm::min(aabbMin.x, vertices[i].x);
-		aabbMin.y = glm::min(aabbMin.y, vertices[i].y);
-		aabbMin.z = glm::min(aabbMin.z, vertices[i].z);
+	vector<SceneCacheMesh>& vectorMesh = m_sceneCache.refVectorMesh();
+	vectorMesh.resize(m_vectorMeshTask.size());
+
+	// Each task writes only its own element in vectorMesh, the node building below follows the task order so the
+	// resulting nodes (names, order and index offsets) don't depend on the number of worker threads
+	ParallelUtil::parallelFor(uint(m_vectorMeshTask.size()), [&](uint index)
+	{
+		const ModelMeshTask& task  = m_vectorMeshTask[index];
+		SceneCacheMesh& cacheMesh  = vectorMesh[index];
+		cacheMesh.m_nodeName       = task.m_nodeName;
+		cacheMesh.m_materialName   = vectorMaterialName[task.m_mesh->mMaterialIndex];
+		processMesh(task.m_mesh, task.m_transform, cacheMesh);
+	});
+
+	//BufferVerificationHelper::verifyParallelTransformPointArray(MathUtil::assimpAIMatrix4x4ToGLM(&m_vectorMeshTask[0].m_transform), vectorMesh[0].m_vertex, ParallelUtil::getNumWorkerThread() * 4);
+
+	// Meshes are decimated for the merged geometry node concurrently, each one with its own MeshSimplifier instance
+	vector<ModelMeshDecimation> vectorDecimation(vectorMesh.size());
+	if (m_makeMergedGeometryNode)
+	{
+		auto startTime = chrono::high_resolution_clock::now();
+
+		ParallelUtil::parallelFor(uint(vectorMesh.size()), [&](uint index)
+		{
+			decimateMesh(vectorMesh[index], vectorDecimation[index]);
+		});
+
+		uint numMeshDecimated  = 0;
+		uint numTriangleInput  = 0;
+		uint numTriangleOutput = 0;
+		float accumulatedTime  = 0.0f;
+		forIT(vectorDecimation)
+		{
+			if (it->m_decimated)
+			{
+				numMeshDecimated++;
+				numTriangleInput  += it->m_numTriangleInput;
+				numTriangleOutput += uint(it->m_index.size()) / 3;
+			}
+			accumulatedTime += it->m_elapsedTime;
+		}
+
+		cout << "Decimated " << numMeshDecimated << " meshes from " << numTriangleInput << " to " << numTriangleOutput << " triangles in " << chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count() << "ms (" << accumulatedTime << "ms accumulated)" << endl;
+
+		//BufferVerificationHelper::benchmarkMeshDecimation(vectorMesh, { 0.0001f, 0.001f, decimationErrorBudgetFactor, 0.1f });
+	}
+
+	forI(vectorMesh.size())
+	{
+		const SceneCacheMesh& mesh = vectorMesh[i];
+		Node* temp = buildNode(mesh.m_index, mesh.m_vertex, mesh.m_texCoord, mesh.m_normal, mesh.m_tangent, mesh.m_materialName, &vectorDecimation[i]);
+		if (temp != nullptr)
+		{
+			m_vecMesh.push_back(temp);
+		}
 	}
 
+	m_vectorMeshTask.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+Node* Model::buildNode(vectorUint indices, vectorVec3 vertices, const vectorVec2& texCoord, const vectorVec3& normals, const vectorVec3& tangents, const string& materialName, const ModelMeshDecimation* decimation)
+{
 	string name = to_string(m_modelCounter);
 	m_modelCounter++;
 
-	aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
-	aiString materialName;
-	material->Get(AI_MATKEY_NAME, materialName);
-	Material* materialInstance = materialM->getElement(move(string(materialName.C_Str())));
-	Material* materialInstanceInstanced = materialM->getElement(move(string(materialName.C_Str()) + "Instanced"));
+	Material* materialInstance = materialM->getElement(move(string(materialName)));
+	Material* materialInstanceInstanced = materialM->getElement(move(string(materialName) + "Instanced"));
 
 	if (materialInstance == nullptr)
 	{
-		cout << "ERROR: material " << materialName.C_Str() << " not found for model " << name << ", using DefaultMaterial" << endl;
+		cout << "ERROR: material " << materialName << " not found for model " << name << ", using DefaultMaterial" << endl;
 		materialInstance = materialM->getElement(move(string("DefaultMaterial")));
 	}
 
 	if (materialInstanceInstanced == nullptr)
 	{
-		cout << "ERROR: material " << materialName.C_Str() << "Instanced not found for model " << name << ", using DefaultMaterialInstanced" << endl;
+		cout << "ERROR: material " << materialName << "Instanced not found for model " << name << ", using DefaultMaterialInstanced" << endl;
 		materialInstanceInstanced = materialM->getElement(move(string("DefaultMaterialInstanced")));
 	}
 
@@ -685,11 +879,14 @@ Node *Model::processMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4 &
 	else
 	{
 		sceneNode = new Node(move(name), move(string("Node")), indices, vertices, texCoord, normals, tangents);
+		sceneNode->buildMeshlet(MESHLET_MAX_TRIANGLE);
 	}
 
-	if (m_makeMergedGeometryNode)
+	// When loading from the scene cache, the merged geometry node information is already available
+	if (m_makeMergedGeometryNode && !m_loadedFromSceneCache)
 	{
-		addMergedGeometryNodeInformation(indices, vertices, texCoord, normals, tangents, aabbMin, aabbMax, nodeName);
+		// Emitter geometry has been replaced by a two sided plane, the decimation of the original mesh doesn't apply
+		addMergedGeometryNodeInformation(indices, vertices, texCoord, normals, tangents, isEmitter ? nullptr : decimation);
 	}
 
 	// NOTE: Remove the call to computeBB() if the results are the same as in aabbMin and aabbMax
@@ -720,6 +917,7 @@ Node* Model::getCompactedGeometryNode(string&& nodeName)
 			vec3 temp = m_mergedVertex[m_mergedIndex[i]];
 		}
 		mergedGeometryNode = new Node(move(nodeName), move(string("Node")), m_mergedIndex, m_mergedVertex, m_mergedTexCoord, m_mergedNormal, m_mergedTangent);
+		mergedGeometryNode->buildMeshlet(MESHLET_MAX_TRIANGLE);
 		mergedGeometryNode->initialize(vec3(0.0f), quat(vec3(0.0f)), vec3(1.0f), materialM->getElement(move(string("DefaultMaterial"))), materialM->getElement(move(string("DefaultMaterialInstanced"))), E_MT_RENDER_SHADOW);
 	}
 
@@ -728,43 +926,6 @@ Node* Model::getCompactedGeometryNode(string&& nodeName)
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-void Model::prepareDecimationData(const vectorUint& vectorIndex, const vectorVec3& vectorVertex)
-{
-	Simplify::triangles.clear();
-	Simplify::vertices.clear();
-	Simplify::refs.clear();
-	Simplify::mtllib = "";
-	Simplify::materials.clear();
-
-	uint numIndex  = static_cast<uint>(vectorIndex.size());
-	uint numVertex = static_cast<uint>(vectorVertex.size());
-
-	Simplify::triangles.resize(numIndex / 3);
-	Simplify::vertices.resize(numVertex);
-
-	Simplify::Vertex v;
-	Simplify::Triangle t;
-
-	forI(vectorVertex.size())
-	{
-		v.p.x                 = vectorVertex[i].x;
-		v.p.y                 = vectorVertex[i].y;
-		v.p.z                 = vectorVertex[i].z;
-		Simplify::vertices[i] = v;
-	}
-
-	forI(numIndex / 3)
-	{
-		t.v[0]                 = vectorIndex[3 * i + 0];
-		t.v[1]                 = vectorIndex[3 * i + 1];
-		t.v[2]                 = vectorIndex[3 * i + 2];
-		t.material             = -1;
-		Simplify::triangles[i] = t;
-	}
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////
-
 void Model::addMergedGeometry(const vectorUint& vectorIndex,
 						      const vectorVec3& vectorVertex,
 						      const vectorVec2& vectorTexCoord,
@@ -0,0 +1,381 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <experimental/filesystem>
+#include <sstream>
+
+// PROJECT INCLUDES
+#include "../../include/model/scenecache.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+namespace fs = std::experimental::filesystem;
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+SceneCache::SceneCache()
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneCache::computeKey(const string& filePath, uint importFlags, const vectorString& vectorExtra, uint64_t& key)
+{
+	ifstream file(filePath, ios::binary | ios::ate);
+
+	if (!file.is_open())
+	{
+		cout << "ERROR in SceneCache::computeKey, unable to open file " << filePath << endl;
+		return false;
+	}
+
+	vectorUint8 vectorData(size_t(file.tellg()));
+	file.seekg(0, ios::beg);
+	file.read(reinterpret_cast<char*>(vectorData.data()), vectorData.size());
+
+	uint version = SCENE_CACHE_VERSION;
+
+	key = hashFNV1a(vectorData.data(), vectorData.size(), FNV1A_OFFSET_BASIS);
+	key = hashFNV1a(&importFlags, sizeof(uint), key);
+	key = hashFNV1a(&version, sizeof(uint), key);
+
+	forI(vectorExtra.size())
+	{
+		key = hashFNV1a(vectorExtra[i].data(), vectorExtra[i].size(), key);
+	}
+
+	// Missing dependencies are hashed as well, so the cache becomes obsolete when they appear
+	vectorString vectorDependency;
+	collectDependency(filePath, vectorData, vectorDependency);
+
+	forIT(vectorDependency)
+	{
+		error_code errorCode;
+		uint64_t size      = uint64_t(fs::file_size(*it, errorCode));
+		size               = errorCode ? UINT64_MAX : size;
+		int64_t writeTime  = int64_t(fs::last_write_time(*it, errorCode).time_since_epoch().count());
+		writeTime          = errorCode ? 0 : writeTime;
+
+		key = hashFNV1a(it->data(), it->size(), key);
+		key = hashFNV1a(&size,      sizeof(uint64_t), key);
+		key = hashFNV1a(&writeTime, sizeof(int64_t),  key);
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneCache::collectDependency(const string& filePath, const vectorUint8& vectorData, vectorString& vectorDependency)
+{
+	vectorDependency.clear();
+
+	fs::path scenePath = fs::path(filePath);
+	string extension   = scenePath.extension().string();
+	transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+	if (extension != ".obj")
+	{
+		return;
+	}
+
+	string directory = scenePath.parent_path().string();
+	directory        = directory.empty() ? directory : (directory + "/");
+
+	// Returns the rest of the line after the keyword given as parameter, empty if the line doesn't start with it
+	auto lineArgument = [](const string& line, const string& keyword) -> string
+	{
+		size_t first = line.find_first_not_of(" \t");
+		if ((first == string::npos) || (line.compare(first, keyword.size(), keyword) != 0) || ((first + keyword.size()) >= line.size()) || !isspace(uint8_t(line[first + keyword.size()])))
+		{
+			return string();
+		}
+
+		size_t start = line.find_first_not_of(" \t", first + keyword.size());
+		size_t end   = line.find_last_not_of(" \t\r");
+		return (start == string::npos) ? string() : line.substr(start, end - start + 1);
+	};
+
+	vectorString vectorLibrary;
+	istringstream sceneStream(string(reinterpret_cast<const char*>(vectorData.data()), vectorData.size()));
+	string line;
+
+	while (getline(sceneStream, line))
+	{
+		string library = lineArgument(line, "mtllib");
+		if (!library.empty())
+		{
+			vectorLibrary.push_back(directory + library);
+		}
+	}
+
+	const vectorString vectorMapKeyword = { "map_Ka", "map_Kd", "map_Ks", "map_Ns", "map_d", "map_bump", "bump", "norm", "disp" };
+
+	forIT(vectorLibrary)
+	{
+		vectorDependency.push_back(*it);
+
+		ifstream libraryFile(*it);
+		while (getline(libraryFile, line))
+		{
+			forJ(vectorMapKeyword.size())
+			{
+				// Texture options (-bm, -o, etc) precede the file name, which is the last token of the line
+				string argument = lineArgument(line, vectorMapKeyword[j]);
+				if (!argument.empty())
+				{
+					size_t separator = argument.find_last_of(" \t");
+					vectorDependency.push_back(directory + ((separator == string::npos) ? argument : argument.substr(separator + 1)));
+					break;
+				}
+			}
+		}
+	}
+
+	sort(vectorDependency.begin(), vectorDependency.end());
+	vectorDependency.erase(unique(vectorDependency.begin(), vectorDependency.end()), vectorDependency.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneCache::load(const string& cachePath, uint64_t key)
+{
+	clear();
+
+	ifstream file(cachePath, ios::binary | ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	// Single read of the whole file, all the data is parsed in place afterwards
+	vectorUint8 vectorData(size_t(file.tellg()));
+	file.seekg(0, ios::beg);
+	file.read(reinterpret_cast<char*>(vectorData.data()), vectorData.size());
+
+	size_t offset = 0;
+	uint magic    = 0;
+	uint version  = 0;
+	uint64_t keyStored = 0;
+
+	if (!readValue(vectorData, offset, magic) || !readValue(vectorData, offset, version) || !readValue(vectorData, offset, keyStored) ||
+		(magic != SCENE_CACHE_MAGIC) || (version != SCENE_CACHE_VERSION) || (keyStored != key))
+	{
+		return false;
+	}
+
+	bool result = true;
+
+	uint numMaterial;
+	result &= readValue(vectorData, offset, numMaterial) && (numMaterial <= (vectorData.size() - offset));
+	m_vectorMaterial.resize(result ? numMaterial : 0);
+
+	forI(m_vectorMaterial.size())
+	{
+		SceneCacheMaterial& material = m_vectorMaterial[i];
+		result &= readString(vectorData, offset, material.m_name);
+		result &= readValue(vectorData, offset, material.m_isEmitter);
+		result &= readString(vectorData, offset, material.m_reflectanceTexture);
+		result &= readString(vectorData, offset, material.m_normalTexture);
+		result &= readValue(vectorData, offset, material.m_surfaceType);
+	}
+
+	uint numCamera;
+	result &= readValue(vectorData, offset, numCamera) && (numCamera <= (vectorData.size() - offset));
+	m_vectorCamera.resize(result ? numCamera : 0);
+
+	forI(m_vectorCamera.size())
+	{
+		SceneCacheCamera& camera = m_vectorCamera[i];
+		result &= readString(vectorData, offset, camera.m_name);
+		result &= readValue(vectorData, offset, camera.m_isEmitter);
+		result &= readValue(vectorData, offset, camera.m_transform);
+		result &= readValue(vectorData, offset, camera.m_up);
+		result &= readValue(vectorData, offset, camera.m_zNear);
+		result &= readValue(vectorData, offset, camera.m_zFar);
+	}
+
+	uint numMesh;
+	result &= readValue(vectorData, offset, numMesh) && (numMesh <= (vectorData.size() - offset));
+	m_vectorMesh.resize(result ? numMesh : 0);
+
+	forI(m_vectorMesh.size())
+	{
+		SceneCacheMesh& mesh = m_vectorMesh[i];
+		result &= readString(vectorData, offset, mesh.m_nodeName);
+		result &= readString(vectorData, offset, mesh.m_materialName);
+		result &= readValue(vectorData, offset, mesh.m_aabbMin);
+		result &= readValue(vectorData, offset, mesh.m_aabbMax);
+		result &= readArray(vectorData, offset, mesh.m_index);
+		result &= readArray(vectorData, offset, mesh.m_vertex);
+		result &= readArray(vectorData, offset, mesh.m_texCoord);
+		result &= readArray(vectorData, offset, mesh.m_normal);
+		result &= readArray(vectorData, offset, mesh.m_tangent);
+	}
+
+	result &= readArray(vectorData, offset, m_mergedIndex);
+	result &= readArray(vectorData, offset, m_mergedVertex);
+	result &= readArray(vectorData, offset, m_mergedTexCoord);
+	result &= readArray(vectorData, offset, m_mergedNormal);
+	result &= readArray(vectorData, offset, m_mergedTangent);
+
+	if (!result)
+	{
+		cout << "ERROR in SceneCache::load, corrupted cache file " << cachePath << endl;
+		clear();
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneCache::save(const string& cachePath, uint64_t key) const
+{
+	vectorUint8 vectorData;
+
+	writeValue(uint(SCENE_CACHE_MAGIC), vectorData);
+	writeValue(uint(SCENE_CACHE_VERSION), vectorData);
+	writeValue(key, vectorData);
+
+	writeValue(uint(m_vectorMaterial.size()), vectorData);
+
+	forI(m_vectorMaterial.size())
+	{
+		const SceneCacheMaterial& material = m_vectorMaterial[i];
+		writeString(material.m_name, vectorData);
+		writeValue(material.m_isEmitter, vectorData);
+		writeString(material.m_reflectanceTexture, vectorData);
+		writeString(material.m_normalTexture, vectorData);
+		writeValue(material.m_surfaceType, vectorData);
+	}
+
+	writeValue(uint(m_vectorCamera.size()), vectorData);
+
+	forI(m_vectorCamera.size())
+	{
+		const SceneCacheCamera& camera = m_vectorCamera[i];
+		writeString(camera.m_name, vectorData);
+		writeValue(camera.m_isEmitter, vectorData);
+		writeValue(camera.m_transform, vectorData);
+		writeValue(camera.m_up, vectorData);
+		writeValue(camera.m_zNear, vectorData);
+		writeValue(camera.m_zFar, vectorData);
+	}
+
+	writeValue(uint(m_vectorMesh.size()), vectorData);
+
+	forI(m_vectorMesh.size())
+	{
+		const SceneCacheMesh& mesh = m_vectorMesh[i];
+		writeString(mesh.m_nodeName, vectorData);
+		writeString(mesh.m_materialName, vectorData);
+		writeValue(mesh.m_aabbMin, vectorData);
+		writeValue(mesh.m_aabbMax, vectorData);
+		writeArray(mesh.m_index, vectorData);
+		writeArray(mesh.m_vertex, vectorData);
+		writeArray(mesh.m_texCoord, vectorData);
+		writeArray(mesh.m_normal, vectorData);
+		writeArray(mesh.m_tangent, vectorData);
+	}
+
+	writeArray(m_mergedIndex, vectorData);
+	writeArray(m_mergedVertex, vectorData);
+	writeArray(m_mergedTexCoord, vectorData);
+	writeArray(m_mergedNormal, vectorData);
+	writeArray(m_mergedTangent, vectorData);
+
+	ofstream file(cachePath, ios::binary | ios::trunc);
+
+	if (!file.is_open())
+	{
+		cout << "ERROR in SceneCache::save, unable to open file " << cachePath << endl;
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(vectorData.data()), vectorData.size());
+
+	return file.good();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneCache::clear()
+{
+	m_vectorMaterial.clear();
+	m_vectorCamera.clear();
+	m_vectorMesh.clear();
+	m_mergedIndex.clear();
+	m_mergedVertex.clear();
+	m_mergedTexCoord.clear();
+	m_mergedNormal.clear();
+	m_mergedTangent.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneCache::writeString(const string& value, vectorUint8& vectorData)
+{
+	writeValue(uint(value.size()), vectorData);
+
+	size_t offset = vectorData.size();
+	vectorData.resize(offset + value.size());
+
+	if (value.size() > 0)
+	{
+		memcpy(&vectorData[offset], value.data(), value.size());
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneCache::readString(const vectorUint8& vectorData, size_t& offset, string& value)
+{
+	uint size;
+	if (!readValue(vectorData, offset, size) || (size > (vectorData.size() - offset)))
+	{
+		return false;
+	}
+
+	value   = string(reinterpret_cast<const char*>(vectorData.data()) + offset, size);
+	offset += size;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t SceneCache::hashFNV1a(const void* data, size_t size, uint64_t hash)
+{
+	const uint8_t* pData = static_cast<const uint8_t*>(data);
+
+	forI(size)
+	{
+		hash ^= uint64_t(pData[i]);
+		hash *= FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,11 +314,10 @@ void Node::bindData()
 
 void Node::prepare(const float &fDt)
 {
-	// update bb if the model matrix changed
-	// TODO: this should be done obtaining the matrix in object space and modifying it insted of all the geometry
+	// update bb if the model matrix changed, refitting the object space bb instead of transforming all the geometry
 	if (m_transform.getDirty())
 	{
-		m_aabb.computeFromVertList(m_vertices, this);
+		m_aabb.computeFromTransformedBox(m_localAABB, getModelMat());
 		m_transform.setDirty(false);
 		if (m_affectSceneBB)
 		{
@@ -346,6 +345,7 @@ bool Node::testPointInside(const vec3 &vP)
 void Node::computeBB()
 {
 	// NOTE: Remove if results are the same as in Model::processMesh
+	m_localAABB.computeFromPointList(m_vertices);
 	m_aabb.computeFromModel(this);
 }
 
@@ -383,4 +383,146 @@ void Node::buildPerVertexInfo()
 	}
 }
 
-/////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void Node::buildMeshlet(uint maxTriangle)
+{
+	m_vectorMeshlet.clear();
+
+	uint numTriangle = uint(m_indices.size()) / 3;
+
+	if ((numTriangle == 0) || (maxTriangle == 0))
+	{
+		return;
+	}
+
+	vec3 aabbMin = vec3( FLT_MAX);
+	vec3 aabbMax = vec3(-FLT_MAX);
+
+	forI(m_vertices.size())
+	{
+		aabbMin = glm::min(aabbMin, m_vertices[i]);
+		aabbMax = glm::max(aabbMax, m_vertices[i]);
+	}
+
+	vec3 extent = glm::max(aabbMax - aabbMin, vec3(FLT_EPSILON));
+
+	// Sort triangles by the Morton code of their centroid (10 bits per axis), so contiguous triangles are spatially close
+	auto expandBits = [](uint value) -> uint
+	{
+		value = (value * 0x00010001u) & 0xFF0000FFu;
+		value = (value * 0x00000101u) & 0x0F00F00Fu;
+		value = (value * 0x00000011u) & 0xC30C30C3u;
+		value = (value * 0x00000005u) & 0x49249249u;
+		return value;
+	};
+
+	vector<pair<uint, uint>> vectorMortonTriangle(numTriangle);
+
+	forI(numTriangle)
+	{
+		vec3 centroid   = (m_vertices[m_indices[3 * i + 0]] + m_vertices[m_indices[3 * i + 1]] + m_vertices[m_indices[3 * i + 2]]) / 3.0f;
+		uvec3 quantized = uvec3(glm::clamp((centroid - aabbMin) / extent, vec3(0.0f), vec3(1.0f)) * 1023.0f);
+
+		vectorMortonTriangle[i] = pair<uint, uint>((expandBits(quantized.x) << 2) | (expandBits(quantized.y) << 1) | expandBits(quantized.z), i);
+	}
+
+	sort(vectorMortonTriangle.begin(), vectorMortonTriangle.end());
+
+	vectorUint vectorIndexSorted(m_indices.size());
+
+	forI(numTriangle)
+	{
+		uint triangle                = vectorMortonTriangle[i].second;
+		vectorIndexSorted[3 * i + 0] = m_indices[3 * triangle + 0];
+		vectorIndexSorted[3 * i + 1] = m_indices[3 * triangle + 1];
+		vectorIndexSorted[3 * i + 2] = m_indices[3 * triangle + 2];
+	}
+
+	m_indices = vectorIndexSorted;
+
+	bool hasNormals = (m_normals.size() == m_vertices.size());
+
+	for (uint firstTriangle = 0; firstTriangle < numTriangle; firstTriangle += maxTriangle)
+	{
+		uint lastTriangle = glm::min(firstTriangle + maxTriangle, numTriangle);
+
+		MeshletData meshlet;
+		meshlet.m_firstIndex = 3 * firstTriangle;
+		meshlet.m_indexCount = 3 * (lastTriangle - firstTriangle);
+		meshlet.m_padding0   = 0;
+		meshlet.m_padding1   = 0;
+
+		vec3 meshletMin = vec3( FLT_MAX);
+		vec3 meshletMax = vec3(-FLT_MAX);
+
+		for (uint i = meshlet.m_firstIndex; i < meshlet.m_firstIndex + meshlet.m_indexCount; ++i)
+		{
+			meshletMin = glm::min(meshletMin, m_vertices[m_indices[i]]);
+			meshletMax = glm::max(meshletMax, m_vertices[m_indices[i]]);
+		}
+
+		vec3 center  = (meshletMin + meshletMax) * 0.5f;
+		float radius = 0.0f;
+
+		for (uint i = meshlet.m_firstIndex; i < meshlet.m_firstIndex + meshlet.m_indexCount; ++i)
+		{
+			radius = glm::max(radius, distance(center, m_vertices[m_indices[i]]));
+		}
+
+		meshlet.m_boundingSphere = vec4(center, radius);
+
+		// Face normals oriented with the per-vertex normals, the cone axis is their average and the cutoff follows
+		// the widest angle between the axis and any of the face normals
+		vectorVec3 vectorFaceNormal;
+		vec3 axis = vec3(0.0f);
+
+		for (uint i = firstTriangle; (i < lastTriangle) && hasNormals; ++i)
+		{
+			uint i0 = m_indices[3 * i + 0];
+			uint i1 = m_indices[3 * i + 1];
+			uint i2 = m_indices[3 * i + 2];
+
+			vec3 faceNormal = cross(m_vertices[i1] - m_vertices[i0], m_vertices[i2] - m_vertices[i0]);
+			float length    = glm::length(faceNormal);
+
+			if (length <= FLT_EPSILON)
+			{
+				continue;
+			}
+
+			faceNormal /= length;
+
+			if (dot(faceNormal, m_normals[i0] + m_normals[i1] + m_normals[i2]) < 0.0f)
+			{
+				faceNormal = -faceNormal;
+			}
+
+			vectorFaceNormal.push_back(faceNormal);
+			axis += faceNormal;
+		}
+
+		meshlet.m_normalCone = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		if ((vectorFaceNormal.size() > 0) && (glm::length(axis) > FLT_EPSILON))
+		{
+			axis            = normalize(axis);
+			float minCosine = 1.0f;
+
+			forI(vectorFaceNormal.size())
+			{
+				minCosine = glm::min(minCosine, dot(axis, vectorFaceNormal[i]));
+			}
+
+			// Cones wider than ~85 degrees are kept with cutoff 1.0, not suitable for backface culling
+			if (minCosine > 0.1f)
+			{
+				meshlet.m_normalCone = vec4(axis, sqrtf(1.0f - minCosine * minCosine));
+			}
+		}
+
+		m_vectorMeshlet.push_back(meshlet);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
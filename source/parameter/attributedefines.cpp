@@ -238,12 +238,6 @@ namespace attributedefines
 	// Distance shadow mapping distance texture name compute shader source code chunk hashed
 	const uint g_distanceShadowMapDistanceTextureCodeChunkHashed = uint(hash<string>()(g_distanceShadowMapDistanceTextureCodeChunk));
 
-	// Distance shadow mapping offscreen texture name compute shader source code chunk
-	const char* g_distanceShadowMapOffscreenTextureCodeChunk = "distanceShadowMapOffscreenTextureCodeChunk";
-
-	// Distance shadow mapping offscreen texture name compute shader source code chunk hashed
-	const uint g_distanceShadowMapOffscreenTextureCodeChunkHashed = uint(hash<string>()(g_distanceShadowMapOffscreenTextureCodeChunk));
-
 	// Distance shadow mapping material name compute shader source code chunk
 	const char* g_distanceShadowMapMaterialNameCodeChunk = "distanceShadowMapMaterialNameCodeChunk";
 
@@ -43,6 +43,7 @@ AntialiasingTechnique::AntialiasingTechnique(string &&name, string&& className)
 {
 	m_isLastPipelineTechnique = true;
 	m_usedCommandBufferNumber = 3;
+	m_outputSizeDependent     = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,7 +91,6 @@ VkCommandBuffer* AntialiasingTechnique::record(int currentImage, uint& commandBu
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -139,3 +139,13 @@ void AntialiasingTechnique::postCommandSubmit()
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+void AntialiasingTechnique::outputResized()
+{
+	MaterialAntialiasing* castedMaterial = static_cast<MaterialAntialiasing*>(m_material);
+	castedMaterial->setTextureSize(vec2(coreM->getWidth(), coreM->getHeight()));
+
+	RasterTechnique::outputResized();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@ limitations under the License.
 #include "../../include/material/materialbufferprefixsum.h"
 #include "../../include/core/coremanager.h"
 #include "../../include/rastertechnique/scenevoxelizationtechnique.h"
+#include "../../include/rastertechnique/lightbouncevoxelirradiancetechnique.h"
 #include "../../include/uniformbuffer/uniformbuffer.h"
 #include "../../include/util/bufferverificationhelper.h"
 
@@ -184,7 +185,6 @@ VkCommandBuffer* BufferPrefixSumTechnique::record(int currentImage, uint& comman
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -275,8 +275,8 @@ void BufferPrefixSumTechnique::postCommandSubmit()
 				// per voxel face (-x,+x,-y,+y,-z,+z), indices (0,1,2,3,4,5) and the 19th element, used to tag main camera visible voxels to
 				// compute light bounce for them
 				// To map to a particular voxel face use 19 * (voxel index) + 3 * (face index) + 0, +1 and +2
-				bufferM->resize(m_lightBounceVoxelIrradianceBuffer,         nullptr, m_firstIndexOccupiedElement * 12 * sizeof(float));
-				bufferM->resize(m_lightBounceVoxelFilteredIrradianceBuffer, nullptr, m_firstIndexOccupiedElement * 12 * sizeof(float));
+				bufferM->resize(m_lightBounceVoxelIrradianceBuffer,         nullptr, m_firstIndexOccupiedElement * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER * sizeof(float));
+				bufferM->resize(m_lightBounceVoxelFilteredIrradianceBuffer, nullptr, m_firstIndexOccupiedElement * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER * sizeof(float));
 				bufferM->resize(m_lightBounceProcessedVoxelBuffer,          nullptr, m_firstIndexOccupiedElement * sizeof(int));
 
 				cout << "Number of occupied voxel is " << m_firstIndexOccupiedElement << endl;
@@ -311,6 +311,7 @@ void BufferPrefixSumTechnique::postCommandSubmit()
 			m_needsToRecord      = false;
 			m_currentStepEnum    = PrefixSumStep::PS_FINISHED;
 			m_prefixSumComplete.emit(); // notify the prefix sum step has been completed
+			destroyCommandBuffers(); // The technique is not executed anymore, release its command buffers (the compute queue is host synchronized)
 
 			vectorUint8 vectorHashedPositionCompactedBuffer;
 			m_voxelHashedPositionCompactedBuffer->getContentCopy(vectorHashedPositionCompactedBuffer);
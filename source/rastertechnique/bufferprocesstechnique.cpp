@@ -79,7 +79,6 @@ VkCommandBuffer* BufferProcessTechnique::record(int currentImage, uint& commandB
 	VkCommandBuffer* commandBuffer;
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
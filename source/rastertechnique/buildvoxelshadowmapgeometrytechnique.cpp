@@ -26,6 +26,9 @@ limitations under the License.
 #include "../../include/rastertechnique/bufferprefixsumtechnique.h"
 #include "../../include/buffer/buffermanager.h"
 #include "../../include/buffer/buffer.h"
+#include "../../include/scene/scene.h"
+#include "../../include/util/loopmacrodefines.h"
+#include "../../include/util/voxelgreedymesher.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -42,6 +45,7 @@ BuildVoxelShadowMapGeometryTechnique::BuildVoxelShadowMapGeometryTechnique(strin
 	, m_shadowMapGeometryVertexBuffer(nullptr)
 	, m_vertexCounterBuffer(nullptr)
 	, m_numUsedVertex(0)
+	, m_greedyMesh(true)
 {
 	m_numElementPerLocalWorkgroupThread = 1;
 	m_numThreadPerLocalWorkgroup        = 64;
@@ -107,7 +111,16 @@ void BuildVoxelShadowMapGeometryTechnique::slotPrefixSumComplete()
 {
 	m_numOccupiedVoxel = m_techniquePrefixSum->getFirstIndexOccupiedElement();
 	m_bufferNumElement = m_numOccupiedVoxel;
-	m_active           = true;
+
+	if (m_greedyMesh)
+	{
+		// The geometry is built in the host and the compute pass is not dispatched
+		buildGreedyMeshGeometry();
+		m_signalBuildVoxelShadowMapGeometryCompletion.emit();
+		return;
+	}
+
+	m_active = true;
 
 	obtainDispatchWorkGroupCount();
 
@@ -122,3 +135,77 @@ void BuildVoxelShadowMapGeometryTechnique::slotPrefixSumComplete()
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+void BuildVoxelShadowMapGeometryTechnique::buildGreedyMeshGeometry()
+{
+	SceneVoxelizationTechnique* technique = static_cast<SceneVoxelizationTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("SceneVoxelizationTechnique"))));
+	uint voxelizationSize                 = uint(technique->getVoxelizedSceneWidth());
+
+	// Same voxelization volume as the one used by MaterialBuildVoxelShadowMapGeometry
+	vec3 sceneMin;
+	vec3 sceneMax;
+	sceneM->refBox().getCenteredBoxMinMax(sceneMin, sceneMax);
+	vec3 voxelSize = (sceneMax - sceneMin) / float(voxelizationSize);
+
+	vectorUint8 vectorHashedPosition;
+	bufferM->getElement(move(string("voxelHashedPositionCompactedBuffer")))->getContentCopy(vectorHashedPosition);
+	const uint* pHashedPosition = (const uint*)(vectorHashedPosition.data());
+	uint numHashedPosition      = glm::min(m_numOccupiedVoxel, uint(vectorHashedPosition.size() / sizeof(uint)));
+
+	vectorUint vectorOccupancy;
+	VoxelGreedyMesher::buildOccupancy(pHashedPosition, numHashedPosition, voxelizationSize, vectorOccupancy);
+
+	vector<VoxelFaceRectangle> vectorRectangle;
+	VoxelGreedyMesher::extractVisibleFace(vectorOccupancy, voxelizationSize, true, vectorRectangle);
+
+	// Two triangles per rectangle, with counter clockwise winding when looking at the face from outside the voxel
+	vectorFloat vectorVertex;
+	vectorVertex.reserve(vectorRectangle.size() * 18);
+
+	auto emitVertex = [&vectorVertex, &sceneMin, &voxelSize](const ivec3& corner)
+	{
+		vec3 position = sceneMin + vec3(corner) * voxelSize;
+		vectorVertex.push_back(position.x);
+		vectorVertex.push_back(position.y);
+		vectorVertex.push_back(position.z);
+	};
+
+	forI(vectorRectangle.size())
+	{
+		const VoxelFaceRectangle& rectangle = vectorRectangle[i];
+
+		ivec3 a = VoxelGreedyMesher::getRectangleCorner(rectangle, 0,                 0);
+		ivec3 b = VoxelGreedyMesher::getRectangleCorner(rectangle, rectangle.m_width, 0);
+		ivec3 c = VoxelGreedyMesher::getRectangleCorner(rectangle, rectangle.m_width, rectangle.m_height);
+		ivec3 e = VoxelGreedyMesher::getRectangleCorner(rectangle, 0,                 rectangle.m_height);
+
+		if ((rectangle.m_face % 2) == 0)
+		{
+			emitVertex(a);
+			emitVertex(b);
+			emitVertex(c);
+			emitVertex(a);
+			emitVertex(c);
+			emitVertex(e);
+		}
+		else
+		{
+			emitVertex(a);
+			emitVertex(c);
+			emitVertex(b);
+			emitVertex(a);
+			emitVertex(e);
+			emitVertex(c);
+		}
+	}
+
+	m_numUsedVertex = uint(vectorVertex.size() / 3);
+
+	if (vectorVertex.size() > 0)
+	{
+		bufferM->resize(m_shadowMapGeometryVertexBuffer, vectorVertex.data(), uint(vectorVertex.size() * sizeof(float)));
+	}
+
+	cout << "Voxel shadow map geometry greedy meshing: " << m_numUsedVertex << " vertices, " << m_numOccupiedVoxel * 36 << " with one cube per occupied voxel" << endl;
+}
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,12 @@ CameraVisibleVoxelTechnique::CameraVisibleVoxelTechnique(string &&name, string&&
 	, m_litClusterProcessResultsTechnique(nullptr)
 	, m_lightBounceOnProgress(false)
 	, m_cameraDirtyWhileComputation(false)
+	, m_forceNextPass(false)
+	, m_lastPassValid(false)
+	, m_lastPassProjection(mat4(1.0f))
+	, m_voxelWorldSize(0.0f)
+	, m_cameraMovementThreshold(0.5f)
+	, m_cameraRotationThreshold(1.0f)
 {
 	m_numElementPerLocalWorkgroupThread = 1;
 	m_numThreadPerLocalWorkgroup        = 64;
@@ -71,6 +77,7 @@ void CameraVisibleVoxelTechnique::init()
 {
 	m_mainCamera    = cameraM->getElement(move(string("maincamera")));
 	m_mainCamera->refCameraDirtySignal().connect<CameraVisibleVoxelTechnique, &CameraVisibleVoxelTechnique::slotCameraDirty>(this);
+	m_mainCamera->refCameraStoppedSignal().connect<CameraVisibleVoxelTechnique, &CameraVisibleVoxelTechnique::slotCameraStopped>(this);
 
 	m_cameraVisibleVoxelBuffer = bufferM->buildBuffer(
 		move(string("cameraVisibleVoxelBuffer")),
@@ -132,9 +139,10 @@ void CameraVisibleVoxelTechnique::init()
 
 	SceneVoxelizationTechnique* technique = static_cast<SceneVoxelizationTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("SceneVoxelizationTechnique"))));
 	materialCasted->setVoxelSize(float(technique->getVoxelizedSceneWidth()));
+	m_voxelWorldSize = glm::max(extent3D.x, glm::max(extent3D.y, extent3D.z)) / float(technique->getVoxelizedSceneWidth());
 
 	LitClusterTechnique* m_LitClusterTechnique = static_cast<LitClusterTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("LitClusterTechnique"))));
-	m_LitClusterTechnique->refSignalLitClusterCompletion().connect<CameraVisibleVoxelTechnique, &CameraVisibleVoxelTechnique::slotCameraDirty>(this);
+	m_LitClusterTechnique->refSignalLitClusterCompletion().connect<CameraVisibleVoxelTechnique, &CameraVisibleVoxelTechnique::slotLitClusterCompleted>(this);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +163,19 @@ void CameraVisibleVoxelTechnique::postCommandSubmit()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void CameraVisibleVoxelTechnique::lightBounceCompleted()
+{
+	m_lightBounceOnProgress = false;
+
+	if (m_cameraDirtyWhileComputation || m_forceNextPass)
+	{
+		m_cameraDirtyWhileComputation = false;
+		slotCameraDirty();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void CameraVisibleVoxelTechnique::slotPrefixSumComplete()
 {
 	m_numOccupiedVoxel = m_bufferPrefixSumTechnique->getFirstIndexOccupiedElement();
@@ -187,12 +208,18 @@ void CameraVisibleVoxelTechnique::slotCameraDirty()
 		m_cameraDirtyWhileComputation = true;
 	}
 
-	if (m_prefixSumCompleted && !m_lightBounceOnProgress)
+	// Small camera changes don't modify the set of camera visible voxels enough to compute it again, the light bounce
+	// results are kept in world space and the displacement is accumulated until it goes above the thresholds or the
+	// camera stops (see slotCameraStopped)
+	if (m_prefixSumCompleted && !m_lightBounceOnProgress && (m_forceNextPass || cameraMovedSinceLastPass()))
 	{
 		MaterialCameraVisibleVoxel* materialCasted = static_cast<MaterialCameraVisibleVoxel*>(m_material);
 		mat4 viewprojectionMatrix                  = m_mainCamera->getProjection() * m_mainCamera->getView();
 		m_cameraPosition                           = m_mainCamera->getPosition();
 		m_cameraForward                            = m_mainCamera->getLookAt();
+		m_lastPassProjection                       = m_mainCamera->getProjection();
+		m_lastPassValid                            = true;
+		m_forceNextPass                            = false;
 
 		materialCasted->setShadowViewProjection(viewprojectionMatrix);
 		materialCasted->setLightPosition(vec4(m_cameraPosition.x, m_cameraPosition.y, m_cameraPosition.z, 0.0f));
@@ -202,7 +229,7 @@ void CameraVisibleVoxelTechnique::slotCameraDirty()
 		m_active                = true;
 	}
 
-	if (!m_lightBounceOnProgress)
+	if (!m_prefixSumCompleted)
 	{
 		cout << "Tried new pass in CameraVisibleVoxelTechnique" << endl;
 	}
@@ -210,6 +237,57 @@ void CameraVisibleVoxelTechnique::slotCameraDirty()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void CameraVisibleVoxelTechnique::slotLitClusterCompleted()
+{
+	m_forceNextPass = true;
+	slotCameraDirty();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void CameraVisibleVoxelTechnique::slotCameraStopped()
+{
+	if (!m_lastPassValid || !cameraChangedSinceLastPass())
+	{
+		return;
+	}
+
+	// If a light bounce computation is in progress, the forced pass is started once it completes
+	m_forceNextPass = true;
+	slotCameraDirty();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraVisibleVoxelTechnique::cameraMovedSinceLastPass()
+{
+	if (!m_lastPassValid || (m_mainCamera->getProjection() != m_lastPassProjection))
+	{
+		return true;
+	}
+
+	vec3 displacement = m_mainCamera->getPosition() - m_cameraPosition;
+	float maxDistance = m_cameraMovementThreshold * m_voxelWorldSize;
+
+	if (glm::dot(displacement, displacement) > (maxDistance * maxDistance))
+	{
+		return true;
+	}
+
+	float cosine = glm::dot(glm::normalize(m_mainCamera->getLookAt()), glm::normalize(m_cameraForward));
+
+	return (cosine < glm::cos(glm::radians(m_cameraRotationThreshold)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CameraVisibleVoxelTechnique::cameraChangedSinceLastPass()
+{
+	return ((m_mainCamera->getPosition() != m_cameraPosition) || (m_mainCamera->getLookAt() != m_cameraForward) || (m_mainCamera->getProjection() != m_lastPassProjection));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void CameraVisibleVoxelTechnique::showVisibleVoxelData()
 {
 	vectorUint8 vectorCameraVisibleVoxelBuffer;
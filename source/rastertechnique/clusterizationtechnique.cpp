@@ -237,7 +237,6 @@ VkCommandBuffer* ClusterizationTechnique::record(int currentImage, uint& command
 	VkCommandBuffer* commandBuffer;
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
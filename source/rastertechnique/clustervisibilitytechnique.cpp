@@ -15,6 +15,7 @@ limitations under the License.
 */
 
 // GLOBAL INCLUDES
+#include <chrono>
 
 // PROJECT INCLUDES
 #include "../../include/rastertechnique/clustervisibilitytechnique.h"
@@ -28,6 +29,8 @@ limitations under the License.
 #include "../../include/rastertechnique/scenevoxelizationtechnique.h"
 #include "../../include/rastertechnique/bufferprefixsumtechnique.h"
 #include "../../include/rastertechnique/clusterizationmergeclustertechnique.h"
+#include "../../include/rastertechnique/clusterizationbuildfinalbuffertechnique.h"
+#include "../../include/rastertechnique/clusterizationinitaabbtechnique.h"
 #include "../../include/material/materialclustervisibility.h"
 #include "../../include/util/bufferverificationhelper.h"
 
@@ -50,6 +53,8 @@ ClusterVisibilityTechnique::ClusterVisibilityTechnique(string &&name, string&& c
 	, m_clusterVisibilityDebugBuffer(nullptr)
 	, m_numOccupiedVoxel(0)
 	, m_prefixSumCompleted(false)
+	, m_cacheKey(0)
+	, m_loadedFromCache(false)
 {
 	m_numElementPerLocalWorkgroupThread = 1;
 	m_numThreadPerLocalWorkgroup        = 128;
@@ -139,7 +144,6 @@ VkCommandBuffer* ClusterVisibilityTechnique::record(int currentImage, uint& comm
 	VkCommandBuffer* commandBuffer;
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -200,14 +204,6 @@ void ClusterVisibilityTechnique::slotPrefixSumComplete()
 	materialCasted->setSceneMinAndNumberVoxel(m_sceneMin);
 	materialCasted->setNumThreadExecuted(m_bufferNumElement);
 
-	bufferM->resize(m_clusterVisibilityBuffer, nullptr, m_bufferNumElement * sizeof(uint));
-
-	// Initialize clusterVisibilityBuffer with maxValue (4294967295) so the cluster with index 0 can be identified
-	vector<uint> vectorData;
-	vectorData.resize(m_bufferNumElement);
-	memset(vectorData.data(), maxValue, vectorData.size() * size_t(sizeof(uint)));
-	m_clusterVisibilityBuffer->setContent(vectorData.data());
-
 	// Make a buffer with six elements per occupied voxel (to store the amount of visible clusters
 	// from each voxel face)
 	bufferM->resize(m_clusterVisibilityNumberBuffer, nullptr, m_numOccupiedVoxel * 6 * sizeof(uint));
@@ -227,9 +223,130 @@ void ClusterVisibilityTechnique::slotClusterMergeComplete()
 {
 	if (m_prefixSumCompleted)
 	{
-		m_vectorCommand.clear();
+		// The clusterization is final at this point, if the cluster visibility for it was already computed and saved
+		// in a previous execution, the buffers are filled from the cache file and the technique is not executed
+		computeCacheKey();
+
+		if (loadVisibilityCache())
+		{
+			// The debug buffer is only written when the technique is executed
+			bufferM->resize(m_clusterVisibilityDebugBuffer, nullptr, 256);
+			m_loadedFromCache = true;
+			m_clusterVisibilityCompletion.emit();
+			return;
+		}
+
+		// clusterVisibilityBuffer is only needed when the technique is executed
+		bufferM->resize(m_clusterVisibilityBuffer, nullptr, m_bufferNumElement * sizeof(uint));
+
+		// Initialize clusterVisibilityBuffer with maxValue (4294967295) so the cluster with index 0 can be identified
+		vector<uint> vectorData;
+		vectorData.resize(m_bufferNumElement);
+		memset(vectorData.data(), maxValue, vectorData.size() * size_t(sizeof(uint)));
+		m_clusterVisibilityBuffer->setContent(vectorData.data());
+
+		clearRecordedCommandBuffer();
 		m_active = true;
 	}
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterVisibilityTechnique::computeCacheKey()
+{
+	ClusterizationBuildFinalBufferTechnique* clusterizationBuildFinalBufferTechnique = static_cast<ClusterizationBuildFinalBufferTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ClusterizationBuildFinalBufferTechnique"))));
+	uint numCluster = clusterizationBuildFinalBufferTechnique->getCompactedClusterNumber();
+
+	vectorUint8 vectorVoxelHashed;
+	bufferM->getElement(move(string("voxelHashedPositionCompactedBuffer")))->getContentCopy(vectorVoxelHashed);
+	vectorVoxelHashed.resize(glm::min(vectorVoxelHashed.size(), size_t(m_numOccupiedVoxel) * sizeof(uint)));
+
+	vectorUint8 vectorClusterData;
+	bufferM->getElement(move(string("clusterizationFinalBuffer")))->getContentCopy(vectorClusterData);
+	vectorClusterData.resize(glm::min(vectorClusterData.size(), size_t(numCluster) * sizeof(ClusterData)));
+
+	m_cachePath = sceneM->getScenePath() + sceneM->getSceneName() + CLUSTER_VISIBILITY_CACHE_EXTENSION;
+	m_cacheKey  = ClusterVisibilityCache::computeKey(vectorVoxelHashed, vectorClusterData, uint(m_sceneExtent.w), m_numThreadPerLocalWorkgroup);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityTechnique::loadVisibilityCache()
+{
+	auto startTime = chrono::high_resolution_clock::now();
+
+	ClusterizationBuildFinalBufferTechnique* clusterizationBuildFinalBufferTechnique = static_cast<ClusterizationBuildFinalBufferTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ClusterizationBuildFinalBufferTechnique"))));
+	uint numCluster = clusterizationBuildFinalBufferTechnique->getCompactedClusterNumber();
+
+	if (!m_visibilityCache.load(m_cachePath, m_cacheKey))
+	{
+		return false;
+	}
+
+	vectorUint vectorNumber;
+	vectorUint vectorFirstIndex;
+	vectorUint vectorCompacted;
+
+	bool result = (m_visibilityCache.getNumOccupiedVoxel() == m_numOccupiedVoxel) && (m_visibilityCache.getNumCluster() == numCluster);
+	result      = result && m_visibilityCache.decode(vectorNumber, vectorFirstIndex, vectorCompacted);
+
+	if (!result)
+	{
+		cout << "ERROR in ClusterVisibilityTechnique::loadVisibilityCache, cache file " << m_cachePath << " not valid, cluster visibility will be computed" << endl;
+		m_visibilityCache.clear();
+		return false;
+	}
+
+	size_t encodedSize = m_visibilityCache.getVectorFaceMask().size() + m_visibilityCache.getVectorDeltaStream().size();
+	m_visibilityCache.clear();
+
+	// At least one element, to avoid zero sized buffers when no cluster is visible from any voxel face
+	if (vectorCompacted.size() == 0)
+	{
+		vectorCompacted.push_back(0);
+	}
+
+	m_clusterVisibilityNumberBuffer->setContent(vectorNumber.data());
+	m_clusterVisibilityFirstIndexBuffer->setContent(vectorFirstIndex.data());
+	bufferM->resize(m_clusterVisibilityCompactedBuffer, vectorCompacted.data(), uint(vectorCompacted.size() * sizeof(uint)));
+
+	cout << "Cluster visibility loaded from " << m_cachePath << " (" << (encodedSize / 1024.0f) / 1024.0f << "MB encoded) in " << chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count() << "ms" << endl;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterVisibilityTechnique::storeVisibilityCache()
+{
+	ClusterizationBuildFinalBufferTechnique* clusterizationBuildFinalBufferTechnique = static_cast<ClusterizationBuildFinalBufferTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ClusterizationBuildFinalBufferTechnique"))));
+	uint numCluster = clusterizationBuildFinalBufferTechnique->getCompactedClusterNumber();
+
+	vectorUint vectorNumber(size_t(m_clusterVisibilityNumberBuffer->getDataSize()) / sizeof(uint));
+	vectorUint vectorFirstIndex(size_t(m_clusterVisibilityFirstIndexBuffer->getDataSize()) / sizeof(uint));
+	vectorUint vectorCompacted(size_t(m_clusterVisibilityCompactedBuffer->getDataSize()) / sizeof(uint));
+
+	m_clusterVisibilityNumberBuffer->getContent(vectorNumber.data());
+	m_clusterVisibilityFirstIndexBuffer->getContent(vectorFirstIndex.data());
+	m_clusterVisibilityCompactedBuffer->getContent(vectorCompacted.data());
+
+	if (m_visibilityCache.encode(vectorNumber, vectorFirstIndex, vectorCompacted, m_numOccupiedVoxel, numCluster))
+	{
+		size_t rawSize     = (vectorNumber.size() + vectorFirstIndex.size() + vectorCompacted.size()) * sizeof(uint);
+		size_t encodedSize = m_visibilityCache.getVectorFaceMask().size() + m_visibilityCache.getVectorDeltaStream().size();
+		cout << "Cluster visibility encoded from " << (rawSize / 1024.0f) / 1024.0f << "MB to " << (encodedSize / 1024.0f) / 1024.0f << "MB" << endl;
+
+		if (!m_visibilityCache.save(m_cachePath, m_cacheKey))
+		{
+			cout << "ERROR in ClusterVisibilityTechnique::storeVisibilityCache, unable to save cache file " << m_cachePath << endl;
+		}
+	}
+
+	m_visibilityCache.clear();
+
+	// The non compacted visibility data is not used anymore
+	bufferM->resize(m_clusterVisibilityBuffer, nullptr, 256);
+	bufferM->resize(m_clusterVisibilityDebugBuffer, nullptr, 256);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
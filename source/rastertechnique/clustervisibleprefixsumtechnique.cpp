@@ -98,7 +98,6 @@ VkCommandBuffer* ClusterVisiblePrefixSumTechnique::record(int currentImage, uint
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -225,6 +224,9 @@ void ClusterVisiblePrefixSumTechnique::postCommandSubmit()
 			// and is present in the prefixSumBuffer buffer
 			bufferM->copyBuffer(prefixSumBuffer, m_clusterVisibilityFirstIndexBuffer, 0, 0, int(m_clusterVisibilityFirstIndexBuffer->getDataSize()));
 
+			// Persist the result so next executions with the same voxelization and clusterization can skip the cluster visibility computation
+			m_clusterVisibilityTechnique->storeVisibilityCache();
+
 			//BufferVerificationHelper::verifyClusterVisibilityFirstIndexBuffer();
 			//BufferVerificationHelper::verifyClusterVisibilityCompactedData();
 
@@ -272,6 +274,15 @@ void ClusterVisiblePrefixSumTechnique::postCommandSubmit()
 
 void ClusterVisiblePrefixSumTechnique::slotClusterVisibility()
 {
+	if (m_clusterVisibilityTechnique->getLoadedFromCache())
+	{
+		// clusterVisibilityCompactedBuffer and clusterVisibilityFirstIndexBuffer were already filled from the cluster visibility cache file
+		m_compactionStepDone = true;
+		m_currentStepEnum    = PrefixSumStep_::PS_FINISHED;
+		m_signalClusterVisiblePrefixSumTechnique.emit();
+		return;
+	}
+
 	m_needsToRecord = true;
 	m_active        = true;
 
@@ -27,6 +27,9 @@ limitations under the License.
 #include "../../include/camera/cameramanager.h"
 #include "../../include/camera/camera.h"
 #include "../../include/util/vulkanstructinitializer.h"
+#include "../../include/texture/texture.h"
+#include "../../include/texture/texturemanager.h"
+#include "../../include/util/mathutil.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -47,10 +50,24 @@ ComputeFrustumCullingTechnique::ComputeFrustumCullingTechnique(string&& name, st
 	, m_frustumElementMainCameraCounter(0)
 	, m_frustumElementEmitterCameraCounter(0)
 	, m_materialComputeFrustumCulling(nullptr)
+	, m_occlusionCulling(false)
+	, m_sceneDepthTexture(nullptr)
+	, m_depthReadbackBuffer(nullptr)
+	, m_depthViewProjection(mat4(1.0f))
+	, m_depthViewProjectionValid(false)
+	, m_occlusionCulledCounter(0)
+	, m_drawnMainCameraCounter(0)
+	, m_compactedGeometryNode(nullptr)
+	, m_compactedGeometryMeshletRange(uvec2(0))
+	, m_meshletBuffer(nullptr)
+	, m_indirectCommandBufferMeshletMainCamera(nullptr)
+	, m_indirectCommandBufferMeshletEmitterCamera(nullptr)
+	, m_meshletCulledMainCameraCounter(0)
+	, m_meshletCulledEmitterCameraCounter(0)
 {
 	m_numElementPerLocalWorkgroupThread = 1;
 	m_numThreadPerLocalWorkgroup = 64;
-	m_rasterTechniqueType = RasterTechniqueType::RTT_COMPUTE;
+	m_rasterTechniqueType = m_occlusionCulling ? RasterTechniqueType::RTT_GRAPHICS : RasterTechniqueType::RTT_COMPUTE;
 	m_computeHostSynchronize = true;
 	m_active = true;
 	m_needsToRecord = true;
@@ -60,16 +77,16 @@ ComputeFrustumCullingTechnique::ComputeFrustumCullingTechnique(string&& name, st
 
 void ComputeFrustumCullingTechnique::init()
 {
-	// TODO: Update instanceDataBuffer data for dynamic elements
-
 	m_arrayNode = sceneM->getByMeshType(E_MT_RENDER_MODEL);
 	uint instanceNumElement = uint(m_arrayNode.size());
 	m_vectorInstanceData.resize(instanceNumElement);
+	m_vectorSceneIndexToInstance.resize(sceneM->getModel().size(), -1);
 
 	forI(m_vectorInstanceData.size())
 	{
 		m_vectorInstanceData[i].m_position = m_arrayNode[i]->getBBox().getCenter();
 		m_vectorInstanceData[i].m_radius = m_arrayNode[i]->getBBox().getMaxDist();
+		m_vectorSceneIndexToInstance[sceneM->getElementIndex(m_arrayNode[i])] = int(i);
 	}
 
 	m_instanceDataBuffer = bufferM->buildBuffer(
@@ -126,6 +143,51 @@ void ComputeFrustumCullingTechnique::init()
 		VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
+	m_compactedGeometryNode = sceneM->refElementByName(move(string("sceneCompactedGeometry")));
+
+	// Meshlets of the compacted geometry (drawn for shadow mapping) and of each scene element are culled individually
+	m_compactedGeometryMeshletRange = (m_compactedGeometryNode != nullptr) ? addNodeMeshlet(m_compactedGeometryNode, 0, m_vectorMeshlet) : uvec2(0);
+
+	m_vectorNodeMeshletRange.resize(m_arrayNode.size());
+
+	forI(m_arrayNode.size())
+	{
+		m_vectorNodeMeshletRange[i] = addNodeMeshlet(m_arrayNode[i], uint(i), m_vectorMeshlet);
+	}
+
+	if (m_vectorMeshlet.size() > 0)
+	{
+		m_meshletBuffer = bufferM->buildBuffer(
+			move(string("meshletBuffer")),
+			(void*)(m_vectorMeshlet.data()),
+			m_vectorMeshlet.size() * sizeof(MeshletData),
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+		m_indirectCommandBufferMeshletMainCamera = bufferM->buildBuffer(
+			move(string("indirectCommandBufferMeshletMainCamera")),
+			(void*)(m_arrayMeshletIndirectCommandMainCamera.data()),
+			sizeof(VkDrawIndexedIndirectCommand) * m_arrayMeshletIndirectCommandMainCamera.size(),
+			VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+		m_indirectCommandBufferMeshletEmitterCamera = bufferM->buildBuffer(
+			move(string("indirectCommandBufferMeshletEmitterCamera")),
+			(void*)(m_arrayMeshletIndirectCommandEmitterCamera.data()),
+			sizeof(VkDrawIndexedIndirectCommand) * m_arrayMeshletIndirectCommandEmitterCamera.size(),
+			VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	}
+
+	m_sceneDepthTexture = textureM->getElement(move(string("scenelightingdepth")));
+
+	m_depthReadbackBuffer = bufferM->buildBuffer(
+		move(string("depthReadbackBuffer")),
+		nullptr,
+		m_sceneDepthTexture->getWidth() * m_sceneDepthTexture->getHeight() * sizeof(uint),
+		VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
 	// Assuming each thread will take care of a whole row / column
 	buildShaderThreadMapping();
 
@@ -163,12 +225,136 @@ void ComputeFrustumCullingTechnique::recordBarriers(VkCommandBuffer* commandBuff
 		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
 		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
 		commandBuffer);
+
+	if (!m_occlusionCulling)
+	{
+		return;
+	}
+
+	// Copy the previous frame scene depth, used to build the depth pyramid for the occlusion test once the command buffer has been executed.
+	// The command buffer is submitted to the graphics queue when occlusion culling is enabled, where the scene depth is rendered
+	VkImageAspectFlags aspectFlags = VK_IMAGE_ASPECT_DEPTH_BIT;
+	if ((m_sceneDepthTexture->getFormat() == VK_FORMAT_D24_UNORM_S8_UINT) || (m_sceneDepthTexture->getFormat() == VK_FORMAT_D32_SFLOAT_S8_UINT))
+	{
+		aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+	}
+
+	VulkanStructInitializer::insertImageMemoryBarrierCommand(m_sceneDepthTexture,
+		VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+		VK_ACCESS_TRANSFER_READ_BIT,
+		aspectFlags,
+		0,
+		commandBuffer);
+
+	VkBufferImageCopy bufferImageCopy{};
+	bufferImageCopy.imageSubresource = { VK_IMAGE_ASPECT_DEPTH_BIT, 0, 0, 1 };
+	bufferImageCopy.imageExtent      = { m_sceneDepthTexture->getWidth(), m_sceneDepthTexture->getHeight(), 1 };
+	vkCmdCopyImageToBuffer(*commandBuffer, m_sceneDepthTexture->getImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_depthReadbackBuffer->getBuffer(), 1, &bufferImageCopy);
+
+	VulkanStructInitializer::insertImageMemoryBarrierCommand(m_sceneDepthTexture,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+		VK_ACCESS_TRANSFER_READ_BIT,
+		VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+		aspectFlags,
+		0,
+		commandBuffer);
+
+	VulkanStructInitializer::insertBufferMemoryBarrier(m_depthReadbackBuffer,
+		VK_ACCESS_TRANSFER_WRITE_BIT,
+		VK_ACCESS_HOST_READ_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_HOST_BIT,
+		commandBuffer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+VkCommandBuffer* ComputeFrustumCullingTechnique::record(int currentImage, uint& commandBufferID, CommandBufferType& commandBufferType)
+{
+	commandBufferType = m_occlusionCulling ? CommandBufferType::CBT_GRAPHICS_QUEUE : CommandBufferType::CBT_COMPUTE_QUEUE;
+
+	VkCommandBuffer* commandBuffer;
+	addCommandBufferQueueType(commandBufferID, commandBufferType);
+	commandBuffer = addRecordedCommandBuffer(commandBufferID);
+
+	coreM->beginCommandBuffer(*commandBuffer);
+
+#ifdef USE_TIMESTAMP
+	vkCmdWriteTimestamp(*commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, m_occlusionCulling ? coreM->getGraphicsQueueQueryPool() : coreM->getComputeQueueQueryPool(), m_queryIndex0);
+#endif
+
+	recordBarriers(commandBuffer);
+
+	uint dynamicAllignment = materialM->getMaterialUBDynamicAllignment();
+
+	uint32_t offsetData;
+	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_material->getPipeline()->getPipeline());
+	offsetData = static_cast<uint32_t>(m_material->getMaterialUniformBufferIndex() * dynamicAllignment);
+	vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_material->getPipelineLayout(), 0, 1, &m_material->refDescriptorSet(), 1, &offsetData);
+	vkCmdDispatch(*commandBuffer, m_localWorkGroupsXDimension, m_localWorkGroupsYDimension, 1); // Compute shader global workgroup https://www.khronos.org/registry/vulkan/specs/1.1-extensions/html/vkspec.html
+
+#ifdef USE_TIMESTAMP
+	vkCmdWriteTimestamp(*commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, m_occlusionCulling ? coreM->getGraphicsQueueQueryPool() : coreM->getComputeQueueQueryPool(), m_queryIndex1);
+#endif
+
+	coreM->endCommandBuffer(*commandBuffer);
+
+	m_vectorCommand.push_back(commandBuffer);
+
+	return commandBuffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ComputeFrustumCullingTechnique::setOcclusionCulling(bool occlusionCulling)
+{
+	if (m_occlusionCulling == occlusionCulling)
+	{
+		return;
+	}
+
+	// Command buffers are allocated from the pool of the queue they are submitted to, destroy them before changing queue
+	destroyCommandBuffers();
+
+	m_occlusionCulling         = occlusionCulling;
+	m_rasterTechniqueType      = m_occlusionCulling ? RasterTechniqueType::RTT_GRAPHICS : RasterTechniqueType::RTT_COMPUTE;
+	m_depthViewProjectionValid = false;
+	m_occlusionCulledCounter   = 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 void ComputeFrustumCullingTechnique::prepare(float dt)
 {
+	// Only the elements whose bounding box was refitted in the last scene update need their instance data updated
+	const vectorUint& vectorRefitElementIndex = sceneM->getVectorRefitElementIndex();
+	bool instanceDataChanged                  = false;
+
+	forI(vectorRefitElementIndex.size())
+	{
+		uint sceneIndex = vectorRefitElementIndex[i];
+		if ((sceneIndex < uint(m_vectorSceneIndexToInstance.size())) && (m_vectorSceneIndexToInstance[sceneIndex] != -1))
+		{
+			const BBox3D& box = sceneM->getModel()[sceneIndex]->getBBox();
+			InstanceData& instanceData = m_vectorInstanceData[m_vectorSceneIndexToInstance[sceneIndex]];
+			instanceData.m_position = box.getCenter();
+			instanceData.m_radius = box.getMaxDist();
+			instanceDataChanged = true;
+		}
+	}
+
+	if (instanceDataChanged)
+	{
+		m_instanceDataBuffer->setContent((void*)(m_vectorInstanceData.data()));
+	}
+
 	m_materialComputeFrustumCulling = static_cast<MaterialComputeFrustumCulling*>(m_vectorMaterial[0]);
 
 	const vec4* frustumPlanesMainCamera = cameraM->getElement(move(string("maincamera")))->getArrayFrustumPlane();
@@ -204,6 +390,32 @@ void ComputeFrustumCullingTechnique::postCommandSubmit()
 	m_frustumElementCounterMainCameraBuffer->getContent((void*)(&m_frustumElementMainCameraCounter));
 	m_frustumElementCounterEmitterCameraBuffer->getContent((void*)(&m_frustumElementEmitterCameraCounter));
 	//cout << "Frustum test main camera: " << m_frustumElementMainCameraCounter << ", frustum test for emitter camera " << m_frustumElementEmitterCameraCounter << endl;
+
+	// The depth pyramid is built from the previous frame depth, only valid for the occlusion test if the main camera didn't change since then
+	const mat4& viewProjection = cameraM->getElement(move(string("maincamera")))->getViewProjection();
+	m_occlusionCulledCounter   = 0;
+	m_drawnMainCameraCounter   = m_frustumElementMainCameraCounter;
+
+	if (m_occlusionCulling && m_depthViewProjectionValid && (viewProjection == m_depthViewProjection))
+	{
+		buildDepthPyramid();
+		applyOcclusionCulling();
+	}
+
+	m_depthViewProjection      = viewProjection;
+	m_depthViewProjectionValid = m_occlusionCulling;
+
+	if (m_meshletBuffer != nullptr)
+	{
+		const Camera* emitterCamera = cameraM->getElement(move(string("emitter")));
+		cullMeshlet(cameraM->getElement(move(string("maincamera"))), &m_arrayMeshletMainCameraFrustumPlane[0], m_arrayMeshletIndirectCommandMainCamera, m_indirectCommandBufferMeshletMainCamera, m_meshletCulledMainCameraCounter);
+
+		if (emitterCamera != nullptr)
+		{
+			cullMeshlet(emitterCamera, &m_arrayMeshletEmitterCameraFrustumPlane[0], m_arrayMeshletIndirectCommandEmitterCamera, m_indirectCommandBufferMeshletEmitterCamera, m_meshletCulledEmitterCameraCounter);
+		}
+	}
+
 	m_frustumElementMainCameraCounter = 0;
 	m_frustumElementEmitterCameraCounter = 0;
 	m_frustumElementCounterMainCameraBuffer->setContent((void*)(&m_frustumElementMainCameraCounter));
@@ -211,3 +423,263 @@ void ComputeFrustumCullingTechnique::postCommandSubmit()
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+void ComputeFrustumCullingTechnique::outputResized()
+{
+	bufferM->resize(m_depthReadbackBuffer, nullptr, m_sceneDepthTexture->getWidth() * m_sceneDepthTexture->getHeight() * sizeof(uint));
+
+	m_vectorDepthPyramid.clear();
+	m_vectorDepthPyramidSize.clear();
+	m_depthViewProjectionValid = false;
+
+	clearRecordedCommandBuffer();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ComputeFrustumCullingTechnique::buildDepthPyramid()
+{
+	uint width  = m_sceneDepthTexture->getWidth();
+	uint height = m_sceneDepthTexture->getHeight();
+
+	m_depthReadbackBuffer->getContentCopy(m_vectorDepthReadback);
+
+	if (m_vectorDepthPyramid.size() == 0)
+	{
+		uvec2 levelSize = uvec2(width, height);
+		m_vectorDepthPyramidSize.push_back(levelSize);
+		while ((levelSize.x > 1) || (levelSize.y > 1))
+		{
+			levelSize = glm::max(levelSize / 2u, uvec2(1));
+			m_vectorDepthPyramidSize.push_back(levelSize);
+		}
+
+		m_vectorDepthPyramid.resize(m_vectorDepthPyramidSize.size());
+		forI(m_vectorDepthPyramid.size())
+		{
+			m_vectorDepthPyramid[i].resize(m_vectorDepthPyramidSize[i].x * m_vectorDepthPyramidSize[i].y);
+		}
+	}
+
+	// Level 0 stores the normalized depth of each pixel, for formats with a 24 bits depth aspect each value is copied in 32 bits
+	vectorFloat& levelZero = m_vectorDepthPyramid[0];
+	const uint numTexel    = width * height;
+
+	switch (m_sceneDepthTexture->getFormat())
+	{
+		case VK_FORMAT_D16_UNORM:
+		case VK_FORMAT_D16_UNORM_S8_UINT:
+		{
+			const uint16_t* pData = reinterpret_cast<const uint16_t*>(m_vectorDepthReadback.data());
+			forI(numTexel)
+			{
+				levelZero[i] = float(pData[i]) / 65535.0f;
+			}
+			break;
+		}
+		case VK_FORMAT_D32_SFLOAT:
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+		{
+			memcpy(levelZero.data(), m_vectorDepthReadback.data(), numTexel * sizeof(float));
+			break;
+		}
+		default:
+		{
+			const uint* pData = reinterpret_cast<const uint*>(m_vectorDepthReadback.data());
+			forI(numTexel)
+			{
+				levelZero[i] = float(pData[i] & 0x00FFFFFF) / 16777215.0f;
+			}
+			break;
+		}
+	}
+
+	for (uint level = 1; level < uint(m_vectorDepthPyramid.size()); ++level)
+	{
+		const vectorFloat& previous = m_vectorDepthPyramid[level - 1];
+		vectorFloat& current        = m_vectorDepthPyramid[level];
+		uvec2 previousSize          = m_vectorDepthPyramidSize[level - 1];
+		uvec2 currentSize           = m_vectorDepthPyramidSize[level];
+
+		for (uint y = 0; y < currentSize.y; ++y)
+		{
+			// For odd sizes, the last texel of each row / column also covers the one left out
+			uint y0 = glm::min(2 * y, previousSize.y - 1);
+			uint y1 = (y == currentSize.y - 1) ? previousSize.y - 1 : 2 * y + 1;
+
+			for (uint x = 0; x < currentSize.x; ++x)
+			{
+				uint x0        = glm::min(2 * x, previousSize.x - 1);
+				uint x1        = (x == currentSize.x - 1) ? previousSize.x - 1 : 2 * x + 1;
+				float maxDepth = 0.0f;
+
+				for (uint j = y0; j <= y1; ++j)
+				{
+					for (uint k = x0; k <= x1; ++k)
+					{
+						maxDepth = glm::max(maxDepth, previous[j * previousSize.x + k]);
+					}
+				}
+
+				current[y * currentSize.x + x] = maxDepth;
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ComputeFrustumCullingTechnique::isOccluded(const mat4& viewProjection, const vec3& aabbMin, const vec3& aabbMax)
+{
+	vec2 ndcMin    = vec2( FLT_MAX);
+	vec2 ndcMax    = vec2(-FLT_MAX);
+	float minDepth = FLT_MAX;
+
+	forI(8)
+	{
+		vec3 corner = vec3((i & 1) ? aabbMax.x : aabbMin.x, (i & 2) ? aabbMax.y : aabbMin.y, (i & 4) ? aabbMax.z : aabbMin.z);
+		vec4 clip   = viewProjection * vec4(corner, 1.0f);
+
+		// Bounding boxes crossing the camera near plane are considered visible
+		if (clip.w <= 0.0f)
+		{
+			return false;
+		}
+
+		vec3 ndc = vec3(clip) / clip.w;
+		ndcMin   = glm::min(ndcMin, vec2(ndc));
+		ndcMax   = glm::max(ndcMax, vec2(ndc));
+		minDepth = glm::min(minDepth, ndc.z);
+	}
+
+	if (minDepth <= 0.0f)
+	{
+		return false;
+	}
+
+	vec2 size       = vec2(m_vectorDepthPyramidSize[0]);
+	vec2 screenMin  = glm::clamp((ndcMin * 0.5f + 0.5f) * size, vec2(0.0f), size - 1.0f);
+	vec2 screenMax  = glm::clamp((ndcMax * 0.5f + 0.5f) * size, vec2(0.0f), size - 1.0f);
+	vec2 screenSize = screenMax - screenMin;
+
+	// Choose the level where the projected bounding box covers at most 2x2 texels
+	uint level = uint(glm::ceil(glm::log2(glm::max(glm::max(screenSize.x, screenSize.y), 1.0f))));
+	level      = glm::min(level, uint(m_vectorDepthPyramid.size()) - 1);
+
+	const vectorFloat& depthLevel = m_vectorDepthPyramid[level];
+	uvec2 levelSize               = m_vectorDepthPyramidSize[level];
+	uvec2 texelMin                = glm::min(uvec2(screenMin) >> level, levelSize - 1u);
+	uvec2 texelMax                = glm::min(uvec2(screenMax) >> level, levelSize - 1u);
+
+	for (uint y = texelMin.y; y <= texelMax.y; ++y)
+	{
+		for (uint x = texelMin.x; x <= texelMax.x; ++x)
+		{
+			if (minDepth <= depthLevel[y * levelSize.x + x])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ComputeFrustumCullingTechnique::applyOcclusionCulling()
+{
+	// Same bounding sphere test done in the frustum culling shader, to only consider the elements drawn for the main camera
+	const vec4* arrayFrustumPlane = cameraM->getElement(move(string("maincamera")))->getArrayFrustumPlane();
+	const uint instanceCount      = 0;
+
+	forI(m_arrayNode.size())
+	{
+		if (MathUtil::sphereIntersectsFrustum(arrayFrustumPlane, m_vectorInstanceData[i].m_position, m_vectorInstanceData[i].m_radius) &&
+			isOccluded(m_depthViewProjection, m_arrayNode[i]->getBBox().getMin(), m_arrayNode[i]->getBBox().getMax()))
+		{
+			m_indirectCommandBufferMainCamera->setContentRange((void*)(&instanceCount), i * sizeof(VkDrawIndexedIndirectCommand) + offsetof(VkDrawIndexedIndirectCommand, instanceCount), sizeof(uint));
+			m_occlusionCulledCounter++;
+		}
+	}
+
+	m_drawnMainCameraCounter = (m_frustumElementMainCameraCounter > m_occlusionCulledCounter) ? (m_frustumElementMainCameraCounter - m_occlusionCulledCounter) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uvec2 ComputeFrustumCullingTechnique::addNodeMeshlet(Node* node, uint firstInstance, vectorMeshletData& vectorMeshlet)
+{
+	const vectorMeshletData& vectorNodeMeshlet = node->getVectorMeshlet();
+	uvec2 result                               = uvec2(uint(vectorMeshlet.size()), uint(vectorNodeMeshlet.size()));
+
+	VkDrawIndexedIndirectCommand indirectCommand;
+	indirectCommand.instanceCount = 1;
+	indirectCommand.firstInstance = firstInstance;
+	indirectCommand.vertexOffset  = 0;
+
+	forI(vectorNodeMeshlet.size())
+	{
+		indirectCommand.firstIndex = node->getStartIndex() + vectorNodeMeshlet[i].m_firstIndex;
+		indirectCommand.indexCount = vectorNodeMeshlet[i].m_indexCount;
+
+		vectorMeshlet.push_back(vectorNodeMeshlet[i]);
+		m_arrayMeshletIndirectCommandMainCamera.push_back(indirectCommand);
+		m_arrayMeshletIndirectCommandEmitterCamera.push_back(indirectCommand);
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ComputeFrustumCullingTechnique::cullMeshlet(const Camera* camera, vec4* arrayLastFrustumPlane, vector<VkDrawIndexedIndirectCommand>& vectorIndirectCommand, Buffer* indirectCommandBuffer, uint& numCulled)
+{
+	const vec4* arrayFrustumPlane = camera->getArrayFrustumPlane();
+
+	// The meshlet visibility can only change if the camera did
+	if (memcmp(arrayFrustumPlane, arrayLastFrustumPlane, 6 * sizeof(vec4)) == 0)
+	{
+		return;
+	}
+
+	memcpy(arrayLastFrustumPlane, arrayFrustumPlane, 6 * sizeof(vec4));
+
+	vec3 cameraPosition = camera->getPosition();
+	uint firstChanged   = uint(m_vectorMeshlet.size());
+	uint lastChanged    = 0;
+	numCulled           = 0;
+
+	forI(m_vectorMeshlet.size())
+	{
+		vec3 center  = vec3(m_vectorMeshlet[i].m_boundingSphere);
+		float radius = m_vectorMeshlet[i].m_boundingSphere.w;
+		bool visible = MathUtil::sphereIntersectsFrustum(arrayFrustumPlane, center, radius);
+
+		if (visible)
+		{
+			// Normal cone test, all the triangles in the meshlet are back facing if the view vector is inside the cone
+			vec3 centerToCamera = center - cameraPosition;
+			visible             = (dot(centerToCamera, vec3(m_vectorMeshlet[i].m_normalCone)) < (m_vectorMeshlet[i].m_normalCone.w * glm::length(centerToCamera) + radius));
+		}
+
+		uint instanceCount = visible ? 1 : 0;
+		numCulled         += visible ? 0 : 1;
+
+		if (vectorIndirectCommand[i].instanceCount != instanceCount)
+		{
+			vectorIndirectCommand[i].instanceCount = instanceCount;
+			firstChanged                           = glm::min(firstChanged, uint(i));
+			lastChanged                            = uint(i);
+		}
+	}
+
+	if (firstChanged <= lastChanged)
+	{
+		VkDeviceSize offset = firstChanged * sizeof(VkDrawIndexedIndirectCommand);
+		VkDeviceSize size   = (lastChanged - firstChanged + 1) * sizeof(VkDrawIndexedIndirectCommand);
+		indirectCommandBuffer->setContentRange((void*)(&vectorIndirectCommand[firstChanged]), offset, size);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
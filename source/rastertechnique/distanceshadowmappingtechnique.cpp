@@ -36,6 +36,7 @@ limitations under the License.
 #include "../../include/framebuffer/framebuffermanager.h"
 #include "../../include/camera/camera.h"
 #include "../../include/camera/cameramanager.h"
+#include "../../include/rastertechnique/computefrustumcullingtechnique.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -76,47 +77,23 @@ DistanceShadowMappingTechnique::~DistanceShadowMappingTechnique()
 void DistanceShadowMappingTechnique::init()
 {
 	string distanceTextureName;
-	string offscreenTextureName;
 	if (m_parameterData->elementExists(g_distanceShadowMapDistanceTextureCodeChunkHashed))
 	{
 		AttributeData<string>* attribute = m_parameterData->getElement<AttributeData<string>*>(g_distanceShadowMapDistanceTextureCodeChunkHashed);
 		distanceTextureName = attribute->m_data;
 	}
-	if (m_parameterData->elementExists(g_distanceShadowMapOffscreenTextureCodeChunkHashed))
+
+	// The distance shadow map is a region of a shadow atlas page, and the depth attachment is the atlas depth scratch
+	// texture shared with the other shadow casting passes
+	ShadowAtlas& shadowAtlas = textureM->refShadowAtlas();
+	if (!shadowAtlas.allocateRegion(move(string(distanceTextureName)), VK_FORMAT_R16_SFLOAT, uint(m_shadowMapWidth), uint(m_shadowMapHeight), m_atlasRegion))
 	{
-		AttributeData<string>* attribute = m_parameterData->getElement<AttributeData<string>*>(g_distanceShadowMapOffscreenTextureCodeChunkHashed);
-		offscreenTextureName = attribute->m_data;
+		cout << "ERROR: no shadow atlas region could be allocated in DistanceShadowMappingTechnique::init" << endl;
+		return;
 	}
 
-	m_distanceShadowMappingTexture = textureM->buildTexture(
-		move(string(distanceTextureName)),
-		VK_FORMAT_R16_SFLOAT,
-		{ uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight), uint32_t(1) },
-		VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-		VK_IMAGE_ASPECT_COLOR_BIT,
-		VK_IMAGE_ASPECT_COLOR_BIT,
-		VK_IMAGE_LAYOUT_UNDEFINED,
-		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		VK_IMAGE_VIEW_TYPE_2D,
-		0);
-
-	m_offscreenDistanceDepthTexture = textureM->buildTexture(
-		move(string(offscreenTextureName)),
-		VK_FORMAT_D16_UNORM,
-		{ uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapWidth), uint32_t(1) },
-		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
-		VK_IMAGE_ASPECT_DEPTH_BIT,
-		VK_IMAGE_ASPECT_DEPTH_BIT,
-		VK_IMAGE_LAYOUT_UNDEFINED,
-		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		VK_IMAGE_VIEW_TYPE_2D,
-		0);
+	m_distanceShadowMappingTexture  = m_atlasRegion.m_texture;
+	m_offscreenDistanceDepthTexture = shadowAtlas.getDepthScratchTexture(VK_FORMAT_D16_UNORM);
 
 	VkPipelineBindPoint* pipelineBindPoint = new VkPipelineBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
 
@@ -180,7 +157,8 @@ void DistanceShadowMappingTechnique::init()
 		framebufferName = attribute->m_data;
 	}
 
-	m_framebuffer = framebufferM->buildFramebuffer(move(string(framebufferName)), (uint32_t)(m_shadowMapWidth), (uint32_t)(m_shadowMapHeight), move(string(m_renderPass->getName())), move(arrayAttachment));
+	const uint32_t pageSize = uint32_t(shadowAtlas.getPageSize());
+	m_framebuffer = framebufferM->buildFramebuffer(move(string(framebufferName)), pageSize, pageSize, move(string(m_renderPass->getName())), move(arrayAttachment));
 
 	string cameraName;
 	if (m_parameterData->elementExists(g_distanceShadowMapCameraNameCodeChunkHashed))
@@ -212,7 +190,6 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -223,7 +200,7 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 	VkRenderPassBeginInfo renderPassBegin = VulkanStructInitializer::renderPassBeginInfo(
 		m_renderPass->getRenderPass(),
 		m_framebuffer->getFramebuffer(),
-		VkRect2D({ 0, 0, uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight) }),
+		VkRect2D({ int32_t(m_atlasRegion.m_rectangle.x), int32_t(m_atlasRegion.m_rectangle.y), uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight) }),
 		m_material->refVectorClearValue());
 
 	vkCmdBeginRenderPass(*commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE); // Start recording the render pass instance
@@ -240,8 +217,8 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 
 	vkCmdBindIndexBuffer(*commandBuffer, bufferM->getElement(move(string("indexBuffer")))->getBuffer(), 0, VK_INDEX_TYPE_UINT32);
 
-	gpuPipelineM->initViewports((float)m_shadowMapWidth, (float)m_shadowMapHeight, 0.0f, 0.0f, 0.0f, 1.0f, commandBuffer);
-	gpuPipelineM->initScissors(m_shadowMapWidth, m_shadowMapHeight, 0, 0, commandBuffer);
+	gpuPipelineM->initViewports((float)m_shadowMapWidth, (float)m_shadowMapHeight, float(m_atlasRegion.m_rectangle.x), float(m_atlasRegion.m_rectangle.y), 0.0f, 1.0f, commandBuffer);
+	gpuPipelineM->initScissors(m_shadowMapWidth, m_shadowMapHeight, int(m_atlasRegion.m_rectangle.x), int(m_atlasRegion.m_rectangle.y), commandBuffer);
 
 	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_material->getPipeline()->getPipeline());
 
@@ -253,6 +230,19 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 	float depthBiasSlope    = 1.75f;
 	vkCmdSetDepthBias(*commandBuffer, depthBiasConstant, 0.0f, depthBiasSlope);
 
+	// Meshlet indirect commands are culled in ComputeFrustumCullingTechnique, each node draws its whole meshlet range with a single call
+	ComputeFrustumCullingTechnique* computeFrustumCullingTechnique = static_cast<ComputeFrustumCullingTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ComputeFrustumCullingTechnique"))));
+	Buffer* meshletIndirectCommandBuffer                           = nullptr;
+
+	if (m_camera->getName() == "emitter")
+	{
+		meshletIndirectCommandBuffer = bufferM->getElement(move(string("indirectCommandBufferMeshletEmitterCamera")));
+	}
+	else if (m_camera->getName() == "maincamera")
+	{
+		meshletIndirectCommandBuffer = bufferM->getElement(move(string("indirectCommandBufferMeshletMainCamera")));
+	}
+
 	if (m_useCompactedGeometry)
 	{
 		Node* mergedGeometry = sceneM->refElementByName(move(string("sceneCompactedGeometry")));
@@ -263,7 +253,17 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 		offsetData[0] = sceneM->getElementIndex(mergedGeometry) * sceneDataBufferOffset;
 		offsetData[1] = static_cast<uint32_t>(m_material->getMaterialUniformBufferIndex() * dynamicAllignment);
 		vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_material->getPipelineLayout(), 0, 1, &m_material->refDescriptorSet(), 2, &offsetData[0]);
-		vkCmdDrawIndexed(*commandBuffer, mergedGeometry->getIndexSize(), 1, mergedGeometry->getStartIndex(), 0, 0);
+
+		uvec2 meshletRange = (computeFrustumCullingTechnique != nullptr) ? computeFrustumCullingTechnique->getCompactedGeometryMeshletRange() : uvec2(0);
+
+		if ((meshletIndirectCommandBuffer != nullptr) && (meshletRange.y > 0))
+		{
+			vkCmdDrawIndexedIndirect(*commandBuffer, meshletIndirectCommandBuffer->getBuffer(), meshletRange.x * sizeof(VkDrawIndexedIndirectCommand), meshletRange.y, sizeof(VkDrawIndexedIndirectCommand));
+		}
+		else
+		{
+			vkCmdDrawIndexed(*commandBuffer, mergedGeometry->getIndexSize(), 1, mergedGeometry->getStartIndex(), 0, 0);
+		}
 	}
 	else
 	{
@@ -288,7 +288,17 @@ VkCommandBuffer* DistanceShadowMappingTechnique::record(int currentImage, uint&
 			}
 
 			vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_material->getPipelineLayout(), 0, 1, &m_material->refDescriptorSet(), 2, &offsetData[0]);
-			vkCmdDrawIndexedIndirect(*commandBuffer, m_indirectCommandBuffer->getBuffer(), i * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+
+			uvec2 meshletRange = (computeFrustumCullingTechnique != nullptr) ? computeFrustumCullingTechnique->getVectorNodeMeshletRange()[i] : uvec2(0);
+
+			if ((meshletIndirectCommandBuffer != nullptr) && (meshletRange.y > 0))
+			{
+				vkCmdDrawIndexedIndirect(*commandBuffer, meshletIndirectCommandBuffer->getBuffer(), meshletRange.x * sizeof(VkDrawIndexedIndirectCommand), meshletRange.y, sizeof(VkDrawIndexedIndirectCommand));
+			}
+			else
+			{
+				vkCmdDrawIndexedIndirect(*commandBuffer, m_indirectCommandBuffer->getBuffer(), i * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+			}
 		}
 	}
 
@@ -28,6 +28,7 @@ limitations under the License.
 #include "../../include/rastertechnique/scenevoxelizationtechnique.h"
 #include "../../include/rastertechnique/bufferprefixsumtechnique.h"
 #include "../../include/rastertechnique/litclustertechnique.h"
+#include "../../include/rastertechnique/clusterizationbuildfinalbuffertechnique.h"
 #include "../../include/camera/camera.h"
 #include "../../include/camera/cameramanager.h"
 #include "../../include/rastertechnique/cameravisiblevoxeltechnique.h"
@@ -35,6 +36,8 @@ limitations under the License.
 #include "../../include/material/materiallightbouncevoxelgaussianfiltersecond.h"
 #include "../../include/uniformbuffer/uniformbuffer.h"
 #include "../../include/util/vulkanstructinitializer.h"
+#include "../../include/util/bufferverificationhelper.h"
+#include "../../include/util/lightingreferencehelper.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -59,6 +62,17 @@ LightBounceVoxelIrradianceTechnique::LightBounceVoxelIrradianceTechnique(string
 	, m_cameraVisibleVoxelNumber(0)
 	, m_lightBounceIndirectLitCounter(0)
 	, m_lightBounceVoxelGaussianFilterDebugBuffer(nullptr)
+	, m_recordedDispatchSize(uvec4(0))
+	, m_voxelFaceBudgetPerFrame(0)
+	, m_sliceVoxelOffset(0)
+	, m_sliceVoxelNumber(0)
+	, m_sliceInProgress(false)
+	, m_voxelizationWidth(0)
+	, m_irradianceCache(true)
+	, m_lightBounceVoxelFilteredIrradianceBuffer(nullptr)
+	, m_temporalBlend(1.0f)
+	, m_temporalBlendThreshold(0.01f)
+	, m_temporalBlendPending(false)
 {
 	m_numElementPerLocalWorkgroupThread = 1;
 	//m_numThreadPerLocalWorkgroup        = 128;
@@ -105,6 +119,14 @@ void LightBounceVoxelIrradianceTechnique::init()
 	// Shader storage buffer with the indices of the elements present in the buffer litHiddenVoxelBuffer
 	m_lightBounceVoxelIrradianceBuffer = bufferM->getElement(move(string("lightBounceVoxelIrradianceBuffer")));
 
+	m_lightBounceVoxelFilteredIrradianceBuffer = bufferM->getElement(move(string("lightBounceVoxelFilteredIrradianceBuffer")));
+
+	// Raster flags not present have a negative value
+	int voxelFaceBudgetPerFrame = gpuPipelineM->getRasterFlagValue(move(string("LIGHT_BOUNCE_VOXEL_FACE_BUDGET_PER_FRAME")));
+	int temporalBlend           = gpuPipelineM->getRasterFlagValue(move(string("LIGHT_BOUNCE_TEMPORAL_BLEND")));
+	m_voxelFaceBudgetPerFrame   = (voxelFaceBudgetPerFrame >= 0) ? uint(voxelFaceBudgetPerFrame) : 0;
+	m_temporalBlend             = (temporalBlend > 0) ? glm::min(float(temporalBlend) / 100.0f, 1.0f) : 1.0f;
+
 	// Assuming each thread will take care of a whole row / column
 	buildShaderThreadMapping();
 
@@ -125,11 +147,14 @@ void LightBounceVoxelIrradianceTechnique::init()
 	vec3 extent3D             = max3D - min3D;
 	m_sceneMin                = vec4(min3D.x,    min3D.y,    min3D.z, 0.0f);
 	m_sceneExtent             = vec4(extent3D.x, extent3D.y, extent3D.z, float(sceneVoxelizationTechnique->getVoxelizedSceneWidth()));
+	m_voxelizationWidth       = sceneVoxelizationTechnique->getVoxelizedSceneWidth();
 
 	MaterialLightBounceVoxelIrradiance* materialCasted = static_cast<MaterialLightBounceVoxelIrradiance*>(m_material);
 	materialCasted->setSceneExtentAndVoxelSize(m_sceneExtent);
 
 	m_litClusterTechnique = static_cast<LitClusterTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("LitClusterTechnique"))));
+	m_litClusterTechnique->refSignalLitClusterCompletion().connect<LightBounceVoxelIrradianceTechnique, &LightBounceVoxelIrradianceTechnique::slotLitClusterCompleted>(this);
+	m_vectorVoxelIrradianceCached.resize((m_voxelizationWidth * m_voxelizationWidth * m_voxelizationWidth + 31) / 32, 0);
 
 	m_techniquePrefixSum = static_cast<BufferPrefixSumTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("BufferPrefixSumTechnique"))));
 	m_techniquePrefixSum->refPrefixSumComplete().connect<LightBounceVoxelIrradianceTechnique, &LightBounceVoxelIrradianceTechnique::slotPrefixSumComplete>(this);
@@ -168,6 +193,10 @@ void LightBounceVoxelIrradianceTechnique::init()
 	inputM->refEventSinglePressSignalSlot().addKeyDownSignal(KeyCode::KEY_CODE_6);
 	signalAdd = inputM->refEventSinglePressSignalSlot().refKeyDownSignalByKey(KeyCode::KEY_CODE_6);
 	signalAdd->connect<LightBounceVoxelIrradianceTechnique, &LightBounceVoxelIrradianceTechnique::slot6KeyPressed>(this);
+
+	inputM->refEventSinglePressSignalSlot().addKeyDownSignal(KeyCode::KEY_CODE_G);
+	signalAdd = inputM->refEventSinglePressSignalSlot().refKeyDownSignalByKey(KeyCode::KEY_CODE_G);
+	signalAdd->connect<LightBounceVoxelIrradianceTechnique, &LightBounceVoxelIrradianceTechnique::slotGKeyPressed>(this);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,8 +209,6 @@ VkCommandBuffer* LightBounceVoxelIrradianceTechnique::record(int currentImage, u
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
-
 	coreM->beginCommandBuffer(*commandBuffer);
 
 #ifdef USE_TIMESTAMP
@@ -194,9 +221,9 @@ VkCommandBuffer* LightBounceVoxelIrradianceTechnique::record(int currentImage, u
 
 	uint dynamicAllignment = materialM->getMaterialUBDynamicAllignment();
 
-	uint32_t offsetData;
+	// When the light bounce is split across several frames, both the light bounce and the gaussian filter process the current slice
 	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, castedBounce->getPipeline()->getPipeline());
-	offsetData = static_cast<uint32_t>(castedBounce->getMaterialUniformBufferIndex() * dynamicAllignment);
+	uint32_t offsetData = static_cast<uint32_t>(castedBounce->getMaterialUniformBufferIndex() * dynamicAllignment);
 	vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, castedBounce->getPipelineLayout(), 0, 1, &castedBounce->refDescriptorSet(), 1, &offsetData);
 	vkCmdDispatch(*commandBuffer, castedBounce->getLocalWorkGroupsXDimension(), castedBounce->getLocalWorkGroupsYDimension(), 1); // Compute shader global workgroup https://www.khronos.org/registry/vulkan/specs/1.1-extensions/html/vkspec.html
 
@@ -225,6 +252,11 @@ VkCommandBuffer* LightBounceVoxelIrradianceTechnique::record(int currentImage, u
 
 	coreM->endCommandBuffer(*commandBuffer);
 
+	m_recordedDispatchSize = uvec4(castedBounce->getLocalWorkGroupsXDimension(),
+								   castedBounce->getLocalWorkGroupsYDimension(),
+								   castedFilter->getLocalWorkGroupsXDimension(),
+								   castedFilter->getLocalWorkGroupsYDimension());
+
 	// NOTE: Clear command buffer if re-recorded
 	m_vectorCommand.push_back(commandBuffer);
 
@@ -235,13 +267,34 @@ VkCommandBuffer* LightBounceVoxelIrradianceTechnique::record(int currentImage, u
 
 void LightBounceVoxelIrradianceTechnique::postCommandSubmit()
 {
-	m_litClusterTechnique->setTechniqueLock(false);
-	m_cameraVisibleVoxelTechnique->setLightBounceOnProgress(false);
-	m_signalLightBounceVoxelIrradianceCompletion.emit();
+	// The light bounce and gaussian filter results of the voxels in the slice just executed are available
+	if (!applyTemporalBlend() && m_irradianceCache)
+	{
+		markCameraVisibleVoxelCached(m_sliceVoxelOffset, m_sliceVoxelNumber);
+	}
+
+	if (m_sliceInProgress)
+	{
+		m_sliceVoxelOffset += m_sliceVoxelNumber;
+
+		if (m_sliceVoxelOffset < m_cameraVisibleVoxelNumber)
+		{
+			prepareNextSlice();
+			updateRecordedCommandBuffer();
+
+			// The technique remains active, the next slice will be submitted next frame
+			m_executeCommand = false;
+			m_needsToRecord  = (m_vectorCommand.size() != m_usedCommandBufferNumber);
+			return;
+		}
+	}
+
+	m_sliceInProgress = false;
+
+	completeLightBounce();
 
 	m_executeCommand = false;
 	m_active         = false;
-	m_executeCommand = false;
 	m_needsToRecord  = (m_vectorCommand.size() != m_usedCommandBufferNumber);
 }
 
@@ -267,6 +320,11 @@ void LightBounceVoxelIrradianceTechnique::slotPrefixSumComplete()
 
 	cout << "lightBounceVoxelDebugBuffer has size " << (float(m_lightBounceVoxelDebugBuffer->getDataSize()) / 1024.0f) / 1024.0f << "MB" << endl;
 
+	// Host copies of the occupied voxels information are taken again from the new buffers when needed
+	m_vectorVoxelHashedPosition.clear();
+	m_vectorClusterVisibleVoxelFirst.clear();
+	m_vectorClusterVisibleVoxel.clear();
+
 	m_prefixSumCompleted = true;
 }
 
@@ -278,11 +336,6 @@ void LightBounceVoxelIrradianceTechnique::slotCameraVisibleVoxelCompleted()
 	{
 		m_cameraVisibleVoxelNumber = m_cameraVisibleVoxelTechnique->getCameraVisibleVoxelNumber();
 
-		m_bufferNumElement = m_cameraVisibleVoxelNumber * m_numThreadPerLocalWorkgroup * 6; // Each local workgroup will work one side of each voxel in the scene
-		m_sceneMin.w       = float(m_cameraVisibleVoxelNumber);
-
-		obtainDispatchWorkGroupCount();
-
 		MaterialLightBounceVoxelIrradiance* materialCasted = static_cast<MaterialLightBounceVoxelIrradiance*>(m_material);
 		vec3 cameraPosition                                = m_litClusterTechnique->getCameraPosition();
 		vec3 cameraForward                                 = m_litClusterTechnique->getCameraForward();
@@ -290,28 +343,495 @@ void LightBounceVoxelIrradianceTechnique::slotCameraVisibleVoxelCompleted()
 
 		materialCasted->setLightPosition(vec4(cameraPosition.x, cameraPosition.y, cameraPosition.z, 0.0f));
 		materialCasted->setLightForwardEmitterRadiance(vec4(cameraForward.x, cameraForward.y, cameraForward.z, emitterRadiance));
-		materialCasted->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
-		materialCasted->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
-		materialCasted->setSceneMinAndNumberVoxel(m_sceneMin);
-		materialCasted->setNumThreadExecuted(m_bufferNumElement);
 
-		m_bufferNumElement = m_cameraVisibleVoxelNumber * 6;
+		bool overBudget = (m_voxelFaceBudgetPerFrame != 0) && ((m_cameraVisibleVoxelNumber * 6) > m_voxelFaceBudgetPerFrame);
+
+		if (m_irradianceCache || overBudget || (m_temporalBlend < 1.0f))
+		{
+			// Only the camera visible voxels at the beginning of cameraVisibleVoxelCompactedBuffer are read back
+			m_vectorCameraVisibleVoxel.resize(m_cameraVisibleVoxelNumber);
+			bufferM->getElement(move(string("cameraVisibleVoxelCompactedBuffer")))->getContentRange(m_vectorCameraVisibleVoxel.data(), 0, m_cameraVisibleVoxelNumber * sizeof(uint));
+		}
+
+		if (m_irradianceCache)
+		{
+			// Only the camera visible voxels without valid light bounce results are processed, placed at the beginning of cameraVisibleVoxelCompactedBuffer
+			m_cameraVisibleVoxelNumber = removeCachedCameraVisibleVoxel();
+
+			if (m_cameraVisibleVoxelNumber == 0)
+			{
+				completeLightBounce();
+				return;
+			}
+
+			overBudget = (m_voxelFaceBudgetPerFrame != 0) && ((m_cameraVisibleVoxelNumber * 6) > m_voxelFaceBudgetPerFrame);
+
+			if (!overBudget)
+			{
+				bufferM->getElement(move(string("cameraVisibleVoxelCompactedBuffer")))->setContentRange(m_vectorCameraVisibleVoxel.data(), 0, m_cameraVisibleVoxelNumber * sizeof(uint));
+			}
+		}
+
+		m_sliceVoxelOffset = 0;
+
+		if (!overBudget)
+		{
+			// All the camera visible voxels are processed as a single slice
+			m_sliceInProgress  = false;
+			m_sliceVoxelNumber = m_cameraVisibleVoxelNumber;
+			setBounceVoxelNumber(m_cameraVisibleVoxelNumber);
+			setFilterVoxelNumber(m_cameraVisibleVoxelNumber);
+			storeSlicePreviousIrradiance();
+		}
+		else
+		{
+			sortCameraVisibleVoxelByImportance();
+
+			m_sliceInProgress = true;
+			prepareNextSlice();
+		}
+
+		// The light position and the number of visible voxels are read from the material uniform buffer, the command
+		// buffer only needs to be recorded again if the dispatch size of any of the recorded dispatches changed
+		updateRecordedCommandBuffer();
 
-		obtainDispatchWorkGroupCount();
-		MaterialLightBounceVoxelGaussianFilter* materialCastedFilter = static_cast<MaterialLightBounceVoxelGaussianFilter*>(m_vectorMaterial[1]);
-		materialCastedFilter->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
-		materialCastedFilter->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
-		materialCastedFilter->setNumThreadExecuted(m_bufferNumElement);
+		m_active = true;
+	}
+}
 
-		MaterialLightBounceVoxelGaussianFilterSecond* materialCastedFilterSecond = static_cast<MaterialLightBounceVoxelGaussianFilterSecond*>(m_vectorMaterial[2]);
-		materialCastedFilterSecond->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
-		materialCastedFilterSecond->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
-		materialCastedFilterSecond->setNumThreadExecuted(m_bufferNumElement);
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::slotLitClusterCompleted()
+{
+	if (!m_litClusterTechnique->getAffectedClusterKnown() || !buildClusterVisibleVoxel())
+	{
+		invalidateIrradianceCache();
+		return;
+	}
 
-		// Each time CameraVisibleVoxelTechnique this technique needs to record
-		m_vectorCommand.clear();
+	// Only the voxels with any face seeing a cluster whose irradiance changed need the light bounce to be computed again
+	const vectorUint& vectorAffectedCluster = m_litClusterTechnique->getVectorAffectedCluster();
+	const uint numCluster                   = uint(m_vectorClusterVisibleVoxelFirst.size()) - 1;
 
-		m_active = true;
+	forIT(vectorAffectedCluster)
+	{
+		if (*it >= numCluster)
+		{
+			continue;
+		}
+
+		for (uint i = m_vectorClusterVisibleVoxelFirst[*it]; i < m_vectorClusterVisibleVoxelFirst[*it + 1]; ++i)
+		{
+			uint hashed = m_vectorClusterVisibleVoxel[i];
+			m_vectorVoxelIrradianceCached[hashed >> 5] &= ~(1u << (hashed & 31));
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::invalidateIrradianceCache()
+{
+	fill(m_vectorVoxelIrradianceCached.begin(), m_vectorVoxelIrradianceCached.end(), 0u);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightBounceVoxelIrradianceTechnique::buildClusterVisibleVoxel()
+{
+	if (!m_vectorClusterVisibleVoxelFirst.empty())
+	{
+		return true;
+	}
+
+	ClusterizationBuildFinalBufferTechnique* clusterTechnique = static_cast<ClusterizationBuildFinalBufferTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ClusterizationBuildFinalBufferTechnique"))));
+	Buffer* clusterVisibilityNumberBuffer                     = bufferM->getElement(move(string("clusterVisibilityNumberBuffer")));
+	Buffer* clusterVisibilityFirstIndexBuffer                 = bufferM->getElement(move(string("clusterVisibilityFirstIndexBuffer")));
+	Buffer* clusterVisibilityCompactedBuffer                  = bufferM->getElement(move(string("clusterVisibilityCompactedBuffer")));
+
+	if ((clusterTechnique == nullptr) || (clusterVisibilityNumberBuffer == nullptr) || (clusterVisibilityFirstIndexBuffer == nullptr) || (clusterVisibilityCompactedBuffer == nullptr) || !loadVoxelHashedPosition())
+	{
+		return false;
+	}
+
+	const uint numCluster = clusterTechnique->getCompactedClusterNumber();
+	const uint numFace    = m_numOccupiedVoxel * 6;
+
+	// The cluster visibility buffers are only filled once the cluster visibility has been computed
+	if ((numCluster == 0) ||
+		(clusterVisibilityNumberBuffer->getDataSize()     < (numFace * sizeof(uint))) ||
+		(clusterVisibilityFirstIndexBuffer->getDataSize() < (numFace * sizeof(uint))))
+	{
+		return false;
+	}
+
+	vectorUint vectorNumber(numFace);
+	vectorUint vectorFirst(numFace);
+	vectorUint vectorCompacted(uint(clusterVisibilityCompactedBuffer->getDataSize() / sizeof(uint)));
+
+	clusterVisibilityNumberBuffer->getContentRange(     vectorNumber.data(),    0, vectorNumber.size()    * sizeof(uint));
+	clusterVisibilityFirstIndexBuffer->getContentRange( vectorFirst.data(),     0, vectorFirst.size()     * sizeof(uint));
+	clusterVisibilityCompactedBuffer->getContentRange(  vectorCompacted.data(), 0, vectorCompacted.size() * sizeof(uint));
+
+	// Inverse of the per voxel face cluster visibility: for each cluster, the hashed position of the voxels with any
+	// face seeing it. Done in two passes, the first one counts the voxels per cluster and the second one stores them
+	const uint maxPackedIndex = uint(vectorCompacted.size()) * 2;
+	vectorUint vectorLastVoxel(numCluster);
+	vectorUint vectorFillIndex;
+
+	m_vectorClusterVisibleVoxelFirst.assign(numCluster + 1, 0);
+
+	forI(2)
+	{
+		fill(vectorLastVoxel.begin(), vectorLastVoxel.end(), UINT_MAX);
+
+		forJ(m_numOccupiedVoxel)
+		{
+			for (uint k = 0; k < 6; ++k)
+			{
+				const uint faceIndex  = j * 6 + k;
+				const uint numVisible = vectorNumber[faceIndex];
+				const uint firstIndex = vectorFirst[faceIndex];
+
+				if ((numVisible == 0) || ((firstIndex + numVisible) > maxPackedIndex))
+				{
+					continue;
+				}
+
+				for (uint l = firstIndex; l < firstIndex + numVisible; ++l)
+				{
+					// Cluster indices are packed as 16 bit values in clusterVisibilityCompactedBuffer
+					const uint clusterIndex = (vectorCompacted[l >> 1] >> ((l & 1) * 16)) & 0x0000FFFF;
+
+					if ((clusterIndex >= numCluster) || (vectorLastVoxel[clusterIndex] == uint(j)))
+					{
+						continue;
+					}
+
+					vectorLastVoxel[clusterIndex] = uint(j);
+
+					if (i == 0)
+					{
+						m_vectorClusterVisibleVoxelFirst[clusterIndex + 1]++;
+					}
+					else
+					{
+						m_vectorClusterVisibleVoxel[vectorFillIndex[clusterIndex]++] = m_vectorVoxelHashedPosition[j];
+					}
+				}
+			}
+		}
+
+		if (i == 0)
+		{
+			forJ(numCluster)
+			{
+				m_vectorClusterVisibleVoxelFirst[j + 1] += m_vectorClusterVisibleVoxelFirst[j];
+			}
+
+			m_vectorClusterVisibleVoxel.resize(m_vectorClusterVisibleVoxelFirst[numCluster]);
+			vectorFillIndex.assign(m_vectorClusterVisibleVoxelFirst.begin(), m_vectorClusterVisibleVoxelFirst.end() - 1);
+		}
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint LightBounceVoxelIrradianceTechnique::removeCachedCameraVisibleVoxel()
+{
+	uint numVoxel = 0;
+
+	forI(m_cameraVisibleVoxelNumber)
+	{
+		uint hashed = m_vectorCameraVisibleVoxel[i];
+		uint word   = hashed >> 5;
+		uint bit    = 1u << (hashed & 31);
+
+		if ((word < uint(m_vectorVoxelIrradianceCached.size())) && !(m_vectorVoxelIrradianceCached[word] & bit))
+		{
+			m_vectorCameraVisibleVoxel[numVoxel++] = hashed;
+		}
+	}
+
+	return numVoxel;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::markCameraVisibleVoxelCached(uint offset, uint number)
+{
+	uint end = glm::min(offset + number, uint(m_vectorCameraVisibleVoxel.size()));
+
+	for (uint i = offset; i < end; ++i)
+	{
+		uint hashed = m_vectorCameraVisibleVoxel[i];
+		uint word   = hashed >> 5;
+
+		if (word < uint(m_vectorVoxelIrradianceCached.size()))
+		{
+			m_vectorVoxelIrradianceCached[word] |= 1u << (hashed & 31);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::completeLightBounce()
+{
+	m_litClusterTechnique->setTechniqueLock(false);
+
+	// Voxels with a temporal blend still far from the new light bounce results are not cached and need another pass
+	if (m_temporalBlendPending)
+	{
+		m_temporalBlendPending = false;
+		m_cameraVisibleVoxelTechnique->setForceNextPass(true);
+	}
+
+	m_cameraVisibleVoxelTechnique->lightBounceCompleted();
+	m_signalLightBounceVoxelIrradianceCompletion.emit();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::setBounceVoxelNumber(uint voxelNumber)
+{
+	m_bufferNumElement = voxelNumber * m_numThreadPerLocalWorkgroup * 6; // Each local workgroup will work one side of each voxel in the scene
+	m_sceneMin.w       = float(voxelNumber);
+
+	obtainDispatchWorkGroupCount();
+
+	MaterialLightBounceVoxelIrradiance* materialCasted = static_cast<MaterialLightBounceVoxelIrradiance*>(m_material);
+	materialCasted->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
+	materialCasted->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
+	materialCasted->setSceneMinAndNumberVoxel(m_sceneMin);
+	materialCasted->setNumThreadExecuted(m_bufferNumElement);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::setFilterVoxelNumber(uint voxelNumber)
+{
+	m_bufferNumElement = voxelNumber * 6;
+
+	obtainDispatchWorkGroupCount();
+
+	MaterialLightBounceVoxelGaussianFilter* materialCastedFilter = static_cast<MaterialLightBounceVoxelGaussianFilter*>(m_vectorMaterial[1]);
+	materialCastedFilter->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
+	materialCastedFilter->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
+	materialCastedFilter->setNumThreadExecuted(m_bufferNumElement);
+
+	MaterialLightBounceVoxelGaussianFilterSecond* materialCastedFilterSecond = static_cast<MaterialLightBounceVoxelGaussianFilterSecond*>(m_vectorMaterial[2]);
+	materialCastedFilterSecond->setLocalWorkGroupsXDimension(m_localWorkGroupsXDimension);
+	materialCastedFilterSecond->setLocalWorkGroupsYDimension(m_localWorkGroupsYDimension);
+	materialCastedFilterSecond->setNumThreadExecuted(m_bufferNumElement);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::sortCameraVisibleVoxelByImportance()
+{
+	vec3 cameraPosition = m_mainCamera->getPosition();
+	vec3 sceneMin       = vec3(m_sceneMin);
+	vec3 voxelSize      = vec3(m_sceneExtent) / m_sceneExtent.w;
+
+	vector<pair<float, uint>> vectorDistanceVoxel(m_cameraVisibleVoxelNumber);
+
+	forI(m_cameraVisibleVoxelNumber)
+	{
+		uvec3 voxelCoordinates   = BufferVerificationHelper::unhashValue(m_vectorCameraVisibleVoxel[i], m_voxelizationWidth);
+		vec3 voxelCenter         = sceneMin + (vec3(voxelCoordinates) + vec3(0.5f)) * voxelSize;
+		vec3 toCamera            = voxelCenter - cameraPosition;
+		vectorDistanceVoxel[i]   = pair<float, uint>(dot(toCamera, toCamera), m_vectorCameraVisibleVoxel[i]);
+	}
+
+	sort(vectorDistanceVoxel.begin(), vectorDistanceVoxel.end());
+
+	forI(m_cameraVisibleVoxelNumber)
+	{
+		m_vectorCameraVisibleVoxel[i] = vectorDistanceVoxel[i].second;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::prepareNextSlice()
+{
+	uint budgetVoxel   = (m_voxelFaceBudgetPerFrame != 0) ? glm::max(m_voxelFaceBudgetPerFrame / 6, 1u) : m_cameraVisibleVoxelNumber;
+	m_sliceVoxelNumber = glm::min(budgetVoxel, m_cameraVisibleVoxelNumber - m_sliceVoxelOffset);
+
+	// The light bounce and gaussian filter shaders process the first voxels in cameraVisibleVoxelCompactedBuffer, only the slice is written there
+	bufferM->getElement(move(string("cameraVisibleVoxelCompactedBuffer")))->setContentRange(&m_vectorCameraVisibleVoxel[m_sliceVoxelOffset], 0, m_sliceVoxelNumber * sizeof(uint));
+
+	setBounceVoxelNumber(m_sliceVoxelNumber);
+	setFilterVoxelNumber(m_sliceVoxelNumber);
+	storeSlicePreviousIrradiance();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightBounceVoxelIrradianceTechnique::loadVoxelHashedPosition()
+{
+	if ((m_numOccupiedVoxel > 0) && (uint(m_vectorVoxelHashedPosition.size()) == m_numOccupiedVoxel))
+	{
+		return true;
+	}
+
+	Buffer* voxelHashedPositionCompactedBuffer = bufferM->getElement(move(string("voxelHashedPositionCompactedBuffer")));
+
+	if ((voxelHashedPositionCompactedBuffer == nullptr) || (m_numOccupiedVoxel == 0) || (voxelHashedPositionCompactedBuffer->getDataSize() < (m_numOccupiedVoxel * sizeof(uint))))
+	{
+		return false;
+	}
+
+	m_vectorVoxelHashedPosition.resize(m_numOccupiedVoxel);
+
+	if (!voxelHashedPositionCompactedBuffer->getContentRange(m_vectorVoxelHashedPosition.data(), 0, m_numOccupiedVoxel * sizeof(uint)))
+	{
+		m_vectorVoxelHashedPosition.clear();
+		return false;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::storeSlicePreviousIrradiance()
+{
+	m_vectorSliceVoxelIndex.clear();
+
+	if ((m_temporalBlend >= 1.0f) || (m_lightBounceVoxelFilteredIrradianceBuffer == nullptr) || !loadVoxelHashedPosition())
+	{
+		return;
+	}
+
+	const float* pIrradiance = (const float*)(m_lightBounceVoxelIrradianceBuffer->mapContent());
+	const float* pFiltered   = (const float*)(m_lightBounceVoxelFilteredIrradianceBuffer->mapContent());
+
+	if ((pIrradiance != nullptr) && (pFiltered != nullptr))
+	{
+		m_vectorSliceVoxelIndex.resize(m_sliceVoxelNumber);
+		m_vectorPreviousIrradiance.resize(m_sliceVoxelNumber * 12);
+
+		forI(m_sliceVoxelNumber)
+		{
+			// Compacted hashed positions are stored in increasing order
+			uint hashed                     = m_vectorCameraVisibleVoxel[m_sliceVoxelOffset + i];
+			vectorUint::const_iterator it   = lower_bound(m_vectorVoxelHashedPosition.begin(), m_vectorVoxelHashedPosition.end(), hashed);
+			uint index                      = ((it != m_vectorVoxelHashedPosition.end()) && (*it == hashed)) ? uint(it - m_vectorVoxelHashedPosition.begin()) : UINT_MAX;
+			m_vectorSliceVoxelIndex[i]      = index;
+
+			if (index == UINT_MAX)
+			{
+				continue;
+			}
+
+			// Two floats per voxel face, the irradiance is the first one. The light bounce irradiance is stored first and the filtered one after it
+			for (uint j = 0; j < 6; ++j)
+			{
+				m_vectorPreviousIrradiance[i * 12 + j]     = pIrradiance[index * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER + j * 2];
+				m_vectorPreviousIrradiance[i * 12 + 6 + j] = pFiltered[index * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER + j * 2];
+			}
+		}
+	}
+
+	if (pIrradiance != nullptr)
+	{
+		m_lightBounceVoxelIrradianceBuffer->unmapContent();
+	}
+
+	if (pFiltered != nullptr)
+	{
+		m_lightBounceVoxelFilteredIrradianceBuffer->unmapContent();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightBounceVoxelIrradianceTechnique::applyTemporalBlend()
+{
+	if (m_vectorSliceVoxelIndex.empty() || (uint(m_vectorSliceVoxelIndex.size()) != m_sliceVoxelNumber))
+	{
+		return false;
+	}
+
+	float* pIrradiance = (float*)(m_lightBounceVoxelIrradianceBuffer->mapContent());
+	float* pFiltered   = (float*)(m_lightBounceVoxelFilteredIrradianceBuffer->mapContent());
+
+	if ((pIrradiance != nullptr) && (pFiltered != nullptr))
+	{
+		forI(m_sliceVoxelNumber)
+		{
+			uint index = m_vectorSliceVoxelIndex[i];
+
+			if (index == UINT_MAX)
+			{
+				continue;
+			}
+
+			float* arrayVoxelData[2] = { &pIrradiance[index * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER], &pFiltered[index * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER] };
+			bool converged           = true;
+
+			forJ(2)
+			{
+				for (uint k = 0; k < 6; ++k)
+				{
+					float& value     = arrayVoxelData[j][k * 2];
+					float previous   = m_vectorPreviousIrradiance[i * 12 + j * 6 + k];
+					float difference = value - previous;
+
+					// Faces whose new result is close enough to the previous one take the new result directly
+					if (glm::abs(difference) > (m_temporalBlendThreshold * glm::max(glm::abs(value), 1.0e-6f)))
+					{
+						value     = previous + difference * m_temporalBlend;
+						converged = false;
+					}
+				}
+			}
+
+			if (!converged)
+			{
+				m_temporalBlendPending = true;
+			}
+			else if (m_irradianceCache)
+			{
+				markCameraVisibleVoxelCached(m_sliceVoxelOffset + i, 1);
+			}
+		}
+	}
+
+	if (pIrradiance != nullptr)
+	{
+		m_lightBounceVoxelIrradianceBuffer->unmapContent();
+	}
+
+	if (pFiltered != nullptr)
+	{
+		m_lightBounceVoxelFilteredIrradianceBuffer->unmapContent();
+	}
+
+	m_vectorSliceVoxelIndex.clear();
+
+	return ((pIrradiance != nullptr) && (pFiltered != nullptr));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::updateRecordedCommandBuffer()
+{
+	MaterialLightBounceVoxelIrradiance* castedBounce     = static_cast<MaterialLightBounceVoxelIrradiance*>(m_vectorMaterial[0]);
+	MaterialLightBounceVoxelGaussianFilter* castedFilter = static_cast<MaterialLightBounceVoxelGaussianFilter*>(m_vectorMaterial[1]);
+
+	uvec4 dispatchSize = uvec4(castedBounce->getLocalWorkGroupsXDimension(),
+							   castedBounce->getLocalWorkGroupsYDimension(),
+							   castedFilter->getLocalWorkGroupsXDimension(),
+							   castedFilter->getLocalWorkGroupsYDimension());
+
+	if (dispatchSize != m_recordedDispatchSize)
+	{
+		clearRecordedCommandBuffer();
 	}
 }
 
@@ -322,6 +842,7 @@ void LightBounceVoxelIrradianceTechnique::slot3KeyPressed()
 	MaterialLightBounceVoxelIrradiance* castedBounce = static_cast<MaterialLightBounceVoxelIrradiance*>(m_vectorMaterial[0]);
 	castedBounce->setFormFactorVoxelToVoxelAdded(castedBounce->getFormFactorVoxelToVoxelAdded() - 1.0f);
 	cout << "LightBounceVoxelIrradianceTechnique: New value for FormFactorVoxelToVoxelAdded is " << castedBounce->getFormFactorVoxelToVoxelAdded() << endl;
+	invalidateIrradianceCache();
 	m_litClusterTechnique->slotCameraDirty(); // Force emitter irradiance update
 }
 
@@ -332,6 +853,7 @@ void LightBounceVoxelIrradianceTechnique::slot4KeyPressed()
 	MaterialLightBounceVoxelIrradiance* castedBounce = static_cast<MaterialLightBounceVoxelIrradiance*>(m_vectorMaterial[0]);
 	castedBounce->setFormFactorVoxelToVoxelAdded(castedBounce->getFormFactorVoxelToVoxelAdded() + 1.0f);
 	cout << "LightBounceVoxelIrradianceTechnique: New value for FormFactorVoxelToVoxelAdded is " << castedBounce->getFormFactorVoxelToVoxelAdded() << endl;
+	invalidateIrradianceCache();
 	m_litClusterTechnique->slotCameraDirty(); // Force emitter irradiance update
 }
 
@@ -342,6 +864,7 @@ void LightBounceVoxelIrradianceTechnique::slot5KeyPressed()
 	MaterialLightBounceVoxelIrradiance* castedBounce = static_cast<MaterialLightBounceVoxelIrradiance*>(m_vectorMaterial[0]);
 	castedBounce->setFormFactorClusterToVoxelAdded(castedBounce->getFormFactorClusterToVoxelAdded() - 100.0f);
 	cout << "LightBounceVoxelIrradianceTechnique: New value for FormFactorClusterToVoxelAdded is " << castedBounce->getFormFactorClusterToVoxelAdded() << endl;
+	invalidateIrradianceCache();
 	m_litClusterTechnique->slotCameraDirty(); // Force emitter irradiance update
 }
 
@@ -352,7 +875,61 @@ void LightBounceVoxelIrradianceTechnique::slot6KeyPressed()
 	MaterialLightBounceVoxelIrradiance* castedBounce = static_cast<MaterialLightBounceVoxelIrradiance*>(m_vectorMaterial[0]);
 	castedBounce->setFormFactorClusterToVoxelAdded(castedBounce->getFormFactorClusterToVoxelAdded() + 100.0f);
 	cout << "LightBounceVoxelIrradianceTechnique: New value for FormFactorClusterToVoxelAdded is " << castedBounce->getFormFactorClusterToVoxelAdded() << endl;
+	invalidateIrradianceCache();
 	m_litClusterTechnique->slotCameraDirty(); // Force emitter irradiance update
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightBounceVoxelIrradianceTechnique::slotGKeyPressed()
+{
+	LightingReferenceInput input;
+
+	if (!LightingReferenceHelper::gatherInput(input))
+	{
+		cout << "ERROR in LightBounceVoxelIrradianceTechnique::slotGKeyPressed, reference input not available" << endl;
+		return;
+	}
+
+	LightingReferenceResult result;
+	LightingReferenceHelper::compute(input, result);
+
+	// With the irradiance cache, only the voxels with valid light bounce results are meaningful to compare
+	vectorUint8 vectorVoxelMask;
+	const vectorUint8* pVoxelMask = nullptr;
+
+	if (m_irradianceCache && loadVoxelHashedPosition())
+	{
+		vectorVoxelMask.resize(m_vectorVoxelHashedPosition.size(), 0);
+
+		forI(m_vectorVoxelHashedPosition.size())
+		{
+			uint hashed = m_vectorVoxelHashedPosition[i];
+			uint word   = hashed >> 5;
+
+			if ((word < uint(m_vectorVoxelIrradianceCached.size())) && ((m_vectorVoxelIrradianceCached[word] & (1u << (hashed & 31))) != 0))
+			{
+				vectorVoxelMask[i] = 1;
+			}
+		}
+
+		pVoxelMask = &vectorVoxelMask;
+	}
+
+	bool litVoxelEqual = LightingReferenceHelper::compareLitVoxel(result, 0.01f);
+	bool bounceEqual   = LightingReferenceHelper::compareIrradiance(result.m_vectorBounceIrradiance, move(string("lightBounceVoxelIrradianceBuffer")), 0.05f, pVoxelMask);
+	bool filteredEqual = LightingReferenceHelper::compareIrradiance(result.m_vectorFilteredIrradiance, move(string("lightBounceVoxelFilteredIrradianceBuffer")), 0.05f, pVoxelMask);
+
+	cout << "LightBounceVoxelIrradianceTechnique: reference comparison lit test " << (litVoxelEqual ? "OK" : "FAILED") << ", light bounce " << (bounceEqual ? "OK" : "FAILED") << ", filtered " << (filteredEqual ? "OK" : "FAILED") << endl;
+
+	// GPU timestamps of the last execution of each technique. When the light bounce is split in slices, only the last slice is measured
+	float gpuLitClusterTime  = m_litClusterTechnique->getLastExecutionTime();
+	float gpuLightBounceTime = getLastExecutionTime();
+	float cpuLitClusterTime  = result.m_directMilliseconds;
+	float cpuLightBounceTime = result.m_bounceMilliseconds + result.m_filterMilliseconds;
+
+	cout << "LightBounceVoxelIrradianceTechnique: lit cluster GPU " << gpuLitClusterTime << "ms, CPU " << cpuLitClusterTime << "ms (" << ((gpuLitClusterTime > 0.0f) ? (cpuLitClusterTime / gpuLitClusterTime) : 0.0f) << "x)" << endl;
+	cout << "LightBounceVoxelIrradianceTechnique: light bounce and filter GPU " << gpuLightBounceTime << "ms, CPU " << cpuLightBounceTime << "ms (" << ((gpuLightBounceTime > 0.0f) ? (cpuLightBounceTime / gpuLightBounceTime) : 0.0f) << "x)" << ((m_sliceVoxelNumber < m_cameraVisibleVoxelNumber) ? ", GPU time of the last slice only" : "") << endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
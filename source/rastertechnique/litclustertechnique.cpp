@@ -34,6 +34,8 @@ limitations under the License.
 #include "../../include/material/materialresetclusterirradiancedata.h"
 #include "../../include/uniformbuffer/uniformbuffer.h"
 #include "../../include/material/materiallitclusterprocessresults.h"
+#include "../../include/rastertechnique/clusterizationinitaabbtechnique.h"
+#include "../../include/util/mathutil.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -65,6 +67,11 @@ LitClusterTechnique::LitClusterTechnique(string &&name, string&& className) : Bu
 	, m_numAddUpElementPerThread(NUM_ADDUP_ELEMENT_PER_THREAD)
 	, m_numAddUpStepThread(0)
 	, m_materialLitCluster(nullptr)
+	, m_incrementalRelight(true)
+	, m_incrementalRelightThreshold(0.5f)
+	, m_litEmitterFrustumValid(false)
+	, m_affectedClusterNumber(0)
+	, m_affectedClusterKnown(false)
 
 	// ResetClusterIrradianceDataTechnique
 	, m_materialResetClusterIrradianceData(nullptr)
@@ -242,7 +249,6 @@ VkCommandBuffer* LitClusterTechnique::record(int currentImage, uint& commandBuff
 	VkCommandBuffer* commandBuffer;
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -258,14 +264,24 @@ VkCommandBuffer* LitClusterTechnique::record(int currentImage, uint& commandBuff
 	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_materialResetClusterIrradianceData->getPipeline()->getPipeline());
 	offsetData = static_cast<uint32_t>(m_materialResetClusterIrradianceData->getMaterialUniformBufferIndex() * dynamicAllignment);
 	vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_materialResetClusterIrradianceData->getPipelineLayout(), 0, 1, &m_materialResetClusterIrradianceData->refDescriptorSet(), 1, &offsetData);
-	vkCmdDispatch(*commandBuffer, m_materialResetClusterIrradianceData->getLocalWorkGroupsXDimension(), m_materialResetClusterIrradianceData->getLocalWorkGroupsYDimension(), 1); // Compute shader global workgroup https://www.khronos.org/registry/vulkan/specs/1.1-extensions/html/vkspec.html
+
+	// vkCmdDispatchBase offsets gl_WorkGroupID, so each workgroup row processes the same elements as in a full dispatch
+	// (elements are indexed by workgroup row, workgroup y * localWorkGroupsXDimension + workgroup x)
+	forIT(m_vectorResetDispatchRange)
+	{
+		vkCmdDispatchBase(*commandBuffer, 0, it->x, 0, m_materialResetClusterIrradianceData->getLocalWorkGroupsXDimension(), it->y, 1);
+	}
 	// LitClusterTechnique record
 
 	// ResetClusterIrradianceDataTechnique record
 	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_materialLitCluster->getPipeline()->getPipeline());
 	offsetData = static_cast<uint32_t>(m_materialLitCluster->getMaterialUniformBufferIndex() * dynamicAllignment);
 	vkCmdBindDescriptorSets(*commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_materialLitCluster->getPipelineLayout(), 0, 1, &m_materialLitCluster->refDescriptorSet(), 1, &offsetData);
-	vkCmdDispatch(*commandBuffer, m_materialLitCluster->getLocalWorkGroupsXDimension(), m_materialLitCluster->getLocalWorkGroupsYDimension(), 1); // Compute shader global workgroup https://www.khronos.org/registry/vulkan/specs/1.1-extensions/html/vkspec.html
+
+	forIT(m_vectorLitClusterDispatchRange)
+	{
+		vkCmdDispatchBase(*commandBuffer, 0, it->x, 0, m_materialLitCluster->getLocalWorkGroupsXDimension(), it->y, 1);
+	}
 	// ResetClusterIrradianceDataTechnique record
 
 	// LitClusterProcessResultsTechnique record
@@ -357,6 +373,11 @@ void LitClusterTechnique::slotClusterizationBuildFinalBufferCompletion()
 	m_voxelShadowMappingCamera->refCameraDirtySignal().connect<LitClusterTechnique, &LitClusterTechnique::slotCameraDirty>(this);
 	// ResetClusterIrradianceDataTechnique
 
+	buildClusterWorldAABB();
+	memcpy(&m_arrayLitEmitterFrustumPlane[0], m_voxelShadowMappingCamera->getArrayFrustumPlane(), 6 * sizeof(vec4));
+	updateRelightDispatchRange(true);
+	m_litEmitterFrustumValid = true;
+
 	// LitClusterProcessResultsTechnique
 	m_materialLitClusterProcessResults->obtainDispatchWorkGroupCount(m_bufferNumElement);
 	m_materialLitClusterProcessResults->setNumCluster(m_bufferNumElement);
@@ -375,6 +396,31 @@ void LitClusterTechnique::slotCameraDirty()
 	// TODO: UPDATE TO USE RESET IRRADIANCE CLUSTER DATA
 	if (m_prefixSumCompleted)
 	{
+		bool fullRelight       = true;
+		m_affectedClusterKnown = false;
+
+		if (m_incrementalRelight && m_litEmitterFrustumValid && !m_techniqueLock)
+		{
+			m_affectedClusterNumber = computeAffectedClusterNumber();
+			m_affectedClusterKnown  = true;
+
+			if (m_affectedClusterNumber == 0)
+			{
+				// No cluster received direct irradiance with the previous emitter values nor will with the new ones,
+				// the lit cluster and light bounce results are still valid
+				return;
+			}
+
+			fullRelight = (float(m_affectedClusterNumber) > (m_incrementalRelightThreshold * float(m_vectorClusterMin.size())));
+		}
+
+		if (updateRelightDispatchRange(fullRelight))
+		{
+			clearRecordedCommandBuffer();
+		}
+
+		memcpy(&m_arrayLitEmitterFrustumPlane[0], m_voxelShadowMappingCamera->getArrayFrustumPlane(), 6 * sizeof(vec4));
+
 		m_cameraPosition  = m_distanceShadowMappingTechnique->getCamera()->getPosition();
 		m_cameraForward   = m_distanceShadowMappingTechnique->getCamera()->getLookAt();
 		m_emitterRadiance = m_distanceShadowMappingTechnique->getEmitterRadiance();
@@ -390,6 +436,158 @@ void LitClusterTechnique::slotCameraDirty()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+uint LitClusterTechnique::computeAffectedClusterNumber()
+{
+	const vec4* arrayCurrentPlane = m_voxelShadowMappingCamera->getArrayFrustumPlane();
+	const uint numCluster         = uint(m_vectorClusterMin.size());
+	uint result                   = 0;
+	m_vectorAffectedCluster.clear();
+
+	forI(numCluster)
+	{
+		if (MathUtil::aabbIntersectsFrustum(arrayCurrentPlane,                   m_vectorClusterMin[i], m_vectorClusterMax[i]) ||
+			MathUtil::aabbIntersectsFrustum(&m_arrayLitEmitterFrustumPlane[0], m_vectorClusterMin[i], m_vectorClusterMax[i]))
+		{
+			m_vectorAffectedCluster.push_back(uint(i));
+			result++;
+		}
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LitClusterTechnique::updateRelightDispatchRange(bool fullRelight)
+{
+	vectorUvec2 vectorResetRange;
+	vectorUvec2 vectorLitClusterRange;
+
+	if (fullRelight)
+	{
+		vectorResetRange.push_back(uvec2(0, m_materialResetClusterIrradianceData->getLocalWorkGroupsYDimension()));
+		vectorLitClusterRange.push_back(uvec2(0, m_materialLitCluster->getLocalWorkGroupsYDimension()));
+	}
+	else
+	{
+		uint resetRowElement      = m_materialResetClusterIrradianceData->getLocalWorkGroupsXDimension() * m_materialResetClusterIrradianceData->getNumThreadPerLocalWorkgroup() * m_materialResetClusterIrradianceData->getNumElementPerLocalWorkgroupThread();
+		uint litClusterRowElement = m_materialLitCluster->getLocalWorkGroupsXDimension() * m_materialLitCluster->getNumThreadPerLocalWorkgroup() * m_materialLitCluster->getNumElementPerLocalWorkgroupThread();
+
+		vectorUint vectorRow;
+		vectorRow.reserve(m_vectorAffectedCluster.size());
+		forIT(m_vectorAffectedCluster)
+		{
+			vectorRow.push_back(*it / resetRowElement);
+		}
+
+		buildDispatchRange(vectorRow, m_materialResetClusterIrradianceData->getLocalWorkGroupsYDimension(), vectorResetRange);
+
+		vectorRow.clear();
+		forIT(m_vectorAffectedCluster)
+		{
+			for (uint i = m_vectorClusterVoxelFirst[*it]; i < m_vectorClusterVoxelFirst[*it + 1]; ++i)
+			{
+				vectorRow.push_back(m_vectorClusterVoxel[i] / litClusterRowElement);
+			}
+		}
+
+		buildDispatchRange(vectorRow, m_materialLitCluster->getLocalWorkGroupsYDimension(), vectorLitClusterRange);
+	}
+
+	bool result = (vectorResetRange != m_vectorResetDispatchRange) || (vectorLitClusterRange != m_vectorLitClusterDispatchRange);
+
+	m_vectorResetDispatchRange      = move(vectorResetRange);
+	m_vectorLitClusterDispatchRange = move(vectorLitClusterRange);
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LitClusterTechnique::buildDispatchRange(vectorUint& vectorRow, uint numRow, vectorUvec2& vectorRange)
+{
+	vectorRange.clear();
+
+	sort(vectorRow.begin(), vectorRow.end());
+	vectorRow.erase(unique(vectorRow.begin(), vectorRow.end()), vectorRow.end());
+	vectorRow.erase(lower_bound(vectorRow.begin(), vectorRow.end(), numRow), vectorRow.end());
+
+	if (vectorRow.size() == 0)
+	{
+		return;
+	}
+
+	// Rows are split in ranges at the biggest gaps between consecutive rows, at most LIT_CLUSTER_MAX_RELIGHT_DISPATCH ranges
+	vector<pair<uint, uint>> vectorGap; // Number of rows in the gap and index in vectorRow of the row after the gap
+	for (uint i = 1; i < uint(vectorRow.size()); ++i)
+	{
+		if (vectorRow[i] > (vectorRow[i - 1] + 1))
+		{
+			vectorGap.push_back(pair<uint, uint>(vectorRow[i] - vectorRow[i - 1] - 1, i));
+		}
+	}
+
+	if (vectorGap.size() >= LIT_CLUSTER_MAX_RELIGHT_DISPATCH)
+	{
+		partial_sort(vectorGap.begin(), vectorGap.begin() + (LIT_CLUSTER_MAX_RELIGHT_DISPATCH - 1), vectorGap.end(), [](const pair<uint, uint>& a, const pair<uint, uint>& b) { return a.first > b.first; });
+		vectorGap.resize(LIT_CLUSTER_MAX_RELIGHT_DISPATCH - 1);
+	}
+
+	vectorUint vectorSplit;
+	forIT(vectorGap)
+	{
+		vectorSplit.push_back(it->second);
+	}
+
+	sort(vectorSplit.begin(), vectorSplit.end());
+	vectorSplit.push_back(uint(vectorRow.size()));
+
+	uint first = 0;
+	forIT(vectorSplit)
+	{
+		vectorRange.push_back(uvec2(vectorRow[first], vectorRow[*it - 1] - vectorRow[first] + 1));
+		first = *it;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LitClusterTechnique::buildClusterWorldAABB()
+{
+	Buffer* clusterizationFinalBuffer = bufferM->getElement(move(string("clusterizationFinalBuffer")));
+
+	vectorUint8 vectorClusterData;
+	clusterizationFinalBuffer->getContentCopy(vectorClusterData);
+	ClusterData* pClusterData = (ClusterData*)(vectorClusterData.data());
+
+	// Cluster aabb are stored in voxelization texture space, one voxel extra is added to the maximum to cover the whole last voxel
+	const vec3 sceneMin  = vec3(m_sceneMin);
+	const vec3 voxelSize = vec3(m_sceneExtentAndVoxelSize) / m_sceneExtentAndVoxelSize.w;
+
+	m_vectorClusterMin.resize(m_bufferNumElement);
+	m_vectorClusterMax.resize(m_bufferNumElement);
+	m_vectorClusterVoxelFirst.resize(m_bufferNumElement + 1);
+	m_vectorClusterVoxel.clear();
+
+	forI(m_bufferNumElement)
+	{
+		m_vectorClusterMin[i] = sceneMin + vec3(pClusterData[i].minAABB) * voxelSize;
+		m_vectorClusterMax[i] = sceneMin + (vec3(pClusterData[i].maxAABB) + vec3(1.0f)) * voxelSize;
+
+		// Number of occupied voxels owned by the cluster is stored in the w field of centerAABB
+		m_vectorClusterVoxelFirst[i] = uint(m_vectorClusterVoxel.size());
+		uint numVoxel                = glm::min(uint(pClusterData[i].centerAABB.w), 256u);
+		forJ(numVoxel)
+		{
+			m_vectorClusterVoxel.push_back(pClusterData[i].arrayVoxels[j]);
+		}
+	}
+
+	m_vectorClusterVoxelFirst[m_bufferNumElement] = uint(m_vectorClusterVoxel.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 /*void LitClusterTechnique::showClassificationData()
 {
 	vectorUint8 m_vectorLitVisibleClusterBuffer;
@@ -50,6 +50,7 @@ RasterTechnique::RasterTechnique(string &&name, string&& className) : GenericRes
 	, m_usedCommandBufferNumber(1)
 	, m_neededSemaphoreNumber(1)
 	, m_rasterTechniqueType(RasterTechniqueType::RTT_GRAPHICS)
+	, m_outputSizeDependent(false)
 	, m_computeHostSynchronize(false)
 {
 	VkSemaphoreCreateInfo semaphoreCreateInfo;
@@ -131,7 +132,7 @@ void RasterTechnique::updateMaterial()
 				material->destroyDescriptorPool();
 				material->buildPipeline(); // add some control in case of errors?
 				material->setReady(true);
-				m_vectorCommand.clear(); // Clear any recorded command buffer, new material makes it mandatory to record again
+				clearRecordedCommandBuffer(); // Clear any recorded command buffer, new material makes it mandatory to record again
 			}
 		}
 
@@ -141,10 +142,13 @@ void RasterTechnique::updateMaterial()
 			material->writeExposedDataToMaterialUB();
 			material->setExposedStructFieldDirty(false);
 		}
-
-		materialM->updateGPUBufferMaterialData(material);
 	}
 
+	// Only the byte ranges of the material cells that changed are written to the GPU buffer
+	materialM->flushMaterialUniformData();
+
+	//BufferVerificationHelper::benchmarkUniformLayout(10000);
+
 	m_needsToRecord = (uint(m_vectorCommand.size()) != m_usedCommandBufferNumber);
 }
 
@@ -157,6 +161,16 @@ void RasterTechnique::postCommandSubmit()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void RasterTechnique::outputResized()
+{
+	if (m_outputSizeDependent || m_isLastPipelineTechnique)
+	{
+		clearRecordedCommandBuffer();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 VkCommandBuffer* RasterTechnique::record(int currentImage, uint& commandBufferID, CommandBufferType& commandBufferType)
 {
 	commandBufferID = 0;
@@ -232,11 +246,25 @@ VkCommandBuffer* RasterTechnique::addRecordedCommandBuffer(uint& commandBufferId
 	uint newId                    = coreM->getNextCommandBufferIndex();
 	commandBufferId               = newId;
 	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
-	bool result                   = addIfNoPresent(move(newId), commandBuffer, m_mapIdCommandBuffer);
+
+	if (m_vectorRecycledCommandBuffer.size() > 0)
+	{
+		commandBuffer = m_vectorRecycledCommandBuffer.back();
+		m_vectorRecycledCommandBuffer.pop_back();
+		VkResult resetResult = vkResetCommandBuffer(commandBuffer, 0);
+		assert(resetResult == VK_SUCCESS);
+	}
+	else
+	{
+		coreM->allocCommandBuffer(&coreM->getLogicalDevice(), (m_rasterTechniqueType == RasterTechniqueType::RTT_GRAPHICS) ? coreM->getGraphicsCommandPool() : coreM->getComputeCommandPool(), &commandBuffer);
+	}
+
+	bool result = addIfNoPresent(move(newId), commandBuffer, m_mapIdCommandBuffer);
 
 	if (!result)
 	{
 		cout << "ERROR in RasterTechnique::addRecordedCommandBuffer, addIfNoPresent returned false" << endl;
+		m_vectorRecycledCommandBuffer.push_back(commandBuffer);
 		return nullptr;
 	}
 
@@ -245,6 +273,28 @@ VkCommandBuffer* RasterTechnique::addRecordedCommandBuffer(uint& commandBufferId
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void RasterTechnique::clearRecordedCommandBuffer()
+{
+	mapUintCommandBuffer::iterator it = m_mapIdCommandBuffer.begin();
+	while (it != m_mapIdCommandBuffer.end())
+	{
+		if (find(m_vectorCommand.begin(), m_vectorCommand.end(), &it->second) != m_vectorCommand.end())
+		{
+			m_vectorRecycledCommandBuffer.push_back(it->second);
+			m_mapUintCommandBufferType.erase(it->first);
+			it = m_mapIdCommandBuffer.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	m_vectorCommand.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 bool RasterTechnique::addCommandBufferQueueType(uint commandBufferId, CommandBufferType commandBufferType)
 {
 	bool result = addIfNoPresent(move(uint(commandBufferId)), commandBufferType, m_mapUintCommandBufferType);
@@ -261,13 +311,23 @@ bool RasterTechnique::addCommandBufferQueueType(uint commandBufferId, CommandBuf
 
 void RasterTechnique::destroyCommandBuffers()
 {
-	mapUintCommandBuffer::const_iterator it;
+	VkCommandPool commandPool = (m_rasterTechniqueType == RasterTechniqueType::RTT_GRAPHICS) ? coreM->getGraphicsCommandPool() : coreM->getComputeCommandPool();
+
+	mapUintCommandBuffer::iterator it;
 	for (it = m_mapIdCommandBuffer.begin(); it != m_mapIdCommandBuffer.end(); ++it)
 	{
-		vkFreeCommandBuffers(coreM->getLogicalDevice(), (m_rasterTechniqueType == RasterTechniqueType::RTT_GRAPHICS) ? coreM->getGraphicsCommandPool() : coreM->getComputeCommandPool(), 1, &it->second);
+		CoreManager::freeCommandBuffer(&coreM->getLogicalDevice(), commandPool, &it->second);
+	}
+
+	forIT(m_vectorRecycledCommandBuffer)
+	{
+		CoreManager::freeCommandBuffer(&coreM->getLogicalDevice(), commandPool, &(*it));
 	}
 
 	m_mapIdCommandBuffer.clear();
+	m_mapUintCommandBufferType.clear();
+	m_vectorRecycledCommandBuffer.clear();
+	m_vectorCommand.clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,7 +338,7 @@ void RasterTechnique::addExecutionTime()
 	return;
 #endif
 
-	if ((m_queryIndex0 == UINT_MAX) || (m_queryIndex1 == UINT_MAX))
+	if ((m_queryIndex0 == UINT_MAX) || (m_queryIndex1 == UINT_MAX) || (m_mapUintCommandBufferType.size() == 0))
 	{
 		return;
 	}
@@ -48,6 +48,8 @@ RasterTechniqueManager::~RasterTechniqueManager()
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@ SceneIndirectDrawTechnique::SceneIndirectDrawTechnique(string &&name, string&& c
 	, m_renderPass(nullptr)
 	, m_framebuffer(nullptr)
 {
+	m_outputSizeDependent = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,7 +97,6 @@ VkCommandBuffer* SceneIndirectDrawTechnique::record(int currentImage, uint& comm
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
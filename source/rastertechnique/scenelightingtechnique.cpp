@@ -57,7 +57,8 @@ SceneLightingTechnique::SceneLightingTechnique(string &&name, string&& className
 	, m_framebuffer(nullptr)
 	, m_indirectCommandBufferMainCamera(nullptr)
 {
-	m_active = false;
+	m_active              = false;
+	m_outputSizeDependent = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +107,17 @@ void SceneLightingTechnique::init()
 
 	generateLightingMaterials();
 
+	// Resolve once the per node lighting material handles and scene indices used at record time
+	m_arrayNodeMaterialHandle.resize(m_arrayNode.size());
+	m_arrayNodeSceneIndex.resize(m_arrayNode.size());
+	forI(m_arrayNode.size())
+	{
+		m_arrayNodeMaterialHandle[i] = materialM->getElementHandle(m_arrayNode[i]->refMaterial()->getName() + m_lightingMaterialSuffix);
+		m_arrayNodeSceneIndex[i]     = uint(sceneM->getElementIndex(m_arrayNode[i]));
+	}
+
+	//BufferVerificationHelper::benchmarkRecordHandleLookup(10000, 10);
+
 	inputM->refEventSinglePressSignalSlot().addKeyDownSignal(KeyCode::KEY_CODE_1);
 	signalAdd = inputM->refEventSinglePressSignalSlot().refKeyDownSignalByKey(KeyCode::KEY_CODE_1);
 	signalAdd->connect<SceneLightingTechnique, &SceneLightingTechnique::slot1KeyPressed>(this);
@@ -157,7 +169,6 @@ VkCommandBuffer* SceneLightingTechnique::record(int currentImage, uint& commandB
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -184,23 +195,17 @@ VkCommandBuffer* SceneLightingTechnique::record(int currentImage, uint& commandB
 	gpuPipelineM->initViewports((float)coreM->getWidth(), (float)coreM->getHeight(), 0.0f, 0.0f, 0.0f, 1.0f, commandBuffer);
 	gpuPipelineM->initScissors(coreM->getWidth(), coreM->getHeight(), 0, 0, commandBuffer);
 
-	uint dynamicAllignment = materialM->getMaterialUBDynamicAllignment();
+	uint dynamicAllignment         = materialM->getMaterialUBDynamicAllignment();
+	uint32_t sceneDataBufferOffset = static_cast<uint32_t>(gpuPipelineM->getSceneUniformData()->getDynamicAllignment());
 
 	forI(m_arrayNode.size())
 	{
-		string materialName = m_arrayNode[i]->refMaterial()->getName();
-		materialName       += m_lightingMaterialSuffix;
-		Material* currentMaterial  = materialM->getElement(move(materialName));
+		Material* currentMaterial = materialM->getElementByHandle(m_arrayNodeMaterialHandle[i]);
 
 		vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, currentMaterial->getPipeline()->getPipeline()); // Bound the command buffer with the graphics pipeline
 
-		uint32_t elementIndex;
 		uint32_t offsetData[3];
-		uint32_t sceneDataBufferOffset = static_cast<uint32_t>(gpuPipelineM->getSceneUniformData()->getDynamicAllignment());
-
-		elementIndex = sceneM->getElementIndex(m_arrayNode[i]);
-
-		offsetData[0] = elementIndex * sceneDataBufferOffset;
+		offsetData[0] = m_arrayNodeSceneIndex[i] * sceneDataBufferOffset;
 		//offsetData[0] = i * sceneDataBufferOffset;
 		offsetData[1] = 0;
 		offsetData[2] = static_cast<uint32_t>(currentMaterial->getMaterialUniformBufferIndex() * dynamicAllignment);
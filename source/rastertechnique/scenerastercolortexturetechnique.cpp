@@ -53,6 +53,7 @@ SceneRasterColorTextureTechnique::SceneRasterColorTextureTechnique(string &&name
 	, m_renderPass(nullptr)
 	, m_framebuffer(nullptr)
 {
+	m_outputSizeDependent = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,7 +115,6 @@ VkCommandBuffer* SceneRasterColorTextureTechnique::record(int currentImage, uint
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
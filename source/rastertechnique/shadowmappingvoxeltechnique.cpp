@@ -31,6 +31,8 @@ limitations under the License.
 #include "../../include/renderpass/renderpass.h"
 #include "../../include/parameter/attributedefines.h"
 #include "../../include/parameter/attributedata.h"
+#include "../../include/texture/texture.h"
+#include "../../include/texture/texturemanager.h"
 #include "../../include/framebuffer/framebuffer.h"
 #include "../../include/framebuffer/framebuffermanager.h"
 #include "../../include/camera/camera.h"
@@ -57,8 +59,8 @@ ShadowMappingVoxelTechnique::ShadowMappingVoxelTechnique(string &&name, string&&
 	, m_material(nullptr)
 	, m_shadowMappingCamera(nullptr)
 	, m_shadowMappingTexture(nullptr)
-	, m_shadowMapWidth(2048)
-	, m_shadowMapHeight(2048)
+	, m_shadowMapWidth(SHADOW_MAPPING_VOXEL_SIZE)
+	, m_shadowMapHeight(SHADOW_MAPPING_VOXEL_SIZE)
 	, m_numUsedVertex(0)
 	, m_prefixSumCompleted(false)
 	, m_newPassRequested(false)
@@ -82,35 +84,17 @@ void ShadowMappingVoxelTechnique::init()
 	m_shadowMappingCamera = cameraM->getElement(move(string("emitter")));
 	m_shadowMappingCamera->refCameraDirtySignal().connect<ShadowMappingVoxelTechnique, &ShadowMappingVoxelTechnique::slotCameraDirty>(this);
 
-	m_shadowMappingTexture = textureM->buildTexture(
-		move(string("shadowmappingvoxeltexture")),
-		VK_FORMAT_R16_SFLOAT,
-		{ uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight), uint32_t(1) },
-		VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-		VK_IMAGE_ASPECT_COLOR_BIT,
-		VK_IMAGE_ASPECT_COLOR_BIT,
-		VK_IMAGE_LAYOUT_UNDEFINED,
-		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		VK_IMAGE_VIEW_TYPE_2D,
-		0);
-
-	m_offscreenDepthTexture = textureM->buildTexture(
-		move(string("shadowmappingvoxeldepthtexture")),
-		VK_FORMAT_D16_UNORM,
-		{ uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapWidth), uint32_t(1) },
-		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
-		VK_IMAGE_ASPECT_DEPTH_BIT,
-		VK_IMAGE_ASPECT_DEPTH_BIT,
-		VK_IMAGE_LAYOUT_UNDEFINED,
-		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		VK_SAMPLE_COUNT_1_BIT,
-		VK_IMAGE_TILING_OPTIMAL,
-		VK_IMAGE_VIEW_TYPE_2D,
-		0);
+	// The voxel shadow map is a region of a shadow atlas page, and the depth attachment is the atlas depth scratch
+	// texture shared with the other shadow casting passes
+	ShadowAtlas& shadowAtlas = textureM->refShadowAtlas();
+	if (!shadowAtlas.allocateRegion(move(string("shadowmappingvoxeltexture")), VK_FORMAT_R16_SFLOAT, uint(m_shadowMapWidth), uint(m_shadowMapHeight), m_atlasRegion))
+	{
+		cout << "ERROR: no shadow atlas region could be allocated in ShadowMappingVoxelTechnique::init" << endl;
+		return;
+	}
+
+	m_shadowMappingTexture  = m_atlasRegion.m_texture;
+	m_offscreenDepthTexture = shadowAtlas.getDepthScratchTexture(VK_FORMAT_D16_UNORM);
 
 	VkPipelineBindPoint* pipelineBindPoint = new VkPipelineBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
 
@@ -151,7 +135,8 @@ void ShadowMappingVoxelTechnique::init()
 	vector<string> arrayAttachment;
 	arrayAttachment.push_back(m_shadowMappingTexture->getName());
 	arrayAttachment.push_back(m_offscreenDepthTexture->getName());
-	m_framebuffer = framebufferM->buildFramebuffer(move(string("shadowmappingvoxelFB")), (uint32_t)(m_shadowMapWidth), (uint32_t)(m_shadowMapHeight), move(string(m_renderPass->getName())), move(arrayAttachment));
+	const uint32_t pageSize = uint32_t(shadowAtlas.getPageSize());
+	m_framebuffer = framebufferM->buildFramebuffer(move(string("shadowmappingvoxelFB")), pageSize, pageSize, move(string(m_renderPass->getName())), move(arrayAttachment));
 
 	BuildVoxelShadowMapGeometryTechnique* techniqueVoxelShadowMapGeometryTechnique = static_cast<BuildVoxelShadowMapGeometryTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("BuildVoxelShadowMapGeometryTechnique"))));
 	techniqueVoxelShadowMapGeometryTechnique->refSignalBuildVoxelShadowMapGeometryCompletion().connect<ShadowMappingVoxelTechnique, &ShadowMappingVoxelTechnique::slotPrefixSumCompleted>(this);
@@ -175,7 +160,6 @@ VkCommandBuffer* ShadowMappingVoxelTechnique::record(int currentImage, uint& com
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -186,7 +170,7 @@ VkCommandBuffer* ShadowMappingVoxelTechnique::record(int currentImage, uint& com
 	VkRenderPassBeginInfo renderPassBegin = VulkanStructInitializer::renderPassBeginInfo(
 		m_renderPass->getRenderPass(),
 		m_framebuffer->getFramebuffer(),
-		VkRect2D({ 0, 0, uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight) }),
+		VkRect2D({ int32_t(m_atlasRegion.m_rectangle.x), int32_t(m_atlasRegion.m_rectangle.y), uint32_t(m_shadowMapWidth), uint32_t(m_shadowMapHeight) }),
 		m_material->refVectorClearValue());
 
 	vkCmdBeginRenderPass(*commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE); // Start recording the render pass instance
@@ -196,8 +180,8 @@ VkCommandBuffer* ShadowMappingVoxelTechnique::record(int currentImage, uint& com
 
 	vkCmdBindPipeline(*commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_material->getPipeline()->getPipeline());
 
-	gpuPipelineM->initViewports((float)m_shadowMapWidth, (float)m_shadowMapHeight, 0.0f, 0.0f, 0.0f, 1.0f, commandBuffer);
-	gpuPipelineM->initScissors(m_shadowMapWidth, m_shadowMapHeight, 0, 0, commandBuffer);
+	gpuPipelineM->initViewports((float)m_shadowMapWidth, (float)m_shadowMapHeight, float(m_atlasRegion.m_rectangle.x), float(m_atlasRegion.m_rectangle.y), 0.0f, 1.0f, commandBuffer);
+	gpuPipelineM->initScissors(m_shadowMapWidth, m_shadowMapHeight, int(m_atlasRegion.m_rectangle.x), int(m_atlasRegion.m_rectangle.y), commandBuffer);
 
 	float depthBiasConstant = 1.25f;
 	float depthBiasSlope = 1.75f;
@@ -144,7 +144,6 @@ VkCommandBuffer* VoxelFacePenaltyTechnique::record(int currentImage, uint& comma
 	VkCommandBuffer* commandBuffer;
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getComputeCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -220,7 +219,7 @@ void VoxelFacePenaltyTechnique::ClusterVisiblePrefixSum()
 {
 	if (m_prefixSumCompleted)
 	{
-		m_vectorCommand.clear();
+		clearRecordedCommandBuffer();
 		m_active = true;
 	}
 }
@@ -48,7 +48,8 @@ VoxelRasterInScenarioTechnique::VoxelRasterInScenarioTechnique(string &&name, st
 	, m_renderPass(nullptr)
 	, m_framebuffer(nullptr)
 {
-	m_active = false;
+	m_active              = false;
+	m_outputSizeDependent = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,7 +147,6 @@ VkCommandBuffer* VoxelRasterInScenarioTechnique::record(int currentImage, uint&
 	VkCommandBuffer* commandBuffer;
 	commandBuffer = addRecordedCommandBuffer(commandBufferID);
 	addCommandBufferQueueType(commandBufferID, commandBufferType);
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), commandBuffer);
 
 	coreM->beginCommandBuffer(*commandBuffer);
 
@@ -51,6 +51,8 @@ void RenderPassManager::destroyResources()
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
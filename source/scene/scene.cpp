@@ -27,6 +27,7 @@ limitations under the License.
 #include "../../include/camera/cameramanager.h"
 #include "../../include/shader/shadermanager.h"
 #include "../../include/core/coremanager.h"
+#include "../../include/texture/texturemanager.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -127,6 +128,8 @@ bool Scene::init()
 
 	// Scene raster settings
 	gpuPipelineM->addRasterFlag(move(string("CLUSTER_VISIBILITY_USE_SHADOW_MAP")), 0);
+	gpuPipelineM->addRasterFlag(move(string("LIGHT_BOUNCE_VOXEL_FACE_BUDGET_PER_FRAME")), 98304); // A value of 0 processes all the camera visible voxels in a single frame
+	gpuPipelineM->addRasterFlag(move(string("LIGHT_BOUNCE_TEMPORAL_BLEND")), 100); // This value is divided by 100, weight of the new light bounce results, 100 disables the temporal blend
 
 	// TODO: Initialize somewhere else and add the real defined values of the variables
 	shaderM->addGlobalHeaderSourceCode(move(string("#version 450\n\n")));
@@ -169,6 +172,9 @@ bool Scene::init()
 	shaderM->addGlobalHeaderSourceCode(move(string("#define IRRADIANCE_FIELD_GRADIENT_OFFSET 0.1\n")));
 	shaderM->addGlobalHeaderSourceCode(move(string("/////////////////////////////////////////////////////////////\n\n")));
 
+	// Scene textures are decoded and uploaded together once the whole scene has been loaded
+	textureM->beginTextureUploadBatch();
+
 	gpuPipelineM->preSceneLoadResources();
 
 	Model* model = new Model(m_scenePath, m_sceneName, true, true);
@@ -182,6 +188,8 @@ bool Scene::init()
 
 	delete model;
 
+	textureM->endTextureUploadBatch();
+
 	// Force update of aabb to have the data ready for the instance of SceneVoxelizationTechnique
 	update();
 
@@ -189,6 +197,8 @@ bool Scene::init()
 
 	cameraM->setAsMainCamera(m_sceneCamera);
 	cameraM->loadCameraRecordingData();
+	cameraM->loadCameraPathData();
+	inputM->loadInputScript("../data/scenes/temp/" + m_sceneName + "_input_script");
 
 	return true;
 }
@@ -198,9 +208,32 @@ bool Scene::init()
 void Scene::update()
 {
 	// TODO: Update the scene following a target amount of times per sencod, right now is dependent on the framerate
-	forIT(m_model)
+	m_vectorRefitElementIndex.clear();
+
+	if (!m_sceneBVH.isBuiltFor(uint(m_model.size())))
 	{
-		(*it)->prepare(m_deltaTime);
+		forIT(m_model)
+		{
+			(*it)->prepare(m_deltaTime);
+		}
+
+		m_sceneBVH.build(m_model, E_MT_RENDER_MODEL | E_MT_EMITTER_MODEL);
+	}
+	else
+	{
+		// Only the elements whose transform changed have their bounding box refitted, together with the BVH path to the root
+		const uint maxIndex = uint(m_model.size());
+		forI(maxIndex)
+		{
+			bool transformDirty = m_model[i]->refTransform().getDirty();
+			m_model[i]->prepare(m_deltaTime);
+
+			if (transformDirty)
+			{
+				m_sceneBVH.refit(int(i));
+				m_vectorRefitElementIndex.push_back(i);
+			}
+		}
 	}
 
 	forIT(m_lightVolumes)
@@ -224,6 +257,30 @@ void Scene::update()
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+Node* Scene::raycastElement(const vec3& origin, const vec3& direction, float& distance) const
+{
+	int elementIndex = m_sceneBVH.raycast(origin, direction, distance);
+	return (elementIndex != -1) ? m_model[elementIndex] : nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+vectorNodePtr Scene::getElementInRadius(const vec3& center, float radius) const
+{
+	vectorInt vectorElementIndex;
+	m_sceneBVH.querySphere(center, radius, vectorElementIndex);
+
+	vectorNodePtr vectorResult(vectorElementIndex.size());
+	forI(vectorElementIndex.size())
+	{
+		vectorResult[i] = m_model[vectorElementIndex[i]];
+	}
+
+	return vectorResult;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void Scene::shutdown()
 {
 	this->~Scene();
@@ -292,7 +349,23 @@ int Scene::getElementIndexByName(string&& name)
 
 int Scene::getElementIndex(Node* node)
 {
-	return findElementIndex(m_model, node);
+	unordered_map<const Node*, int>::iterator it = m_mapNodeIndex.find(node);
+
+	if ((it != m_mapNodeIndex.end()) && (it->second < int(m_model.size())) && (m_model[it->second] == node))
+	{
+		return it->second;
+	}
+
+	// m_model can be modified through refModel, rebuild the map once and look for the node again
+	m_mapNodeIndex.clear();
+	const int maxIndex = int(m_model.size());
+	forI(maxIndex)
+	{
+		m_mapNodeIndex.insert(pair<const Node*, int>(m_model[i], i));
+	}
+
+	it = m_mapNodeIndex.find(node);
+	return (it != m_mapNodeIndex.end()) ? it->second : -1;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,443 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/scene/scenebvh.h"
+#include "../../include/node/node.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+SceneBVH::SceneBVH()
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::build(const vectorNodePtr& vectorNode, uint meshType)
+{
+	clear();
+
+	m_vectorNode = vectorNode;
+	m_vectorElementLeaf.resize(vectorNode.size(), -1);
+	m_vectorCentroid.resize(vectorNode.size());
+
+	forI(vectorNode.size())
+	{
+		m_vectorCentroid[i] = vectorNode[i]->getBBox().getCenter();
+
+		if (vectorNode[i]->getMeshType() & meshType)
+		{
+			m_vectorPrimitive.push_back(int(i));
+		}
+	}
+
+	if (m_vectorPrimitive.size() == 0)
+	{
+		return;
+	}
+
+	// A binary tree with leaves of at least one primitive has less than twice the number of primitives nodes
+	m_vectorBVHNode.reserve(2 * m_vectorPrimitive.size());
+	buildRecursive(0, int(m_vectorPrimitive.size()), -1);
+	m_vectorCentroid.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::refit(int elementIndex)
+{
+	if ((elementIndex < 0) || (elementIndex >= int(m_vectorElementLeaf.size())) || (m_vectorElementLeaf[elementIndex] == -1))
+	{
+		return;
+	}
+
+	int bvhNodeIndex = m_vectorElementLeaf[elementIndex];
+
+	while (bvhNodeIndex != -1)
+	{
+		SceneBVHNode& bvhNode = m_vectorBVHNode[bvhNodeIndex];
+		vec3 previousMin      = bvhNode.m_min;
+		vec3 previousMax      = bvhNode.m_max;
+
+		computeBounds(bvhNodeIndex);
+
+		// The leaf always has to be updated, the ancestors only while their bounds keep changing
+		if ((bvhNode.m_count == 0) && (previousMin == bvhNode.m_min) && (previousMax == bvhNode.m_max))
+		{
+			break;
+		}
+
+		bvhNodeIndex = bvhNode.m_parent;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::clear()
+{
+	m_vectorNode.clear();
+	m_vectorBVHNode.clear();
+	m_vectorPrimitive.clear();
+	m_vectorElementLeaf.clear();
+	m_vectorCentroid.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::queryBox(const vec3& min, const vec3& max, vectorInt& vectorResult) const
+{
+	if (m_vectorBVHNode.size() == 0)
+	{
+		return;
+	}
+
+	int stack[SCENE_BVH_MAX_STACK_DEPTH];
+	int stackSize      = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const SceneBVHNode& bvhNode = m_vectorBVHNode[stack[--stackSize]];
+
+		if (glm::any(glm::lessThan(bvhNode.m_max, min)) || glm::any(glm::greaterThan(bvhNode.m_min, max)))
+		{
+			continue;
+		}
+
+		if (bvhNode.m_count > 0)
+		{
+			forI(bvhNode.m_count)
+			{
+				int elementIndex = m_vectorPrimitive[bvhNode.m_left + i];
+				const BBox3D& box = m_vectorNode[elementIndex]->getBBox();
+
+				if (!glm::any(glm::lessThan(box.getMax(), min)) && !glm::any(glm::greaterThan(box.getMin(), max)))
+				{
+					vectorResult.push_back(elementIndex);
+				}
+			}
+		}
+		else
+		{
+			stack[stackSize++] = bvhNode.m_left;
+			stack[stackSize++] = bvhNode.m_right;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::querySphere(const vec3& center, float radius, vectorInt& vectorResult) const
+{
+	if (m_vectorBVHNode.size() == 0)
+	{
+		return;
+	}
+
+	float radiusSquared = radius * radius;
+
+	int stack[SCENE_BVH_MAX_STACK_DEPTH];
+	int stackSize      = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const SceneBVHNode& bvhNode = m_vectorBVHNode[stack[--stackSize]];
+
+		vec3 closest = glm::clamp(center, bvhNode.m_min, bvhNode.m_max);
+		if (glm::distance2(closest, center) > radiusSquared)
+		{
+			continue;
+		}
+
+		if (bvhNode.m_count > 0)
+		{
+			forI(bvhNode.m_count)
+			{
+				int elementIndex  = m_vectorPrimitive[bvhNode.m_left + i];
+				const BBox3D& box = m_vectorNode[elementIndex]->getBBox();
+
+				closest = glm::clamp(center, box.getMin(), box.getMax());
+				if (glm::distance2(closest, center) <= radiusSquared)
+				{
+					vectorResult.push_back(elementIndex);
+				}
+			}
+		}
+		else
+		{
+			stack[stackSize++] = bvhNode.m_left;
+			stack[stackSize++] = bvhNode.m_right;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+int SceneBVH::raycast(const vec3& origin, const vec3& direction, float& distance) const
+{
+	distance   = FLT_MAX;
+	int result = -1;
+
+	if (m_vectorBVHNode.size() == 0)
+	{
+		return result;
+	}
+
+	vec3 inverseDirection = vec3(1.0f) / direction;
+	float entryDistance;
+
+	if (!rayBoxIntersection(origin, inverseDirection, m_vectorBVHNode[0].m_min, m_vectorBVHNode[0].m_max, entryDistance))
+	{
+		return result;
+	}
+
+	int stack[SCENE_BVH_MAX_STACK_DEPTH];
+	float stackDistance[SCENE_BVH_MAX_STACK_DEPTH];
+	int stackSize              = 0;
+	stack[stackSize]           = 0;
+	stackDistance[stackSize++] = entryDistance;
+
+	while (stackSize > 0)
+	{
+		--stackSize;
+		if (stackDistance[stackSize] > distance)
+		{
+			continue;
+		}
+
+		const SceneBVHNode& bvhNode = m_vectorBVHNode[stack[stackSize]];
+
+		if (bvhNode.m_count > 0)
+		{
+			forI(bvhNode.m_count)
+			{
+				int elementIndex = m_vectorPrimitive[bvhNode.m_left + i];
+				if (raycastElement(elementIndex, origin, direction, distance))
+				{
+					result = elementIndex;
+				}
+			}
+
+			continue;
+		}
+
+		float distanceLeft;
+		float distanceRight;
+		const SceneBVHNode& left  = m_vectorBVHNode[bvhNode.m_left];
+		const SceneBVHNode& right = m_vectorBVHNode[bvhNode.m_right];
+		bool hitLeft              = rayBoxIntersection(origin, inverseDirection, left.m_min,  left.m_max,  distanceLeft)  && (distanceLeft  <= distance);
+		bool hitRight             = rayBoxIntersection(origin, inverseDirection, right.m_min, right.m_max, distanceRight) && (distanceRight <= distance);
+
+		// Push the farthest child first so the closest one is visited next
+		if (hitLeft && hitRight && (distanceLeft < distanceRight))
+		{
+			stack[stackSize]           = bvhNode.m_right;
+			stackDistance[stackSize++] = distanceRight;
+			stack[stackSize]           = bvhNode.m_left;
+			stackDistance[stackSize++] = distanceLeft;
+		}
+		else
+		{
+			if (hitLeft)
+			{
+				stack[stackSize]           = bvhNode.m_left;
+				stackDistance[stackSize++] = distanceLeft;
+			}
+			if (hitRight)
+			{
+				stack[stackSize]           = bvhNode.m_right;
+				stackDistance[stackSize++] = distanceRight;
+			}
+		}
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneBVH::isBuiltFor(uint numElement) const
+{
+	return (m_vectorElementLeaf.size() == numElement);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+int SceneBVH::buildRecursive(int first, int count, int parent)
+{
+	int bvhNodeIndex = int(m_vectorBVHNode.size());
+	m_vectorBVHNode.push_back(SceneBVHNode({ vec3(0.0f), vec3(0.0f), parent, first, -1, count }));
+
+	if (count <= SCENE_BVH_LEAF_SIZE)
+	{
+		forI(count)
+		{
+			m_vectorElementLeaf[m_vectorPrimitive[first + i]] = bvhNodeIndex;
+		}
+
+		computeBounds(bvhNodeIndex);
+		return bvhNodeIndex;
+	}
+
+	// Split at the median of the centroids along the axis where they spread the most
+	vec3 centroidMin = m_vectorCentroid[m_vectorPrimitive[first]];
+	vec3 centroidMax = centroidMin;
+	forI(count)
+	{
+		centroidMin = glm::min(centroidMin, m_vectorCentroid[m_vectorPrimitive[first + i]]);
+		centroidMax = glm::max(centroidMax, m_vectorCentroid[m_vectorPrimitive[first + i]]);
+	}
+
+	vec3 spread = centroidMax - centroidMin;
+	int axis    = ((spread.x >= spread.y) && (spread.x >= spread.z)) ? 0 : ((spread.y >= spread.z) ? 1 : 2);
+	int half    = count / 2;
+
+	const vectorVec3& vectorCentroid = m_vectorCentroid;
+	nth_element(m_vectorPrimitive.begin() + first, m_vectorPrimitive.begin() + first + half, m_vectorPrimitive.begin() + first + count,
+		[&vectorCentroid, axis](int a, int b) { return vectorCentroid[a][axis] < vectorCentroid[b][axis]; });
+
+	int left  = buildRecursive(first, half, bvhNodeIndex);
+	int right = buildRecursive(first + half, count - half, bvhNodeIndex);
+
+	// m_vectorBVHNode may have been reallocated by the recursive calls
+	m_vectorBVHNode[bvhNodeIndex].m_left  = left;
+	m_vectorBVHNode[bvhNodeIndex].m_right = right;
+	m_vectorBVHNode[bvhNodeIndex].m_count = 0;
+	computeBounds(bvhNodeIndex);
+
+	return bvhNodeIndex;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void SceneBVH::computeBounds(int bvhNodeIndex)
+{
+	SceneBVHNode& bvhNode = m_vectorBVHNode[bvhNodeIndex];
+
+	if (bvhNode.m_count > 0)
+	{
+		const BBox3D& first = m_vectorNode[m_vectorPrimitive[bvhNode.m_left]]->getBBox();
+		bvhNode.m_min = first.getMin();
+		bvhNode.m_max = first.getMax();
+
+		forIFrom(1, bvhNode.m_count)
+		{
+			const BBox3D& box = m_vectorNode[m_vectorPrimitive[bvhNode.m_left + i]]->getBBox();
+			bvhNode.m_min = glm::min(bvhNode.m_min, box.getMin());
+			bvhNode.m_max = glm::max(bvhNode.m_max, box.getMax());
+		}
+	}
+	else
+	{
+		const SceneBVHNode& left  = m_vectorBVHNode[bvhNode.m_left];
+		const SceneBVHNode& right = m_vectorBVHNode[bvhNode.m_right];
+		bvhNode.m_min             = glm::min(left.m_min, right.m_min);
+		bvhNode.m_max             = glm::max(left.m_max, right.m_max);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneBVH::rayBoxIntersection(const vec3& origin, const vec3& inverseDirection, const vec3& min, const vec3& max, float& distance)
+{
+	vec3 t0    = (min - origin) * inverseDirection;
+	vec3 t1    = (max - origin) * inverseDirection;
+	vec3 tNear = glm::min(t0, t1);
+	vec3 tFar  = glm::max(t0, t1);
+
+	float entry = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f));
+	float exit  = glm::min(glm::min(tFar.x, tFar.y), tFar.z);
+	distance    = entry;
+
+	return (entry <= exit);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SceneBVH::raycastElement(int elementIndex, const vec3& origin, const vec3& direction, float& distance) const
+{
+	Node* node                 = m_vectorNode[elementIndex];
+	const vectorUint& indices  = node->refIndices();
+	const vectorVec3& vertices = node->refVertices();
+	bool result                = false;
+
+	// The ray is moved to object space without normalizing its direction, so the distance parameter is the same in both spaces
+	mat4 inverseModel    = inverse(node->getModelMat());
+	vec3 originLocal     = vec3(inverseModel * vec4(origin, 1.0f));
+	vec3 directionLocal  = vec3(inverseModel * vec4(direction, 0.0f));
+	uint maxIndex        = uint(indices.size()) - (uint(indices.size()) % 3);
+	uint numVertex       = uint(vertices.size());
+
+	for (uint i = 0; i < maxIndex; i += 3)
+	{
+		if ((indices[i] >= numVertex) || (indices[i + 1] >= numVertex) || (indices[i + 2] >= numVertex))
+		{
+			continue;
+		}
+
+		// Moller-Trumbore ray triangle intersection
+		const vec3& v0 = vertices[indices[i]];
+		vec3 edge0     = vertices[indices[i + 1]] - v0;
+		vec3 edge1     = vertices[indices[i + 2]] - v0;
+		vec3 p         = cross(directionLocal, edge1);
+		float det      = dot(edge0, p);
+
+		if (glm::abs(det) < FLT_EPSILON)
+		{
+			continue;
+		}
+
+		float inverseDet = 1.0f / det;
+		vec3 s           = originLocal - v0;
+		float u          = dot(s, p) * inverseDet;
+
+		if ((u < 0.0f) || (u > 1.0f))
+		{
+			continue;
+		}
+
+		vec3 q  = cross(s, edge0);
+		float v = dot(directionLocal, q) * inverseDet;
+
+		if ((v < 0.0f) || ((u + v) > 1.0f))
+		{
+			continue;
+		}
+
+		float t = dot(edge1, q) * inverseDet;
+
+		if ((t > 0.0f) && (t < distance))
+		{
+			distance = t;
+			result   = true;
+		}
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +342,11 @@ bool Shader::textureResourceNotification(vectorSamplerPtr& vectorResource, strin
 			builtCondition = true;
 			break;
 		}
+		default:
+		{
+			// Resized textures keep their samplers, the descriptor sets using them are updated by TextureManager::resizeTexture
+			return false;
+		}
 	}
 
 	uint maxIndex = uint(vectorResource.size());
@@ -0,0 +1,87 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/shader/uniformlayout.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+UniformLayout::UniformLayout():
+	m_size(0)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void UniformLayout::build(const vector<ExposedStructField>& vectorExposedStructField)
+{
+	clear();
+
+	m_vectorField.resize(vectorExposedStructField.size());
+
+	forI(vectorExposedStructField.size())
+	{
+		m_vectorField[i].m_source = static_cast<const uint8_t*>(vectorExposedStructField[i].getData());
+		m_vectorField[i].m_offset = m_size;
+		m_vectorField[i].m_size   = vectorExposedStructField[i].getSize();
+		m_size                   += m_vectorField[i].m_size;
+	}
+
+	m_data.resize(m_size, 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void UniformLayout::clear()
+{
+	m_vectorField.clear();
+	m_data.clear();
+	m_size = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool UniformLayout::update(vectorUint& vectorDirtyField)
+{
+	bool result = false;
+
+	forI(m_vectorField.size())
+	{
+		const UniformLayoutField& field = m_vectorField[i];
+		uint8_t* destination            = m_data.data() + field.m_offset;
+
+		if (memcmp(destination, field.m_source, field.m_size) != 0)
+		{
+			memcpy(destination, field.m_source, field.m_size);
+			vectorDirtyField.push_back(i);
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
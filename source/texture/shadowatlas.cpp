@@ -0,0 +1,172 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/texture/shadowatlas.h"
+#include "../../include/texture/texture.h"
+#include "../../include/texture/texturemanager.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ShadowAtlas::ShadowAtlas() :
+	  m_pageSize(SHADOW_ATLAS_PAGE_SIZE)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ShadowAtlas::allocateRegion(string&& pageName, VkFormat format, uint width, uint height, ShadowAtlasRegion& region)
+{
+	if ((width == 0) || (height == 0) || (width > m_pageSize) || (height > m_pageSize))
+	{
+		cout << "ERROR: region of size " << width << "x" << height << " doesn't fit in a shadow atlas page in ShadowAtlas::allocateRegion" << endl;
+		return false;
+	}
+
+	uvec2 offset;
+	ShadowAtlasPage* page = nullptr;
+
+	forIT(m_vectorPage)
+	{
+		if ((it->m_format == format) && placeRegion(*it, width, height, offset))
+		{
+			page = &(*it);
+			break;
+		}
+	}
+
+	if (page == nullptr)
+	{
+		if (textureM->existsElement(move(string(pageName))))
+		{
+			cout << "ERROR: texture " << pageName << " already exists in ShadowAtlas::allocateRegion" << endl;
+			return false;
+		}
+
+		ShadowAtlasPage newPage;
+		newPage.m_format      = format;
+		newPage.m_shelfX      = 0;
+		newPage.m_shelfY      = 0;
+		newPage.m_shelfHeight = 0;
+		newPage.m_texture     = textureM->buildTexture(
+			move(string(pageName)),
+			format,
+			{ uint32_t(m_pageSize), uint32_t(m_pageSize), uint32_t(1) },
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+			VK_IMAGE_ASPECT_COLOR_BIT,
+			VK_IMAGE_ASPECT_COLOR_BIT,
+			VK_IMAGE_LAYOUT_UNDEFINED,
+			VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			VK_SAMPLE_COUNT_1_BIT,
+			VK_IMAGE_TILING_OPTIMAL,
+			VK_IMAGE_VIEW_TYPE_2D,
+			0);
+
+		m_vectorPage.push_back(newPage);
+		page = &m_vectorPage.back();
+		placeRegion(*page, width, height, offset);
+	}
+
+	const float pageSize = float(m_pageSize);
+
+	region.m_texture     = page->m_texture;
+	region.m_rectangle   = uvec4(offset.x, offset.y, width, height);
+	region.m_scaleOffset = vec4(float(width) / pageSize, float(height) / pageSize, float(offset.x) / pageSize, float(offset.y) / pageSize);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+Texture* ShadowAtlas::getDepthScratchTexture(VkFormat format)
+{
+	forIT(m_vectorDepthScratch)
+	{
+		if ((*it)->getFormat() == format)
+		{
+			return *it;
+		}
+	}
+
+	Texture* texture = textureM->buildTexture(
+		move(string("shadowAtlasDepthScratch" + to_string(int(format)))),
+		format,
+		{ uint32_t(m_pageSize), uint32_t(m_pageSize), uint32_t(1) },
+		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+		VK_IMAGE_ASPECT_DEPTH_BIT,
+		VK_IMAGE_ASPECT_DEPTH_BIT,
+		VK_IMAGE_LAYOUT_UNDEFINED,
+		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+		VK_SAMPLE_COUNT_1_BIT,
+		VK_IMAGE_TILING_OPTIMAL,
+		VK_IMAGE_VIEW_TYPE_2D,
+		0);
+
+	m_vectorDepthScratch.push_back(texture);
+
+	return texture;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ShadowAtlas::clear()
+{
+	m_vectorPage.clear();
+	m_vectorDepthScratch.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ShadowAtlas::placeRegion(ShadowAtlasPage& page, uint width, uint height, uvec2& offset)
+{
+	uint shelfX      = page.m_shelfX;
+	uint shelfY      = page.m_shelfY;
+	uint shelfHeight = page.m_shelfHeight;
+
+	// Open a new shelf below the current one if the region doesn't fit in what is left of it
+	if ((shelfX + width) > m_pageSize)
+	{
+		shelfY      += shelfHeight;
+		shelfX       = 0;
+		shelfHeight  = 0;
+	}
+
+	if ((shelfY + height) > m_pageSize)
+	{
+		return false;
+	}
+
+	offset             = uvec2(shelfX, shelfY);
+	page.m_shelfX      = shelfX + width;
+	page.m_shelfY      = shelfY;
+	page.m_shelfHeight = glm::max(shelfHeight, height);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,21 @@ Texture::Texture(string &&name) : GenericResource(move(name), move(string("Textu
 	, m_format(VK_FORMAT_UNDEFINED)
 	, m_imageViewType(VkImageViewType::VK_IMAGE_VIEW_TYPE_2D)
 	, m_flags(0)
+	, m_streamed(false)
+	, m_residentMipLevel(0)
+	, m_startupMipLevel(0)
+	, m_fullMipMapLevels(0)
+	, m_fullWidth(0)
+	, m_fullHeight(0)
+	, m_requestedMipLevel(0)
+	, m_lastRequestFrame(0)
+	, m_aspectMask(VK_IMAGE_ASPECT_COLOR_BIT)
+	, m_layoutAspectMask(VK_IMAGE_ASPECT_COLOR_BIT)
+	, m_memoryProperties(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+	, m_samples(VK_SAMPLE_COUNT_1_BIT)
+	, m_tiling(VK_IMAGE_TILING_OPTIMAL)
+	, m_outputRelative(false)
+	, m_outputRelativeScale(vec2(1.0f))
 {
 
 }
@@ -15,6 +15,7 @@ limitations under the License.
 */
 
 // GLOBAL INCLUDES
+#include <chrono>
 
 // PROJECT INCLUDES
 #include "../../include/texture/texturemanager.h"
@@ -26,6 +27,18 @@ limitations under the License.
 #include "../../include/core/logicaldevice.h"
 #include "../../include/parameter/attributedefines.h"
 #include "../../include/texture/irradiancetexture.h"
+#include "../../include/util/parallelutil.h"
+#include "../../include/util/mathutil.h"
+#include "../../include/scene/scene.h"
+#include "../../include/node/node.h"
+#include "../../include/camera/camera.h"
+#include "../../include/camera/cameramanager.h"
+#include "../../include/material/material.h"
+#include "../../include/material/materialmanager.h"
+#include "../../include/shader/shader.h"
+#include "../../include/shader/sampler.h"
+#include "../../include/core/gpupipeline.h"
+#include "../../include/rastertechnique/rastertechnique.h"
 
 // NAMESPACE
 using namespace attributedefines;
@@ -33,11 +46,15 @@ using namespace attributedefines;
 // DEFINES
 
 // STATIC MEMBER INITIALIZATION
-VkCommandBuffer TextureManager::commandBufferTexture;
+VkCommandBuffer TextureManager::commandBufferTexture = VK_NULL_HANDLE;
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-TextureManager::TextureManager()
+TextureManager::TextureManager():
+	  m_batchUpload(false)
+	, m_uploadStagingBuffer(nullptr)
+	, m_uploadStagingPointer(nullptr)
+	, m_streamingFrame(0)
 {
 	m_managerName = g_textureManager;
 }
@@ -53,11 +70,23 @@ TextureManager::~TextureManager()
 
 void TextureManager::destroyResources()
 {
+	// Requests in progress own their new images and staging buffers
+	forIT(m_vectorStreamingRequest)
+	{
+		destroyStreamingRequest(*it);
+	}
+
+	m_vectorStreamingRequest.clear();
+
 	forIT(m_mapElement)
 	{
 		delete it->second;
 		it->second = nullptr;
 	}
+
+	invalidateElementHandles();
+	m_vectorStreamedTexture.clear();
+	m_shadowAtlas.clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +104,64 @@ Texture* TextureManager::build2DTextureFromFile(
 
 	Texture* texture = new Texture(move(string(instanceName)));
 
+	VkExtent3D headerExtent;
+	uint32_t headerMipLevels;
+
+	if (m_batchUpload && !isIrradianceTexture(move(string(filename))) && readKTXHeader(filename, headerExtent, headerMipLevels))
+	{
+		// The image, memory and view are needed now (materials reference the view when built), the texture data is
+		// decoded and uploaded in endTextureUploadBatch. Only the coarse mip levels are made resident, the finer ones
+		// are streamed in by updateTextureStreaming when the residency feedback requests them
+		uint32_t startupMipLevel = 0;
+		while ((startupMipLevel + 1 < headerMipLevels) && (glm::max(headerExtent.width >> startupMipLevel, headerExtent.height >> startupMipLevel) > TEXTURE_STREAMING_STARTUP_MAX_SIZE))
+		{
+			startupMipLevel++;
+		}
+
+		texture->m_streamed          = true;
+		texture->m_fullWidth         = headerExtent.width;
+		texture->m_fullHeight        = headerExtent.height;
+		texture->m_fullMipMapLevels  = headerMipLevels;
+		texture->m_startupMipLevel   = startupMipLevel;
+		texture->m_residentMipLevel  = startupMipLevel;
+		texture->m_requestedMipLevel = startupMipLevel;
+		headerExtent.width           = glm::max(headerExtent.width >> startupMipLevel, 1u);
+		headerExtent.height          = glm::max(headerExtent.height >> startupMipLevel, 1u);
+
+		texture->m_width           = headerExtent.width;
+		texture->m_height          = headerExtent.height;
+		texture->m_depth           = headerExtent.depth;
+		texture->m_mipMapLevels    = headerMipLevels - startupMipLevel;
+		texture->m_generateMipmap  = false;
+		texture->m_path            = move(filename);
+		texture->m_format          = format;
+		texture->m_imageUsageFlags = imageUsageFlags;
+		texture->m_imageViewType   = VkImageViewType::VK_IMAGE_VIEW_TYPE_2D;
+		texture->m_flags           = 0;
+		texture->m_imageLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		texture->m_image           = buildImage(format,
+												headerExtent,
+												texture->m_mipMapLevels,
+												imageUsageFlags | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+												VK_SAMPLE_COUNT_1_BIT,
+												VK_IMAGE_TILING_OPTIMAL,
+												texture->m_imageViewType,
+												texture->m_flags);
+
+		texture->m_mem = buildImageMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, texture->m_image, texture->m_memorySize);
+
+		VkComponentMapping components = { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
+		texture->m_view = buildImageView(VK_IMAGE_ASPECT_COLOR_BIT, texture->m_image, components, texture->getMipMapLevels(), format, VK_IMAGE_VIEW_TYPE_2D);
+
+		TextureManager::addElement(move(string(instanceName)), texture);
+		texture->m_name = move(instanceName);
+
+		m_vectorUploadRequest.push_back({ texture, nullptr, nullptr });
+		m_vectorStreamedTexture.push_back(texture);
+
+		return texture;
+	}
+
 	gli::texture2D*    imageGLI2D        = nullptr;
 	TextureInfo*       textureInfo       = nullptr;
 	IrradianceTexture* irradianceTexture = nullptr;
@@ -143,7 +230,8 @@ Texture* TextureManager::build2DTextureFromFile(
 	texture->m_view = buildImageView(VK_IMAGE_ASPECT_COLOR_BIT, texture->m_image, components, texture->getMipMapLevels(), format, VK_IMAGE_VIEW_TYPE_2D);
 
 	TextureManager::addElement(move(string(instanceName)), texture);
-	texture->m_name = move(instanceName);
+	texture->m_name  = move(instanceName);
+	texture->m_ready = true;
 
 	if (imageGLI2D != nullptr)
 	{
@@ -266,13 +354,19 @@ Texture* TextureManager::buildTexture(
 	texture->m_imageViewType   = imageViewType;
 	texture->m_flags           = flags;
 
+	texture->m_aspectMask       = aspectMask;
+	texture->m_layoutAspectMask = layoutAspectMask;
+	texture->m_memoryProperties = properties;
+	texture->m_samples          = samples;
+	texture->m_tiling           = tiling;
+
 	texture->m_image           = buildImage(format, extent, 1, usage, samples, tiling, texture->m_imageViewType, texture->m_flags);
 	//texture->m_mem             = buildImageMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT/*0*/, texture->m_image, texture->m_memorySize);
 	texture->m_mem             = buildImageMemory(properties, texture->m_image, texture->m_memorySize);
 
 	// Use command buffer to create the depth image. This includes -
 	// Command buffer allocation, recording with begin/end scope and submission.
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBufferTexture);
+	commandBufferTexture = coreM->acquireFrameCommandBuffer();
 	coreM->beginCommandBuffer(commandBufferTexture);
 	{
 		VkImageSubresourceRange subresourceRange = {};
@@ -286,6 +380,7 @@ Texture* TextureManager::buildTexture(
 	}
 	coreM->endCommandBuffer(commandBufferTexture);
 	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBufferTexture);
+	coreM->releaseFrameCommandBuffer(commandBufferTexture);
 
 	// TODO: put in separate static method
 	texture->m_view = buildImageView(aspectMask, texture->m_image, { VK_COMPONENT_SWIZZLE_IDENTITY }, 1, format, texture->m_imageViewType);
@@ -306,8 +401,8 @@ Texture* TextureManager::buildTexture(
 
 void TextureManager::destroyCommandBuffer()
 {
-	VkCommandBuffer cmdBufs[] = { commandBufferTexture };
-	vkFreeCommandBuffers(coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), sizeof(cmdBufs) / sizeof(VkCommandBuffer), cmdBufs);
+	// The command buffer is taken from the per frame command pools and released after each submission, the pools own it
+	commandBufferTexture = VK_NULL_HANDLE;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,6 +446,21 @@ Texture* TextureManager::buildTextureFromExistingResources(
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void TextureManager::updateTextureFromExistingResources(Texture* texture, VkImage image, VkImageView view, uint32_t width, uint32_t height)
+{
+	texture->m_image  = image;
+	texture->m_view   = view;
+	texture->m_width  = width;
+	texture->m_height = height;
+
+	if (gpuPipelineM->getPipelineInitialized())
+	{
+		emitSignalElement(move(string(texture->getName())), ManagerNotificationType::MNT_CHANGED);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void TextureManager::setImageLayout(VkImage image, VkImageAspectFlags aspectMask, VkImageLayout oldImageLayout, VkImageLayout newImageLayout, const VkImageSubresourceRange& subresourceRange)
 {
 	// TODO: assign texture->m_imageLayout value
@@ -388,6 +498,9 @@ void TextureManager::setImageLayout(VkImage image, VkImageAspectFlags aspectMask
 	case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
 		imgMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 		break;
+	case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+		imgMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		break;
 	case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
 		imgMemoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
 	}
@@ -401,6 +514,11 @@ void TextureManager::setImageLayout(VkImage image, VkImageAspectFlags aspectMask
 		imgMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 		break;
 
+		// An image in this layout can only be used as the source operand of the copy commands
+	case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+		imgMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		break;
+
 		// Ensure any Copy or CPU writes to image are flushed
 		// An image in this layout can only be used as a read-only shader resource
 	case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
@@ -569,22 +687,63 @@ void TextureManager::fillImageMemoryMipmaps(
 {
 	Buffer* buffer = bufferM->buildBuffer(move(string("fillBuffer")), imageData, dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
+	// Use a separate command buffer for texture loading, start command buffer recording
+	commandBufferTexture = coreM->acquireFrameCommandBuffer();
+	coreM->beginCommandBuffer(commandBufferTexture);
+
+	recordImageMemoryMipmapsCopy(buffer->getBuffer(), 0, mipMap, image, vectorMipMapExtent, vectorMipMapSize, destinationLayout, imageViewType);
+
+	coreM->endCommandBuffer(commandBufferTexture); // Submit command buffer containing copy and image layout commands-
+
+															  // Create a fence object to ensure that the command buffer is executed, coping our staged raw data from the buffers to image memory with respective image layout and attributes into consideration -
+	VkFence fence;
+	VkFenceCreateInfo fenceCI = {};
+	fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	fenceCI.flags = 0;
+
+	VkResult error = vkCreateFence(coreM->getLogicalDevice(), &fenceCI, nullptr, &fence);
+	assert(!error);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.pNext              = NULL;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers    = &commandBufferTexture;
+
+	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBufferTexture, &submitInfo, fence);
+
+	error = vkWaitForFences(coreM->getLogicalDevice(), 1, &fence, VK_TRUE, 10000000000);
+	assert(!error);
+
+	// destroy resources used for this operation
+	vkDestroyFence(coreM->getLogicalDevice(), fence, nullptr);
+	coreM->releaseFrameCommandBuffer(commandBufferTexture);
+	bufferM->removeElement(move(string("fillBuffer")));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::recordImageMemoryMipmapsCopy(
+	VkBuffer                  buffer,
+	VkDeviceSize              bufferOffset,
+	uint32_t                  mipMap,
+	VkImage                   image,
+	const vector<VkExtent3D>& vectorMipMapExtent,
+	const vector<uint>&       vectorMipMapSize,
+	VkImageLayout             destinationLayout,
+	VkImageViewType           imageViewType)
+{
 	VkImageSubresourceRange subresourceRange = {};
 	subresourceRange.aspectMask   = VK_IMAGE_ASPECT_COLOR_BIT;
 	subresourceRange.baseMipLevel = 0;
 	subresourceRange.levelCount   = mipMap;
 	subresourceRange.layerCount   = (imageViewType == VK_IMAGE_VIEW_TYPE_CUBE) ? 6 : 1;
 
-	// Use a separate command buffer for texture loading, start command buffer recording
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBufferTexture);
-	coreM->beginCommandBuffer(commandBufferTexture);
-
 	// set the image layout to be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL since it is destination for copying buffer into image using vkCmdCopyBufferToImage -
 	setImageLayout(image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED, destinationLayout, subresourceRange);
 
-	uint32_t bufferOffset = 0;
 	vector<VkBufferImageCopy> bufferImgCopyList; // List contains the buffer image copy for each mipLevel -
-													  // Iterater through each mip level and set buffer image copy -
+												 // Iterater through each mip level and set buffer image copy -
 	for (uint32_t i = 0; i < mipMap; i++)
 	{
 		VkBufferImageCopy bufImgCopyItem = {};
@@ -594,42 +753,1000 @@ void TextureManager::fillImageMemoryMipmaps(
 		bufImgCopyItem.imageSubresource.baseArrayLayer = 0;
 		bufImgCopyItem.imageExtent                     = vectorMipMapExtent[i];
 		bufImgCopyItem.bufferOffset                    = bufferOffset;
-										
+
 		bufferImgCopyList.push_back(bufImgCopyItem);
-		bufferOffset += uint32_t(vectorMipMapSize[i]); // adjust buffer offset
+		bufferOffset += VkDeviceSize(vectorMipMapSize[i]); // adjust buffer offset
 	}
 
 	// Copy the staging buffer memory data contain the stage raw data(with mip levels) into image object
-	vkCmdCopyBufferToImage(commandBufferTexture, buffer->getBuffer(), image, destinationLayout, uint32_t(bufferImgCopyList.size()), bufferImgCopyList.data());
+	vkCmdCopyBufferToImage(commandBufferTexture, buffer, image, destinationLayout, uint32_t(bufferImgCopyList.size()), bufferImgCopyList.data());
 
 	// Advised to change the image layout to shader read after staged buffer copied into image memory -
 	setImageLayout(image, VK_IMAGE_ASPECT_COLOR_BIT, destinationLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange);
+}
 
-	coreM->endCommandBuffer(commandBufferTexture); // Submit command buffer containing copy and image layout commands-
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::beginTextureUploadBatch()
+{
+	m_batchUpload = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::endTextureUploadBatch()
+{
+	m_batchUpload = false;
+
+	if (m_vectorUploadRequest.size() == 0)
+	{
+		return;
+	}
+
+	auto startTime = chrono::high_resolution_clock::now();
+
+	const VkDeviceSize segmentSize = TEXTURE_UPLOAD_STAGING_SEGMENT_SIZE;
+
+	m_uploadStagingBuffer = bufferM->buildBuffer(
+		move(string("textureUploadStagingBuffer")),
+		nullptr,
+		segmentSize * TEXTURE_UPLOAD_STAGING_SEGMENT_COUNT,
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	VkResult result = vkMapMemory(coreM->getLogicalDevice(), m_uploadStagingBuffer->getMemory(), 0, m_uploadStagingBuffer->getMappingSize(), 0, (void**)&m_uploadStagingPointer);
+	assert(result == VK_SUCCESS);
 
-															  // Create a fence object to ensure that the command buffer is executed, coping our staged raw data from the buffers to image memory with respective image layout and attributes into consideration -
-	VkFence fence;
 	VkFenceCreateInfo fenceCI = {};
 	fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
 	fenceCI.flags = 0;
 
-	VkResult error = vkCreateFence(coreM->getLogicalDevice(), &fenceCI, nullptr, &fence);
-	assert(!error);
+	m_vectorUploadSegment.resize(TEXTURE_UPLOAD_STAGING_SEGMENT_COUNT);
+	forIT(m_vectorUploadSegment)
+	{
+		result = vkCreateFence(coreM->getLogicalDevice(), &fenceCI, nullptr, &it->m_fence);
+		assert(result == VK_SUCCESS);
+		it->m_commandBuffer = VK_NULL_HANDLE;
+		it->m_inFlight      = false;
+		it->m_offset        = 0;
+	}
+
+	uint numRequest      = uint(m_vectorUploadRequest.size());
+	uint chunkSize       = 2 * ParallelUtil::getNumWorkerThread();
+	uint segmentIndex    = 0;
+	VkDeviceSize numByte = 0;
+
+	// Textures are decoded in chunks by the worker threads, while the copies of the previous segments are still
+	// executing in the GPU
+	for (uint chunkStart = 0; chunkStart < numRequest; chunkStart += chunkSize)
+	{
+		uint chunkEnd = glm::min(chunkStart + chunkSize, numRequest);
+		decodeUploadRequest(chunkStart, chunkEnd);
+
+		forIFrom(chunkStart, chunkEnd)
+		{
+			TextureUploadRequest& request = m_vectorUploadRequest[i];
+			Texture* texture              = request.m_texture;
+			TextureInfo* textureInfo      = request.m_textureInfo;
+
+			vector<VkExtent3D> vectorMipMapExtent;
+			vector<uint> vectorMipMapSize;
+			VkDeviceSize dataOffset;
+			VkDeviceSize dataSize;
+
+			if (!buildMipMapCopyData(texture, textureInfo, texture->m_residentMipLevel, vectorMipMapExtent, vectorMipMapSize, dataOffset, dataSize))
+			{
+				cout << "ERROR in TextureManager::endTextureUploadBatch, decoded texture " << texture->m_path << " doesn't match its KTX header information, uploading it on its own" << endl;
+				rebuildTextureFromDecodedData(texture, textureInfo);
+				continue;
+			}
+
+			uint8_t* data = (uint8_t*)(textureInfo->refData()) + dataOffset;
+			numByte      += dataSize;
+
+			if (dataSize > segmentSize)
+			{
+				// Too big for the staging ring, uploaded on its own
+				fillImageMemoryMipmaps(texture->m_mipMapLevels, texture->m_image, data, uint(dataSize), vectorMipMapExtent, vectorMipMapSize, texture->m_imageLayout, texture->m_imageViewType);
+				texture->m_ready = true;
+				continue;
+			}
+
+			TextureUploadSegment* segment = &m_vectorUploadSegment[segmentIndex];
+			VkDeviceSize offset           = (segment->m_offset + TEXTURE_UPLOAD_STAGING_ALIGNMENT - 1) & ~VkDeviceSize(TEXTURE_UPLOAD_STAGING_ALIGNMENT - 1);
+
+			if ((offset + dataSize) > segmentSize)
+			{
+				// Segment full, submit it and move to the next one, waiting for its previous copies if still in flight
+				submitUploadSegment(*segment);
+				segmentIndex = (segmentIndex + 1) % TEXTURE_UPLOAD_STAGING_SEGMENT_COUNT;
+				segment      = &m_vectorUploadSegment[segmentIndex];
+				waitUploadSegment(*segment);
+				offset       = 0;
+			}
+
+			if (segment->m_commandBuffer == VK_NULL_HANDLE)
+			{
+				segment->m_commandBuffer = coreM->acquireFrameCommandBuffer();
+				coreM->beginCommandBuffer(segment->m_commandBuffer);
+			}
+
+			VkDeviceSize bufferOffset = segmentIndex * segmentSize + offset;
+			memcpy(m_uploadStagingPointer + bufferOffset, data, dataSize);
+
+			commandBufferTexture = segment->m_commandBuffer;
+			recordImageMemoryMipmapsCopy(m_uploadStagingBuffer->getBuffer(), bufferOffset, texture->m_mipMapLevels, texture->m_image, vectorMipMapExtent, vectorMipMapSize, texture->m_imageLayout, texture->m_imageViewType);
+
+			segment->m_offset = offset + dataSize;
+			segment->m_vectorTexture.push_back(texture);
+		}
+
+		// The decoded data has already been copied to the staging ring
+		forIFrom(chunkStart, chunkEnd)
+		{
+			delete m_vectorUploadRequest[i].m_textureInfo;
+			delete m_vectorUploadRequest[i].m_imageGLI2D;
+			m_vectorUploadRequest[i].m_textureInfo = nullptr;
+			m_vectorUploadRequest[i].m_imageGLI2D  = nullptr;
+		}
+	}
+
+	submitUploadSegment(m_vectorUploadSegment[segmentIndex]);
+
+	forIT(m_vectorUploadSegment)
+	{
+		waitUploadSegment(*it);
+		vkDestroyFence(coreM->getLogicalDevice(), it->m_fence, nullptr);
+	}
+
+	m_vectorUploadSegment.clear();
+
+	vkUnmapMemory(coreM->getLogicalDevice(), m_uploadStagingBuffer->getMemory());
+	m_uploadStagingPointer = nullptr;
+	bufferM->removeElement(move(string("textureUploadStagingBuffer")));
+	m_uploadStagingBuffer  = nullptr;
+	commandBufferTexture   = VK_NULL_HANDLE;
+
+	cout << "Uploaded " << numRequest << " textures (" << float(numByte) / (1024.0f * 1024.0f) << "MB) in " << chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count() << "ms" << endl;
+
+	m_vectorUploadRequest.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::readKTXHeader(const string& path, VkExtent3D& extent, uint32_t& mipLevels)
+{
+	static const uint8_t ktxIdentifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	// KTX 1.1 header: 12 bytes identifier followed by 13 uint32_t fields
+	uint8_t identifier[12];
+	uint32_t header[13];
+
+	ifstream file(path, ios::in | ios::binary);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file.read((char*)identifier, sizeof(identifier));
+	file.read((char*)header, sizeof(header));
+
+	if (!file || (memcmp(identifier, ktxIdentifier, sizeof(identifier)) != 0) || (header[0] != 0x04030201))
+	{
+		return false;
+	}
+
+	// header[6] pixelWidth, header[7] pixelHeight, header[8] pixelDepth, header[11] numberOfMipmapLevels
+	extent    = { header[6], glm::max(header[7], 1u), glm::max(header[8], 1u) };
+	mipLevels = glm::max(header[11], 1u);
+
+	return (extent.width > 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::decodeUploadRequest(uint start, uint end)
+{
+	ParallelUtil::parallelFor(end - start, [&](uint index)
+	{
+		TextureUploadRequest& request = m_vectorUploadRequest[start + index];
+		request.m_imageGLI2D          = new gli::texture2D(gli::texture2D(gli::load(request.m_texture->m_path)));
+		assert(!request.m_imageGLI2D->empty());
+		request.m_textureInfo         = new TextureInfo(request.m_imageGLI2D);
+	});
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::submitUploadSegment(TextureUploadSegment& segment)
+{
+	if (segment.m_commandBuffer == VK_NULL_HANDLE)
+	{
+		return;
+	}
+
+	coreM->endCommandBuffer(segment.m_commandBuffer);
 
 	VkSubmitInfo submitInfo = {};
 	submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 	submitInfo.pNext              = NULL;
 	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers    = &commandBufferTexture;
+	submitInfo.pCommandBuffers    = &segment.m_commandBuffer;
 
-	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBufferTexture, &submitInfo, fence);
+	// Submitted without waiting for the queue to be idle, the segment fence is waited before reusing it
+	VkResult result = vkQueueSubmit(coreM->getLogicalDeviceGraphicsQueue(), 1, &submitInfo, segment.m_fence);
+	assert(result == VK_SUCCESS);
 
-	error = vkWaitForFences(coreM->getLogicalDevice(), 1, &fence, VK_TRUE, 10000000000);
-	assert(!error);
+	segment.m_inFlight = true;
+}
 
-	// destroy resources used for this operation
-	vkDestroyFence(coreM->getLogicalDevice(), fence, nullptr);
-	bufferM->removeElement(move(string("fillBuffer")));
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::waitUploadSegment(TextureUploadSegment& segment)
+{
+	if (segment.m_inFlight)
+	{
+		VkResult result = vkWaitForFences(coreM->getLogicalDevice(), 1, &segment.m_fence, VK_TRUE, 10000000000);
+		assert(result == VK_SUCCESS);
+		result = vkResetFences(coreM->getLogicalDevice(), 1, &segment.m_fence);
+		assert(result == VK_SUCCESS);
+		coreM->releaseFrameCommandBuffer(segment.m_commandBuffer);
+
+		forIT(segment.m_vectorTexture)
+		{
+			(*it)->m_ready = true;
+		}
+	}
+
+	segment.m_commandBuffer = VK_NULL_HANDLE;
+	segment.m_inFlight      = false;
+	segment.m_offset        = 0;
+	segment.m_vectorTexture.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::buildMipMapCopyData(
+	const Texture*      texture,
+	TextureInfo*        textureInfo,
+	uint32_t            firstMipLevel,
+	vector<VkExtent3D>& vectorMipMapExtent,
+	vector<uint>&       vectorMipMapSize,
+	VkDeviceSize&       dataOffset,
+	VkDeviceSize&       dataSize)
+{
+	const vector<TextureMipMapInfo>& vectorMipMap = textureInfo->getVectorMipMap();
+
+	uint32_t fullWidth        = texture->m_streamed ? texture->m_fullWidth        : texture->m_width;
+	uint32_t fullHeight       = texture->m_streamed ? texture->m_fullHeight       : texture->m_height;
+	uint32_t fullMipMapLevels = texture->m_streamed ? texture->m_fullMipMapLevels : texture->m_mipMapLevels;
+
+	if ((vectorMipMap.size() != fullMipMapLevels) || (vectorMipMap[0].m_width != fullWidth) || (vectorMipMap[0].m_height != fullHeight) || (firstMipLevel >= fullMipMapLevels))
+	{
+		return false;
+	}
+
+	vectorMipMapExtent.resize(fullMipMapLevels - firstMipLevel);
+	vectorMipMapSize.resize(fullMipMapLevels - firstMipLevel);
+	dataOffset = 0;
+	dataSize   = 0;
+
+	forI(fullMipMapLevels)
+	{
+		if (i < firstMipLevel)
+		{
+			dataOffset += VkDeviceSize(vectorMipMap[i].m_size);
+			continue;
+		}
+
+		vectorMipMapExtent[i - firstMipLevel] = { vectorMipMap[i].m_width, vectorMipMap[i].m_height, vectorMipMap[i].m_depth };
+		vectorMipMapSize[i - firstMipLevel]   = uint(vectorMipMap[i].m_size);
+		dataSize                             += VkDeviceSize(vectorMipMap[i].m_size);
+	}
+
+	return ((dataOffset + dataSize) <= VkDeviceSize(textureInfo->getSize()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::rebuildTextureFromDecodedData(Texture* texture, TextureInfo* textureInfo)
+{
+	const vector<TextureMipMapInfo>& vectorMipMap = textureInfo->getVectorMipMap();
+	assert(vectorMipMap.size() != 0);
+
+	vector<VkExtent3D> vectorMipMapExtent;
+	vector<uint> vectorMipMapSize;
+
+	forIT(vectorMipMap)
+	{
+		vectorMipMapExtent.push_back({ it->m_width, it->m_height, it->m_depth });
+		vectorMipMapSize.push_back(uint(it->m_size));
+	}
+
+	VkExtent3D imageExtent = vectorMipMapExtent[0];
+	uint32_t mipMapLevels  = uint32_t(vectorMipMap.size());
+
+	VkImage image = buildImage(texture->m_format,
+							   imageExtent,
+							   mipMapLevels,
+							   texture->m_imageUsageFlags | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+							   VK_SAMPLE_COUNT_1_BIT,
+							   VK_IMAGE_TILING_OPTIMAL,
+							   texture->m_imageViewType,
+							   texture->m_flags);
+
+	VkDeviceSize memorySize;
+	VkDeviceMemory memory = buildImageMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, memorySize);
+
+	fillImageMemoryMipmaps(mipMapLevels, image, textureInfo->refData(), uint(textureInfo->getSize()), vectorMipMapExtent, vectorMipMapSize, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, texture->m_imageViewType);
+
+	VkComponentMapping components = { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
+	VkImageView view              = buildImageView(VK_IMAGE_ASPECT_COLOR_BIT, image, components, mipMapLevels, texture->m_format, texture->m_imageViewType);
+
+	// No copy has been recorded for the image built from the KTX header information
+	vkDestroyImageView(coreM->getLogicalDevice(), texture->m_view, nullptr);
+	vkDestroyImage(coreM->getLogicalDevice(), texture->m_image, nullptr);
+	vkFreeMemory(coreM->getLogicalDevice(), texture->m_mem, nullptr);
+
+	texture->m_image            = image;
+	texture->m_mem              = memory;
+	texture->m_memorySize       = memorySize;
+	texture->m_view             = view;
+	texture->m_width            = imageExtent.width;
+	texture->m_height           = imageExtent.height;
+	texture->m_depth            = imageExtent.depth;
+	texture->m_mipMapLevels     = mipMapLevels;
+	texture->m_streamed         = false;
+	texture->m_residentMipLevel = 0;
+	texture->m_ready            = true;
+
+	vectorTexturePtr::iterator itStreamed = find(m_vectorStreamedTexture.begin(), m_vectorStreamedTexture.end(), texture);
+
+	if (itStreamed != m_vectorStreamedTexture.end())
+	{
+		m_vectorStreamedTexture.erase(itStreamed);
+	}
+
+	vector<Material*> vectorMaterial = materialM->getVectorElement();
+	forIT(vectorMaterial)
+	{
+		(*it)->updateTextureDescriptor(texture);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::updateTextureStreaming()
+{
+	m_streamingFrame++;
+
+	// Requests in progress are advanced first, their images are replaced once their copies have completed
+	bool updated = false;
+
+	for (auto it = m_vectorStreamingRequest.begin(); it != m_vectorStreamingRequest.end();)
+	{
+		bool replaced = false;
+		if (processStreamingRequest(*it, replaced))
+		{
+			destroyStreamingRequest(*it);
+			it = m_vectorStreamingRequest.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+
+		updated |= replaced;
+	}
+
+	if (updated)
+	{
+		// The descriptor sets of the materials sampling the replaced images changed, the graphics techniques drawing
+		// them have to record their command buffers again (m_needsToRecord is recomputed from the recorded ones)
+		vectorRasterTechniquePtr& vectorTechnique = gpuPipelineM->refVectorRasterTechnique();
+		forIT(vectorTechnique)
+		{
+			if ((*it)->getRasterTechniqueType() == RasterTechniqueType::RTT_GRAPHICS)
+			{
+				(*it)->clearRecordedCommandBuffer();
+			}
+		}
+	}
+
+	if ((m_vectorStreamedTexture.size() == 0) || (cameraM->refMainCamera() == nullptr))
+	{
+		return;
+	}
+
+	computeResidencyFeedback(cameraM->refMainCamera());
+
+	VkDeviceSize residentMemory = 0;
+	vectorTexturePtr vectorStreamIn;
+
+	forIT(m_vectorStreamedTexture)
+	{
+		TextureStreamingRequest* request = getStreamingRequest(*it);
+
+		if (request != nullptr)
+		{
+			// Textures with a request in progress are accounted with the estimated size of their new image
+			residentMemory += request->m_estimatedMemory;
+			continue;
+		}
+
+		residentMemory += (*it)->m_memorySize;
+
+		if ((*it)->m_ready && ((*it)->m_lastRequestFrame == m_streamingFrame) && ((*it)->m_requestedMipLevel < (*it)->m_residentMipLevel))
+		{
+			vectorStreamIn.push_back(*it);
+		}
+	}
+
+	// Biggest difference between the needed and the resident mip level first
+	sort(vectorStreamIn.begin(), vectorStreamIn.end(), [](const Texture* a, const Texture* b)
+	{
+		return ((a->m_residentMipLevel - a->m_requestedMipLevel) > (b->m_residentMipLevel - b->m_requestedMipLevel));
+	});
+
+	uint numRequest = uint(m_vectorStreamingRequest.size());
+	uint maxRequest = (numRequest < TEXTURE_STREAMING_MAX_UPDATE_PER_FRAME) ? (TEXTURE_STREAMING_MAX_UPDATE_PER_FRAME - numRequest) : 0;
+
+	if (vectorStreamIn.size() > maxRequest)
+	{
+		vectorStreamIn.resize(maxRequest);
+	}
+
+	// Eviction candidates, least recently requested first
+	vectorTexturePtr vectorEvict = m_vectorStreamedTexture;
+	sort(vectorEvict.begin(), vectorEvict.end(), [](const Texture* a, const Texture* b)
+	{
+		return (a->m_lastRequestFrame < b->m_lastRequestFrame);
+	});
+
+	uint evictIndex = 0;
+
+	forIT(vectorStreamIn)
+	{
+		Texture* texture = *it;
+
+		VkDeviceSize requiredMemory = estimateResidentMemory(texture, texture->m_requestedMipLevel) - texture->m_memorySize;
+
+		while (((residentMemory + requiredMemory) > TEXTURE_STREAMING_MEMORY_BUDGET) && (evictIndex < vectorEvict.size()))
+		{
+			Texture* evicted = vectorEvict[evictIndex++];
+
+			if ((evicted == texture) || (evicted->m_lastRequestFrame == m_streamingFrame) || (getStreamingRequest(evicted) != nullptr))
+			{
+				continue;
+			}
+
+			uint32_t targetMipLevel = evicted->m_startupMipLevel;
+			if ((m_streamingFrame - evicted->m_lastRequestFrame) <= TEXTURE_STREAMING_EVICT_FRAMES)
+			{
+				targetMipLevel = glm::min(evicted->m_requestedMipLevel, evicted->m_startupMipLevel);
+			}
+
+			if (targetMipLevel <= evicted->m_residentMipLevel)
+			{
+				continue;
+			}
+
+			if (requestTextureResidentMipLevel(evicted, targetMipLevel))
+			{
+				residentMemory -= evicted->m_memorySize;
+				residentMemory += m_vectorStreamingRequest.back()->m_estimatedMemory;
+			}
+		}
+
+		if ((residentMemory + requiredMemory) > TEXTURE_STREAMING_MEMORY_BUDGET)
+		{
+			// Nothing left to evict
+			break;
+		}
+
+		if (requestTextureResidentMipLevel(texture, texture->m_requestedMipLevel))
+		{
+			residentMemory += requiredMemory;
+		}
+	}
+
+	// Textures not requested for a long time go back to their startup mip level even when under budget
+	forIT(m_vectorStreamedTexture)
+	{
+		Texture* texture = *it;
+		if (texture->m_ready &&
+			(texture->m_residentMipLevel < texture->m_startupMipLevel) &&
+			((m_streamingFrame - texture->m_lastRequestFrame) > TEXTURE_STREAMING_EVICT_FRAMES) &&
+			(getStreamingRequest(texture) == nullptr))
+		{
+			requestTextureResidentMipLevel(texture, texture->m_startupMipLevel);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::computeResidencyFeedback(Camera* camera)
+{
+	const vec4* arrayFrustumPlane = camera->getArrayFrustumPlane();
+	vec3 cameraPosition           = camera->getPosition();
+	float projectionFactor        = float(coreM->getHeight()) / (2.0f * glm::tan(camera->getFov() * 0.5f));
+
+	vectorNodePtr& vectorNode = sceneM->refModel();
+
+	forIT(vectorNode)
+	{
+		Node* node = *it;
+
+		if (((node->getMeshType() & eMeshType::E_MT_RENDER_MODEL) == 0) || (node->refMaterial() == nullptr) || (node->refMaterial()->refShader() == nullptr))
+		{
+			continue;
+		}
+
+		const BBox3D& aabb = node->getBBox();
+
+		if (!MathUtil::aabbIntersectsFrustum(arrayFrustumPlane, aabb.getMin(), aabb.getMax()))
+		{
+			continue;
+		}
+
+		// Projected size in pixels of the bounding sphere of the node, assuming the texture is mapped once over it
+		float radius        = 0.5f * glm::length(aabb.getMax() - aabb.getMin());
+		float distance      = glm::length(aabb.getCenter() - cameraPosition);
+		float projectedSize = (distance > radius) ? (2.0f * radius * projectionFactor / distance) : FLT_MAX;
+
+		const vectorSamplerPtr& vectorSampler = node->refMaterial()->refShader()->getVecTextureSampler();
+
+		forJ(vectorSampler.size())
+		{
+			Texture* texture = vectorSampler[j]->refTexture();
+
+			if ((texture == nullptr) || !texture->m_streamed)
+			{
+				continue;
+			}
+
+			float textureSize = float(glm::max(texture->m_fullWidth, texture->m_fullHeight));
+			uint32_t mipLevel = 0;
+
+			if (projectedSize < textureSize)
+			{
+				mipLevel = uint32_t(glm::floor(glm::log2(textureSize / glm::max(projectedSize, 1.0f))));
+			}
+
+			mipLevel = glm::min(mipLevel, texture->m_fullMipMapLevels - 1);
+
+			if (texture->m_lastRequestFrame != m_streamingFrame)
+			{
+				texture->m_lastRequestFrame  = m_streamingFrame;
+				texture->m_requestedMipLevel = mipLevel;
+			}
+			else
+			{
+				texture->m_requestedMipLevel = glm::min(texture->m_requestedMipLevel, mipLevel);
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::requestTextureResidentMipLevel(Texture* texture, uint32_t mipLevel)
+{
+	if (!texture->m_streamed || (mipLevel >= texture->m_fullMipMapLevels) || (mipLevel == texture->m_residentMipLevel) || (getStreamingRequest(texture) != nullptr))
+	{
+		return false;
+	}
+
+	TextureStreamingRequest* request = new TextureStreamingRequest();
+	request->m_texture         = texture;
+	request->m_mipLevel        = mipLevel;
+	request->m_estimatedMemory = estimateResidentMemory(texture, mipLevel);
+	request->m_path            = texture->m_path;
+	request->m_decoded         = false;
+	request->m_imageGLI2D      = nullptr;
+	request->m_textureInfo     = nullptr;
+	request->m_image           = VK_NULL_HANDLE;
+	request->m_memory          = VK_NULL_HANDLE;
+	request->m_memorySize      = 0;
+	request->m_extent          = { 0, 0, 0 };
+	request->m_mipMapLevels    = 0;
+	request->m_stagingBuffer   = nullptr;
+	request->m_commandBuffer   = VK_NULL_HANDLE;
+	request->m_fence           = VK_NULL_HANDLE;
+
+	// Evictions keep mip levels already resident, only finer mip levels need the texture file
+	request->m_copyFromResident = (mipLevel > texture->m_residentMipLevel);
+
+	if (!request->m_copyFromResident)
+	{
+		// The worker thread only accesses the request, the texture keeps being used by the render thread meanwhile
+		request->m_thread = thread([request]()
+		{
+			request->m_imageGLI2D  = new gli::texture2D(gli::texture2D(gli::load(request->m_path)));
+			request->m_textureInfo = request->m_imageGLI2D->empty() ? nullptr : new TextureInfo(request->m_imageGLI2D);
+			request->m_decoded     = true;
+		});
+	}
+
+	m_vectorStreamingRequest.push_back(request);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::processStreamingRequest(TextureStreamingRequest* request, bool& replaced)
+{
+	replaced         = false;
+	Texture* texture = request->m_texture;
+
+	if ((request->m_image == VK_NULL_HANDLE) && request->m_copyFromResident)
+	{
+		recordResidentMipLevelCopy(request);
+		submitStreamingRequest(request);
+		return false;
+	}
+
+	if (request->m_image == VK_NULL_HANDLE)
+	{
+		if (!request->m_decoded)
+		{
+			// Still being decoded by the worker thread
+			return false;
+		}
+
+		request->m_thread.join();
+
+		if (request->m_textureInfo == nullptr)
+		{
+			cout << "ERROR in TextureManager::processStreamingRequest, texture " << request->m_path << " could not be loaded" << endl;
+			return true;
+		}
+
+		vector<VkExtent3D> vectorMipMapExtent;
+		vector<uint> vectorMipMapSize;
+		VkDeviceSize dataOffset;
+		VkDeviceSize dataSize;
+
+		if (!buildMipMapCopyData(texture, request->m_textureInfo, request->m_mipLevel, vectorMipMapExtent, vectorMipMapSize, dataOffset, dataSize))
+		{
+			cout << "ERROR in TextureManager::processStreamingRequest, texture " << request->m_path << " doesn't match its KTX header information" << endl;
+			return true;
+		}
+
+		request->m_extent       = vectorMipMapExtent[0];
+		request->m_mipMapLevels = uint32_t(vectorMipMapExtent.size());
+
+		request->m_image = buildImage(texture->m_format,
+									  request->m_extent,
+									  request->m_mipMapLevels,
+									  texture->m_imageUsageFlags | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+									  VK_SAMPLE_COUNT_1_BIT,
+									  VK_IMAGE_TILING_OPTIMAL,
+									  texture->m_imageViewType,
+									  texture->m_flags);
+
+		request->m_memory = buildImageMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, request->m_image, request->m_memorySize);
+
+		request->m_stagingBuffer = bufferM->buildBuffer(
+			move(string("textureStreamingStagingBuffer") + texture->getName()),
+			(uint8_t*)(request->m_textureInfo->refData()) + dataOffset,
+			dataSize,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+		// The decoded data has already been copied to the staging buffer
+		delete request->m_textureInfo;
+		delete request->m_imageGLI2D;
+		request->m_textureInfo = nullptr;
+		request->m_imageGLI2D  = nullptr;
+
+		CoreManager::allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &request->m_commandBuffer);
+		coreM->beginCommandBuffer(request->m_commandBuffer);
+
+		commandBufferTexture = request->m_commandBuffer;
+		recordImageMemoryMipmapsCopy(request->m_stagingBuffer->getBuffer(), 0, request->m_mipMapLevels, request->m_image, vectorMipMapExtent, vectorMipMapSize, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, texture->m_imageViewType);
+		commandBufferTexture = VK_NULL_HANDLE;
+
+		coreM->endCommandBuffer(request->m_commandBuffer);
+
+		submitStreamingRequest(request);
+
+		return false;
+	}
+
+	if (vkGetFenceStatus(coreM->getLogicalDevice(), request->m_fence) != VK_SUCCESS)
+	{
+		return false;
+	}
+
+	VkComponentMapping components = { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
+	VkImageView view              = buildImageView(VK_IMAGE_ASPECT_COLOR_BIT, request->m_image, components, request->m_mipMapLevels, texture->m_format, texture->m_imageViewType);
+
+	// The GPU is idle, the previous image is not referenced by any command buffer in flight
+	vkDestroyImageView(coreM->getLogicalDevice(), texture->m_view, nullptr);
+	vkDestroyImage(coreM->getLogicalDevice(), texture->m_image, nullptr);
+	vkFreeMemory(coreM->getLogicalDevice(), texture->m_mem, nullptr);
+
+	texture->m_image            = request->m_image;
+	texture->m_mem              = request->m_memory;
+	texture->m_memorySize       = request->m_memorySize;
+	texture->m_view             = view;
+	texture->m_width            = request->m_extent.width;
+	texture->m_height           = request->m_extent.height;
+	texture->m_mipMapLevels     = request->m_mipMapLevels;
+	texture->m_residentMipLevel = request->m_mipLevel;
+
+	// The new image is owned by the texture now
+	request->m_image  = VK_NULL_HANDLE;
+	request->m_memory = VK_NULL_HANDLE;
+
+	vector<Material*> vectorMaterial = materialM->getVectorElement();
+	forIT(vectorMaterial)
+	{
+		(*it)->updateTextureDescriptor(texture);
+	}
+
+	replaced = true;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::recordResidentMipLevelCopy(TextureStreamingRequest* request)
+{
+	Texture* texture       = request->m_texture;
+	uint32_t firstMipLevel = request->m_mipLevel - texture->m_residentMipLevel; // Mip level of the resident image that becomes the first one of the new image
+
+	request->m_extent       = { glm::max(texture->m_width >> firstMipLevel, 1u), glm::max(texture->m_height >> firstMipLevel, 1u), 1 };
+	request->m_mipMapLevels = texture->m_mipMapLevels - firstMipLevel;
+
+	request->m_image = buildImage(texture->m_format,
+								  request->m_extent,
+								  request->m_mipMapLevels,
+								  texture->m_imageUsageFlags | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+								  VK_SAMPLE_COUNT_1_BIT,
+								  VK_IMAGE_TILING_OPTIMAL,
+								  texture->m_imageViewType,
+								  texture->m_flags);
+
+	request->m_memory = buildImageMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, request->m_image, request->m_memorySize);
+
+	CoreManager::allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &request->m_commandBuffer);
+	coreM->beginCommandBuffer(request->m_commandBuffer);
+
+	commandBufferTexture = request->m_commandBuffer;
+
+	VkImageSubresourceRange sourceRange = {};
+	sourceRange.aspectMask   = VK_IMAGE_ASPECT_COLOR_BIT;
+	sourceRange.baseMipLevel = firstMipLevel;
+	sourceRange.levelCount   = request->m_mipMapLevels;
+	sourceRange.layerCount   = 1;
+
+	VkImageSubresourceRange destinationRange = sourceRange;
+	destinationRange.baseMipLevel            = 0;
+
+	setImageLayout(texture->m_image,  VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, sourceRange);
+	setImageLayout(request->m_image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, destinationRange);
+
+	vector<VkImageCopy> vectorImageCopy(request->m_mipMapLevels);
+	forI(request->m_mipMapLevels)
+	{
+		VkImageCopy& imageCopy   = vectorImageCopy[i];
+		imageCopy.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, firstMipLevel + i, 0, 1 };
+		imageCopy.srcOffset      = { 0, 0, 0 };
+		imageCopy.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, i, 0, 1 };
+		imageCopy.dstOffset      = { 0, 0, 0 };
+		imageCopy.extent         = { glm::max(request->m_extent.width >> i, 1u), glm::max(request->m_extent.height >> i, 1u), 1 };
+	}
+
+	vkCmdCopyImage(commandBufferTexture, texture->m_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, request->m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, uint32_t(vectorImageCopy.size()), vectorImageCopy.data());
+
+	// The resident image keeps being sampled until the new one replaces it
+	setImageLayout(texture->m_image,  VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, sourceRange);
+	setImageLayout(request->m_image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, destinationRange);
+
+	commandBufferTexture = VK_NULL_HANDLE;
+
+	coreM->endCommandBuffer(request->m_commandBuffer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::submitStreamingRequest(TextureStreamingRequest* request)
+{
+	VkFenceCreateInfo fenceCI = {};
+	fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	fenceCI.flags = 0;
+
+	VkResult result = vkCreateFence(coreM->getLogicalDevice(), &fenceCI, nullptr, &request->m_fence);
+	assert(result == VK_SUCCESS);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.pNext              = NULL;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers    = &request->m_commandBuffer;
+
+	// Not waited for, the copy executes before the next frame and the image is replaced in a later call
+	result = vkQueueSubmit(coreM->getLogicalDeviceGraphicsQueue(), 1, &submitInfo, request->m_fence);
+	assert(result == VK_SUCCESS);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::destroyStreamingRequest(TextureStreamingRequest* request)
+{
+	if (request->m_thread.joinable())
+	{
+		request->m_thread.join();
+	}
+
+	if (request->m_fence != VK_NULL_HANDLE)
+	{
+		// The copy has to complete before its resources are freed
+		VkResult result = vkWaitForFences(coreM->getLogicalDevice(), 1, &request->m_fence, VK_TRUE, 10000000000);
+		assert(result == VK_SUCCESS);
+		vkDestroyFence(coreM->getLogicalDevice(), request->m_fence, nullptr);
+	}
+
+	if (request->m_commandBuffer != VK_NULL_HANDLE)
+	{
+		CoreManager::freeCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &request->m_commandBuffer);
+	}
+
+	if (request->m_stagingBuffer != nullptr)
+	{
+		bufferM->removeElement(move(string(request->m_stagingBuffer->getName())));
+	}
+
+	if (request->m_image != VK_NULL_HANDLE)
+	{
+		vkDestroyImage(coreM->getLogicalDevice(), request->m_image, nullptr);
+		vkFreeMemory(coreM->getLogicalDevice(), request->m_memory, nullptr);
+	}
+
+	delete request->m_textureInfo;
+	delete request->m_imageGLI2D;
+	delete request;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureStreamingRequest* TextureManager::getStreamingRequest(const Texture* texture)
+{
+	forIT(m_vectorStreamingRequest)
+	{
+		if ((*it)->m_texture == texture)
+		{
+			return *it;
+		}
+	}
+
+	return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+VkDeviceSize TextureManager::estimateResidentMemory(const Texture* texture, uint32_t mipLevel)
+{
+	// Each finer mip level needs roughly four times the memory of the whole mip chain below it
+	if (mipLevel <= texture->m_residentMipLevel)
+	{
+		return texture->m_memorySize << (2 * (texture->m_residentMipLevel - mipLevel));
+	}
+
+	return texture->m_memorySize >> (2 * (mipLevel - texture->m_residentMipLevel));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::setOutputRelative(Texture* texture, vec2 scale)
+{
+	if ((texture == nullptr) || texture->m_isSwapChainTex || texture->m_streamed || (texture->m_mem == VK_NULL_HANDLE) || (texture->m_mipMapLevels != 1))
+	{
+		cout << "ERROR in TextureManager::setOutputRelative, only textures built with TextureManager::buildTexture can be output relative" << endl;
+		return false;
+	}
+
+	texture->m_outputRelative      = true;
+	texture->m_outputRelativeScale = scale;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureManager::resizeTexture(Texture* texture, VkExtent3D extent)
+{
+	if ((texture->m_width == extent.width) && (texture->m_height == extent.height) && (texture->m_depth == extent.depth))
+	{
+		return false;
+	}
+
+	VkImage image = buildImage(texture->m_format,
+							   extent,
+							   1,
+							   texture->m_imageUsageFlags,
+							   texture->m_samples,
+							   texture->m_tiling,
+							   texture->m_imageViewType,
+							   texture->m_flags);
+
+	VkDeviceSize memorySize;
+	VkDeviceMemory memory = buildImageMemory(texture->m_memoryProperties, image, memorySize);
+
+	commandBufferTexture = coreM->acquireFrameCommandBuffer();
+	coreM->beginCommandBuffer(commandBufferTexture);
+	{
+		VkImageSubresourceRange subresourceRange = {};
+		subresourceRange.aspectMask   = texture->m_layoutAspectMask;
+		subresourceRange.baseMipLevel = 0;
+		subresourceRange.levelCount   = 1;
+		subresourceRange.layerCount   = (texture->m_imageViewType == VK_IMAGE_VIEW_TYPE_CUBE) ? 6 : 1;
+
+		setImageLayout(image, texture->m_aspectMask, VK_IMAGE_LAYOUT_UNDEFINED, texture->m_imageLayout, subresourceRange);
+	}
+	coreM->endCommandBuffer(commandBufferTexture);
+	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBufferTexture);
+	coreM->releaseFrameCommandBuffer(commandBufferTexture);
+
+	VkImageView view = buildImageView(texture->m_aspectMask, image, { VK_COMPONENT_SWIZZLE_IDENTITY }, 1, texture->m_format, texture->m_imageViewType);
+
+	// The GPU is idle, the previous image is not referenced by any command buffer in flight
+	vkDestroyImageView(coreM->getLogicalDevice(), texture->m_view, nullptr);
+	vkDestroyImage(coreM->getLogicalDevice(), texture->m_image, nullptr);
+	vkFreeMemory(coreM->getLogicalDevice(), texture->m_mem, nullptr);
+
+	texture->m_image      = image;
+	texture->m_mem        = memory;
+	texture->m_memorySize = memorySize;
+	texture->m_view       = view;
+	texture->m_width      = extent.width;
+	texture->m_height     = extent.height;
+	texture->m_depth      = extent.depth;
+
+	vector<Material*> vectorMaterial = materialM->getVectorElement();
+	forIT(vectorMaterial)
+	{
+		(*it)->updateTextureDescriptor(texture);
+	}
+
+	if (gpuPipelineM->getPipelineInitialized())
+	{
+		emitSignalElement(move(string(texture->getName())), ManagerNotificationType::MNT_CHANGED);
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureManager::resizeOutputRelativeTextures(uint32_t width, uint32_t height)
+{
+	vector<Texture*> vectorTexture = getVectorElement();
+
+	forIT(vectorTexture)
+	{
+		Texture* texture = *it;
+		if (!texture->m_outputRelative)
+		{
+			continue;
+		}
+
+		VkExtent3D extent;
+		extent.width  = glm::max(uint32_t(glm::round(float(width)  * texture->m_outputRelativeScale.x)), 1u);
+		extent.height = glm::max(uint32_t(glm::round(float(height) * texture->m_outputRelativeScale.y)), 1u);
+		extent.depth  = texture->m_depth;
+
+		if (resizeTexture(texture, extent))
+		{
+			cout << "INFO: Output relative texture " << texture->getName() << " resized to (" << extent.width << ", " << extent.height << ")" << endl;
+		}
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,3 +167,19 @@ int CPUBuffer::getAvailableRoomAtCell(int index)
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CPUBuffer::setDataAtCell(int index, const void* data, int size)
+{
+	if (size > int(m_dynamicAllignment))
+	{
+		return false;
+	}
+
+	resetDataAtCell(index);
+	memcpy(m_arrayCellStartPointer[index], data, size);
+	m_arrayCellCurrentPointer[index] = (byte*)m_arrayCellStartPointer[index] + size;
+	m_arrayCellOffset[index]         = size;
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
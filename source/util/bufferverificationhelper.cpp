@@ -15,6 +15,7 @@ limitations under the License.
 */
 
 // GLOBAL INCLUDES
+#include <chrono>
 
 // PROJECT INCLUDES
 #include "../../include/util/bufferverificationhelper.h"
@@ -25,11 +26,30 @@ limitations under the License.
 #include "../../include/rastertechnique/bufferprefixsumtechnique.h"
 #include "../../include/util/vulkanstructinitializer.h"
 #include "../../include/rastertechnique/clusterizationinitaabbtechnique.h"
+#include "../../include/util/mathutil.h"
+#include "../../include/util/parallelutil.h"
+#include "../../include/geometry/meshsimplifier.h"
+#include "../../include/material/material.h"
+#include "../../include/material/materialmanager.h"
+#include "../../include/shader/shaderreflection.h"
+#include "../../include/shader/uniformlayout.h"
+#include "../../include/uniformbuffer/cpubuffer.h"
+#include "../../include/util/managertemplate.h"
 
 // NAMESPACE
 
 // DEFINES
 
+/** Manager with no resource specific behaviour, used in BufferVerificationHelper::benchmarkRecordHandleLookup */
+class BenchmarkManager : public ManagerTemplate<uint>
+{
+public:
+	BenchmarkManager()
+	{
+		m_managerName = "BenchmarkManager";
+	}
+};
+
 // STATIC MEMBER INITIALIZATION
 uint BufferVerificationHelper::m_accumulatedReductionLevelBase = 0;
 uint BufferVerificationHelper::m_accumulatedReductionLevel0    = 0;
@@ -1745,3 +1765,297 @@ void BufferVerificationHelper::verifyClusterVisibilityFirstIndexBuffer()
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BufferVerificationHelper::verifyParallelTransformPointArray(const mat4& matrix, const vectorVec3& vectorPoint, uint numChunk)
+{
+	const uint numPoint = uint(vectorPoint.size());
+	numChunk            = glm::max(glm::min(numChunk, numPoint), 1u);
+
+	// Serial, all the points in the calling thread
+	vectorVec3 vectorSerial = vectorPoint;
+	vec3 serialMin;
+	vec3 serialMax;
+	MathUtil::transformPointArray(matrix, vectorSerial, serialMin, serialMax);
+
+	// Reference, each point transformed with glm
+	vectorVec3 vectorReference = vectorPoint;
+	forIT(vectorReference)
+	{
+		MathUtil::transformPoint(matrix, *it);
+	}
+
+	// Parallel, the points split in chunks transformed by the worker threads
+	vectorVectorVec3 vectorChunk(numChunk);
+	vectorVec3 vectorChunkMin(numChunk);
+	vectorVec3 vectorChunkMax(numChunk);
+	const uint chunkSize = (numPoint + numChunk - 1) / numChunk;
+
+	ParallelUtil::parallelFor(numChunk, [&](uint index)
+	{
+		uint first = glm::min(index * chunkSize, numPoint);
+		uint last  = glm::min(first + chunkSize, numPoint);
+		vectorChunk[index].assign(vectorPoint.begin() + first, vectorPoint.begin() + last);
+		MathUtil::transformPointArray(matrix, vectorChunk[index], vectorChunkMin[index], vectorChunkMax[index]);
+	});
+
+	vectorVec3 vectorParallel;
+	vectorParallel.reserve(numPoint);
+	vec3 parallelMin = vec3( FLT_MAX);
+	vec3 parallelMax = vec3(-FLT_MAX);
+
+	forI(numChunk)
+	{
+		vectorParallel.insert(vectorParallel.end(), vectorChunk[i].begin(), vectorChunk[i].end());
+
+		if (vectorChunk[i].size() > 0)
+		{
+			parallelMin = glm::min(parallelMin, vectorChunkMin[i]);
+			parallelMax = glm::max(parallelMax, vectorChunkMax[i]);
+		}
+	}
+
+	bool result = true;
+
+	if ((numPoint > 0) && (memcmp(vectorSerial.data(), vectorReference.data(), numPoint * sizeof(vec3)) != 0))
+	{
+		cout << "ERROR in BufferVerificationHelper::verifyParallelTransformPointArray, transformPointArray and transformPoint results are different" << endl;
+		result = false;
+	}
+
+	if ((vectorParallel.size() != vectorSerial.size()) || ((numPoint > 0) && (memcmp(vectorSerial.data(), vectorParallel.data(), numPoint * sizeof(vec3)) != 0)))
+	{
+		cout << "ERROR in BufferVerificationHelper::verifyParallelTransformPointArray, serial and parallel results are different" << endl;
+		result = false;
+	}
+
+	if ((numPoint > 0) && ((serialMin != parallelMin) || (serialMax != parallelMax)))
+	{
+		cout << "ERROR in BufferVerificationHelper::verifyParallelTransformPointArray, serial and parallel AABB are different" << endl;
+		result = false;
+	}
+
+	if (result)
+	{
+		cout << "The verification of transformPointArray for " << numPoint << " points in " << numChunk << " chunks finished with no errors detected" << endl;
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BufferVerificationHelper::benchmarkMeshDecimation(const vector<SceneCacheMesh>& vectorMesh, const vectorFloat& vectorErrorBudgetFactor)
+{
+	const uint numMesh = uint(vectorMesh.size());
+	bool result        = true;
+
+	uint numTriangleInput = 0;
+	forIT(vectorMesh)
+	{
+		numTriangleInput += uint(it->m_index.size()) / 3;
+	}
+
+	// Decimates the mesh at index with the error budget factor given as parameter, returning the time taken
+	auto decimate = [&](uint index, float errorBudgetFactor, vectorUint& vectorIndex, vectorVec3& vectorVertex) -> float
+	{
+		const SceneCacheMesh& mesh = vectorMesh[index];
+		float sizeOfAABB           = distance(mesh.m_aabbMin, mesh.m_aabbMax);
+
+		MeshSimplifier simplifier;
+		simplifier.setMesh(mesh.m_index, mesh.m_vertex);
+		simplifier.simplify(uint(mesh.m_vertex.size()) / 9, double(errorBudgetFactor) * double(sizeOfAABB) * double(sizeOfAABB));
+		simplifier.getResult(vectorIndex, vectorVertex);
+
+		return simplifier.getElapsedTime();
+	};
+
+	forIT(vectorErrorBudgetFactor)
+	{
+		const float errorBudgetFactor = *it;
+
+		vector<vectorUint> vectorSerialIndex(numMesh);
+		vectorVectorVec3 vectorSerialVertex(numMesh);
+		float accumulatedTime = 0.0f;
+
+		auto startTime = chrono::high_resolution_clock::now();
+		forI(numMesh)
+		{
+			accumulatedTime += decimate(i, errorBudgetFactor, vectorSerialIndex[i], vectorSerialVertex[i]);
+		}
+		float serialTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+		vector<vectorUint> vectorParallelIndex(numMesh);
+		vectorVectorVec3 vectorParallelVertex(numMesh);
+
+		startTime = chrono::high_resolution_clock::now();
+		ParallelUtil::parallelFor(numMesh, [&](uint index)
+		{
+			decimate(index, errorBudgetFactor, vectorParallelIndex[index], vectorParallelVertex[index]);
+		});
+		float parallelTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+		uint numTriangleOutput = 0;
+		forI(numMesh)
+		{
+			numTriangleOutput += uint(vectorSerialIndex[i].size()) / 3;
+
+			if ((vectorSerialIndex[i] != vectorParallelIndex[i]) || (vectorSerialVertex[i] != vectorParallelVertex[i]))
+			{
+				cout << "ERROR in BufferVerificationHelper::benchmarkMeshDecimation, serial and parallel results are different for mesh " << i << " with error budget factor " << errorBudgetFactor << endl;
+				result = false;
+			}
+		}
+
+		cout << "Mesh decimation benchmark, error budget factor " << errorBudgetFactor << ": " << numMesh << " meshes from " << numTriangleInput << " to " << numTriangleOutput << " triangles, serial " << serialTime << "ms (" << accumulatedTime << "ms in simplify), parallel " << parallelTime << "ms with " << ParallelUtil::getNumWorkerThread() << " threads" << endl;
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BufferVerificationHelper::benchmarkUniformLayout(uint numIteration)
+{
+	bool result                      = true;
+	float totalSwitchTime            = 0.0f;
+	float totalLayoutTime            = 0.0f;
+	vector<Material*> vectorMaterial = materialM->getVectorElement();
+
+	forI(vectorMaterial.size())
+	{
+		Material* material                                   = vectorMaterial[i];
+		vector<ExposedStructField>& vectorExposedStructField = material->refVectorExposedStructField();
+
+		if (vectorExposedStructField.size() == 0)
+		{
+			continue;
+		}
+
+		UniformLayout layout;
+		layout.build(vectorExposedStructField);
+
+		CPUBuffer switchBuffer;
+		switchBuffer.setMinCellSize(int(layout.getSize()));
+		switchBuffer.setNumCells(1);
+		switchBuffer.buildCPUBuffer();
+
+		CPUBuffer layoutBuffer;
+		layoutBuffer.setMinCellSize(int(layout.getSize()));
+		layoutBuffer.setNumCells(1);
+		layoutBuffer.buildCPUBuffer();
+
+		// Previous path, a type switch per field to update the shader CPU copy and another one to append it to the cell
+		auto startTime = chrono::high_resolution_clock::now();
+		forJ(numIteration)
+		{
+			switchBuffer.resetDataAtCell(0);
+			forIT(vectorExposedStructField)
+			{
+				ShaderReflection::setResourceCPUValue(*it);
+				ShaderReflection::appendExposedStructFieldDataToUniformBufferCell(&switchBuffer, 0, &(*it));
+			}
+		}
+		float switchTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+		// Compiled layout, a comparison per field and a single copy to the cell
+		vectorUint vectorDirtyField;
+		startTime = chrono::high_resolution_clock::now();
+		forJ(numIteration)
+		{
+			vectorDirtyField.clear();
+			layout.update(vectorDirtyField);
+			layoutBuffer.setDataAtCell(0, layout.getData().data(), int(layout.getSize()));
+		}
+		float layoutTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+		if (memcmp(switchBuffer.refUBHostMemory(), layoutBuffer.refUBHostMemory(), layout.getSize()) != 0)
+		{
+			cout << "ERROR in BufferVerificationHelper::benchmarkUniformLayout, packed data is different for material " << material->getName() << endl;
+			result = false;
+		}
+
+		if (m_outputAllInformationConsole)
+		{
+			cout << "Uniform layout benchmark, material " << material->getName() << " (" << vectorExposedStructField.size() << " fields, " << layout.getSize() << " bytes): switch " << switchTime << "ms, layout " << layoutTime << "ms" << endl;
+		}
+
+		totalSwitchTime += switchTime;
+		totalLayoutTime += layoutTime;
+	}
+
+	cout << "Uniform layout benchmark, " << vectorMaterial.size() << " materials packed " << numIteration << " times: switch " << totalSwitchTime << "ms, layout " << totalLayoutTime << "ms" << endl;
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BufferVerificationHelper::benchmarkRecordHandleLookup(uint numNode, uint numIteration)
+{
+	const string lightingMaterialSuffix = "_Lighting"; // Same suffix as SceneLightingTechnique::m_lightingMaterialSuffix
+
+	BenchmarkManager manager;
+	vectorUint vectorElement(numNode);
+	vectorString vectorNodeMaterialName(numNode);
+	vector<uint*> vectorSceneElement(numNode);
+
+	forI(numNode)
+	{
+		vectorElement[i]          = i;
+		vectorNodeMaterialName[i] = "benchmarkMaterial" + to_string(i);
+		vectorSceneElement[i]     = &vectorElement[i];
+		manager.addElement(vectorNodeMaterialName[i] + lightingMaterialSuffix, &vectorElement[i]);
+	}
+
+	// Previous record path: a material name built per node, a lookup by name and a linear scan for the scene index
+	uint64_t nameChecksum = 0;
+	auto startTime        = chrono::high_resolution_clock::now();
+	forJ(numIteration)
+	{
+		forI(numNode)
+		{
+			string materialName = vectorNodeMaterialName[i];
+			materialName       += lightingMaterialSuffix;
+			uint* element       = manager.getElement(move(materialName));
+			int elementIndex    = findElementIndex(vectorSceneElement, element);
+			nameChecksum       += uint64_t(*element) * uint64_t(numNode) + uint64_t(elementIndex);
+		}
+	}
+	float nameTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	// Handles and scene indices resolved once, as done in SceneLightingTechnique::init
+	startTime = chrono::high_resolution_clock::now();
+	vectorUint vectorNodeMaterialHandle(numNode);
+	vectorUint vectorNodeSceneIndex(numNode);
+	forI(numNode)
+	{
+		vectorNodeMaterialHandle[i] = manager.getElementHandle(vectorNodeMaterialName[i] + lightingMaterialSuffix);
+		vectorNodeSceneIndex[i]     = uint(findElementIndex(vectorSceneElement, manager.getElementByHandle(vectorNodeMaterialHandle[i])));
+	}
+	float setupTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	uint64_t handleChecksum = 0;
+	startTime               = chrono::high_resolution_clock::now();
+	forJ(numIteration)
+	{
+		forI(numNode)
+		{
+			uint* element   = manager.getElementByHandle(vectorNodeMaterialHandle[i]);
+			handleChecksum += uint64_t(*element) * uint64_t(numNode) + uint64_t(vectorNodeSceneIndex[i]);
+		}
+	}
+	float handleTime = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	bool result = (nameChecksum == handleChecksum);
+
+	if (!result)
+	{
+		cout << "ERROR in BufferVerificationHelper::benchmarkRecordHandleLookup, name and handle lookups resolved different elements" << endl;
+	}
+
+	cout << "Record handle lookup benchmark, " << numNode << " nodes, " << numIteration << " record loops: name lookup " << nameTime << "ms, handle lookup " << handleTime << "ms (" << setupTime << "ms resolving the handles once)" << endl;
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,357 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/util/clustervisibilitycache.h"
+#include "../../include/model/scenecache.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+#define CLUSTER_VISIBILITY_NUM_FACE 6 // Number of faces of each voxel
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Returns the 16 bit cluster index at the position given as parameter of the packed clusterVisibilityCompactedBuffer content
+* @param vectorCompacted [in] content of clusterVisibilityCompactedBuffer
+* @param index           [in] index of the 16 bit element
+* @return cluster index */
+static inline uint getPackedClusterIndex(const vectorUint& vectorCompacted, uint index)
+{
+	return (vectorCompacted[index >> 1] >> ((index & 1) * 16)) & 0x0000FFFF;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ClusterVisibilityCache::ClusterVisibilityCache()
+	: m_numOccupiedVoxel(0)
+	, m_numCluster(0)
+	, m_numVisibleCluster(0)
+	, m_checksum(0)
+{
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t ClusterVisibilityCache::computeKey(const vectorUint8& vectorVoxelHashed, const vectorUint8& vectorClusterData, uint voxelizationWidth, uint numThreadPerFace)
+{
+	uint version = CLUSTER_VISIBILITY_CACHE_VERSION;
+
+	uint64_t key = SceneCache::hashFNV1a(vectorVoxelHashed.data(), vectorVoxelHashed.size(), FNV1A_OFFSET_BASIS);
+	key          = SceneCache::hashFNV1a(vectorClusterData.data(), vectorClusterData.size(), key);
+	key          = SceneCache::hashFNV1a(&voxelizationWidth, sizeof(uint), key);
+	key          = SceneCache::hashFNV1a(&numThreadPerFace, sizeof(uint), key);
+	key          = SceneCache::hashFNV1a(&version, sizeof(uint), key);
+
+	return key;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityCache::encode(const vectorUint& vectorNumber, const vectorUint& vectorFirstIndex, const vectorUint& vectorCompacted, uint numOccupiedVoxel, uint numCluster)
+{
+	clear();
+
+	const uint numFace = numOccupiedVoxel * CLUSTER_VISIBILITY_NUM_FACE;
+
+	if ((uint(vectorNumber.size()) < numFace) || (uint(vectorFirstIndex.size()) < numFace))
+	{
+		cout << "ERROR in ClusterVisibilityCache::encode, cluster visibility buffers smaller than the number of voxel faces" << endl;
+		return false;
+	}
+
+	const uint maxPackedIndex = uint(vectorCompacted.size()) * 2;
+	uint expectedFirstIndex   = 0;
+
+	m_vectorFaceMask.resize(numOccupiedVoxel, 0);
+
+	forI(numOccupiedVoxel)
+	{
+		forJ(CLUSTER_VISIBILITY_NUM_FACE)
+		{
+			const uint faceIndex  = i * CLUSTER_VISIBILITY_NUM_FACE + j;
+			const uint numVisible = vectorNumber[faceIndex];
+
+			if (numVisible == 0)
+			{
+				continue;
+			}
+
+			const uint firstIndex = vectorFirstIndex[faceIndex];
+
+			if ((firstIndex != expectedFirstIndex) || ((firstIndex + numVisible) > maxPackedIndex))
+			{
+				cout << "ERROR in ClusterVisibilityCache::encode, inconsistent first index " << firstIndex << " for voxel face " << faceIndex << endl;
+				clear();
+				return false;
+			}
+
+			m_vectorFaceMask[i] |= uint8_t(1 << j);
+			writeVarUint(numVisible, m_vectorDeltaStream);
+
+			uint previous = 0;
+			for (uint k = 0; k < numVisible; ++k)
+			{
+				const uint clusterIndex = getPackedClusterIndex(vectorCompacted, firstIndex + k);
+
+				if (clusterIndex >= numCluster)
+				{
+					cout << "ERROR in ClusterVisibilityCache::encode, cluster index " << clusterIndex << " out of range for voxel face " << faceIndex << endl;
+					clear();
+					return false;
+				}
+
+				const int delta = int(clusterIndex) - int(previous);
+				writeVarUint((uint(delta) << 1) ^ uint(delta >> 31), m_vectorDeltaStream);
+				previous = clusterIndex;
+			}
+
+			expectedFirstIndex += numVisible;
+		}
+	}
+
+	m_numOccupiedVoxel  = numOccupiedVoxel;
+	m_numCluster        = numCluster;
+	m_numVisibleCluster = expectedFirstIndex;
+	m_checksum          = computeChecksum(vectorNumber, vectorCompacted, m_numOccupiedVoxel, m_numVisibleCluster);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityCache::decode(vectorUint& vectorNumber, vectorUint& vectorFirstIndex, vectorUint& vectorCompacted) const
+{
+	const uint numFace = m_numOccupiedVoxel * CLUSTER_VISIBILITY_NUM_FACE;
+
+	vectorNumber.assign(numFace, 0);
+	vectorFirstIndex.assign(numFace, 0);
+	vectorCompacted.assign((m_numVisibleCluster + 1) / 2, 0);
+
+	size_t offset       = 0;
+	uint nextFirstIndex = 0;
+
+	forI(m_numOccupiedVoxel)
+	{
+		const uint8_t faceMask = m_vectorFaceMask[i];
+
+		forJ(CLUSTER_VISIBILITY_NUM_FACE)
+		{
+			const uint faceIndex        = i * CLUSTER_VISIBILITY_NUM_FACE + j;
+			vectorFirstIndex[faceIndex] = nextFirstIndex;
+
+			if ((faceMask & (1 << j)) == 0)
+			{
+				continue;
+			}
+
+			uint numVisible;
+			if (!readVarUint(m_vectorDeltaStream, offset, numVisible) || (numVisible == 0) || ((nextFirstIndex + numVisible) > m_numVisibleCluster))
+			{
+				cout << "ERROR in ClusterVisibilityCache::decode, corrupted number of visible clusters for voxel face " << faceIndex << endl;
+				return false;
+			}
+
+			vectorNumber[faceIndex] = numVisible;
+
+			uint previous = 0;
+			for (uint k = 0; k < numVisible; ++k)
+			{
+				uint zigzag;
+				if (!readVarUint(m_vectorDeltaStream, offset, zigzag))
+				{
+					cout << "ERROR in ClusterVisibilityCache::decode, truncated cluster index stream for voxel face " << faceIndex << endl;
+					return false;
+				}
+
+				const int delta         = int(zigzag >> 1) ^ -int(zigzag & 1);
+				const uint clusterIndex = uint(int(previous) + delta);
+
+				if (clusterIndex >= m_numCluster)
+				{
+					cout << "ERROR in ClusterVisibilityCache::decode, cluster index " << clusterIndex << " out of range for voxel face " << faceIndex << endl;
+					return false;
+				}
+
+				const uint packedIndex            = nextFirstIndex + k;
+				vectorCompacted[packedIndex >> 1] |= clusterIndex << ((packedIndex & 1) * 16);
+				previous                          = clusterIndex;
+			}
+
+			nextFirstIndex += numVisible;
+		}
+	}
+
+	if ((nextFirstIndex != m_numVisibleCluster) || (offset != m_vectorDeltaStream.size()))
+	{
+		cout << "ERROR in ClusterVisibilityCache::decode, decoded data size does not match the stored one" << endl;
+		return false;
+	}
+
+	if (computeChecksum(vectorNumber, vectorCompacted, m_numOccupiedVoxel, m_numVisibleCluster) != m_checksum)
+	{
+		cout << "ERROR in ClusterVisibilityCache::decode, checksum of the decoded data does not match the stored one" << endl;
+		return false;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityCache::load(const string& cachePath, uint64_t key)
+{
+	clear();
+
+	ifstream file(cachePath, ios::binary | ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	vectorUint8 vectorData(size_t(file.tellg()));
+	file.seekg(0, ios::beg);
+	file.read(reinterpret_cast<char*>(vectorData.data()), vectorData.size());
+
+	size_t offset      = 0;
+	uint magic         = 0;
+	uint version       = 0;
+	uint64_t keyStored = 0;
+
+	if (!SceneCache::readValue(vectorData, offset, magic) || !SceneCache::readValue(vectorData, offset, version) || !SceneCache::readValue(vectorData, offset, keyStored) ||
+		(magic != CLUSTER_VISIBILITY_CACHE_MAGIC) || (version != CLUSTER_VISIBILITY_CACHE_VERSION) || (keyStored != key))
+	{
+		return false;
+	}
+
+	bool result = true;
+	result &= SceneCache::readValue(vectorData, offset, m_numOccupiedVoxel);
+	result &= SceneCache::readValue(vectorData, offset, m_numCluster);
+	result &= SceneCache::readValue(vectorData, offset, m_numVisibleCluster);
+	result &= SceneCache::readValue(vectorData, offset, m_checksum);
+	result &= SceneCache::readArray(vectorData, offset, m_vectorFaceMask);
+	result &= SceneCache::readArray(vectorData, offset, m_vectorDeltaStream);
+	result &= (uint(m_vectorFaceMask.size()) == m_numOccupiedVoxel);
+
+	if (!result)
+	{
+		cout << "ERROR in ClusterVisibilityCache::load, corrupted cache file " << cachePath << endl;
+		clear();
+	}
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityCache::save(const string& cachePath, uint64_t key) const
+{
+	vectorUint8 vectorData;
+
+	SceneCache::writeValue(uint(CLUSTER_VISIBILITY_CACHE_MAGIC), vectorData);
+	SceneCache::writeValue(uint(CLUSTER_VISIBILITY_CACHE_VERSION), vectorData);
+	SceneCache::writeValue(key, vectorData);
+	SceneCache::writeValue(m_numOccupiedVoxel, vectorData);
+	SceneCache::writeValue(m_numCluster, vectorData);
+	SceneCache::writeValue(m_numVisibleCluster, vectorData);
+	SceneCache::writeValue(m_checksum, vectorData);
+	SceneCache::writeArray(m_vectorFaceMask, vectorData);
+	SceneCache::writeArray(m_vectorDeltaStream, vectorData);
+
+	ofstream file(cachePath, ios::binary | ios::trunc);
+
+	if (!file.is_open())
+	{
+		cout << "ERROR in ClusterVisibilityCache::save, unable to open file " << cachePath << endl;
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(vectorData.data()), vectorData.size());
+
+	return file.good();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterVisibilityCache::clear()
+{
+	m_numOccupiedVoxel  = 0;
+	m_numCluster        = 0;
+	m_numVisibleCluster = 0;
+	m_checksum          = 0;
+	m_vectorFaceMask.clear();
+	m_vectorDeltaStream.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterVisibilityCache::writeVarUint(uint value, vectorUint8& vectorData)
+{
+	while (value >= 0x80)
+	{
+		vectorData.push_back(uint8_t(value | 0x80));
+		value >>= 7;
+	}
+
+	vectorData.push_back(uint8_t(value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClusterVisibilityCache::readVarUint(const vectorUint8& vectorData, size_t& offset, uint& value)
+{
+	value      = 0;
+	uint shift = 0;
+
+	while ((offset < vectorData.size()) && (shift < 35))
+	{
+		const uint8_t byte = vectorData[offset++];
+		value             |= uint(byte & 0x7F) << shift;
+
+		if ((byte & 0x80) == 0)
+		{
+			return true;
+		}
+
+		shift += 7;
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t ClusterVisibilityCache::computeChecksum(const vectorUint& vectorNumber, const vectorUint& vectorCompacted, uint numOccupiedVoxel, uint numVisibleCluster)
+{
+	uint64_t checksum = SceneCache::hashFNV1a(vectorNumber.data(), size_t(numOccupiedVoxel) * CLUSTER_VISIBILITY_NUM_FACE * sizeof(uint), FNV1A_OFFSET_BASIS);
+
+	forI(numVisibleCluster)
+	{
+		const uint16_t clusterIndex = uint16_t(getPackedClusterIndex(vectorCompacted, i));
+		checksum                    = SceneCache::hashFNV1a(&clusterIndex, sizeof(uint16_t), checksum);
+	}
+
+	return checksum;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,524 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+#include <chrono>
+
+// PROJECT INCLUDES
+#include "../../include/util/lightingreferencehelper.h"
+#include "../../include/util/loopmacrodefines.h"
+#include "../../include/util/parallelutil.h"
+#include "../../include/util/mathutil.h"
+#include "../../include/util/bufferverificationhelper.h"
+#include "../../include/buffer/buffer.h"
+#include "../../include/buffer/buffermanager.h"
+#include "../../include/core/gpupipeline.h"
+#include "../../include/scene/scene.h"
+#include "../../include/camera/camera.h"
+#include "../../include/camera/cameramanager.h"
+#include "../../include/rastertechnique/litclustertechnique.h"
+#include "../../include/rastertechnique/scenevoxelizationtechnique.h"
+#include "../../include/rastertechnique/bufferprefixsumtechnique.h"
+#include "../../include/rastertechnique/clusterizationbuildfinalbuffertechnique.h"
+#include "../../include/rastertechnique/clusterizationinitaabbtechnique.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+const vec3 LightingReferenceHelper::m_arrayFaceNormal[LIGHTING_REFERENCE_NUM_FACE] =
+{
+	vec3( 1.0f,  0.0f,  0.0f),
+	vec3(-1.0f,  0.0f,  0.0f),
+	vec3( 0.0f,  1.0f,  0.0f),
+	vec3( 0.0f, -1.0f,  0.0f),
+	vec3( 0.0f,  0.0f,  1.0f),
+	vec3( 0.0f,  0.0f, -1.0f)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Copies the content of the buffer with name given as parameter as a vector of uint
+* @param bufferName [in]  name of the buffer to copy
+* @param vectorData [out] buffer content
+* @return true if the buffer exists, false otherwise */
+static bool copyBufferContent(string&& bufferName, vectorUint& vectorData)
+{
+	Buffer* buffer = bufferM->getElement(move(string(bufferName)));
+
+	if (buffer == nullptr)
+	{
+		cout << "ERROR: buffer " << bufferName << " not found in LightingReferenceHelper::gatherInput" << endl;
+		return false;
+	}
+
+	vectorUint8 vectorByte;
+	buffer->getContentCopy(vectorByte);
+	vectorData.resize(vectorByte.size() / sizeof(uint));
+	memcpy(vectorData.data(), vectorByte.data(), vectorData.size() * sizeof(uint));
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightingReferenceHelper::gatherInput(LightingReferenceInput& input)
+{
+	SceneVoxelizationTechnique* voxelizationTechnique           = static_cast<SceneVoxelizationTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("SceneVoxelizationTechnique"))));
+	BufferPrefixSumTechnique* prefixSumTechnique                = static_cast<BufferPrefixSumTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("BufferPrefixSumTechnique"))));
+	ClusterizationBuildFinalBufferTechnique* clusterTechnique   = static_cast<ClusterizationBuildFinalBufferTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("ClusterizationBuildFinalBufferTechnique"))));
+	LitClusterTechnique* litClusterTechnique                    = static_cast<LitClusterTechnique*>(gpuPipelineM->getRasterTechniqueByName(move(string("LitClusterTechnique"))));
+	Camera* emitterCamera                                       = cameraM->getElement(move(string("emitter")));
+
+	if ((voxelizationTechnique == nullptr) || (prefixSumTechnique == nullptr) || (clusterTechnique == nullptr) || (litClusterTechnique == nullptr) || (emitterCamera == nullptr))
+	{
+		cout << "ERROR: techniques or emitter camera not available in LightingReferenceHelper::gatherInput" << endl;
+		return false;
+	}
+
+	vec3 min3D;
+	vec3 max3D;
+	sceneM->refBox().getCenteredBoxMinMax(min3D, max3D);
+
+	input.m_voxelizationWidth             = uint(voxelizationTechnique->getVoxelizedSceneWidth());
+	input.m_sceneMin                      = min3D;
+	input.m_sceneExtent                   = max3D - min3D;
+	input.m_voxelWorldSize                = input.m_sceneExtent / float(input.m_voxelizationWidth);
+	input.m_lightPosition                 = litClusterTechnique->getCameraPosition();
+	input.m_lightForward                  = litClusterTechnique->getCameraForward();
+	input.m_emitterRadiance               = litClusterTechnique->getEmitterRadiance();
+	input.m_formFactorClusterToVoxelAdded = float(gpuPipelineM->getRasterFlagValue(move(string("FORM_FACTOR_CLUSTER_TO_VOXEL_ADDED")))) / LIGHTING_REFERENCE_FORM_FACTOR_ADDED_DIVISOR;
+	input.m_irradianceMultiplier          = float(gpuPipelineM->getRasterFlagValue(move(string("IRRADIANCE_MULTIPLIER"))))              / LIGHTING_REFERENCE_IRRADIANCE_DIVISOR;
+	input.m_directIrradianceMultiplier    = float(gpuPipelineM->getRasterFlagValue(move(string("DIRECT_IRRADIANCE_MULTIPLIER"))))       / LIGHTING_REFERENCE_DIRECT_IRRADIANCE_DIVISOR;
+	memcpy(&input.m_arrayFrustumPlane[0], emitterCamera->getArrayFrustumPlane(), 6 * sizeof(vec4));
+
+	bool result = true;
+	result &= copyBufferContent(move(string("voxelHashedPositionCompactedBuffer")), input.m_vectorVoxelHashed);
+	result &= copyBufferContent(move(string("voxelOccupiedBuffer")),                input.m_vectorVoxelOccupied);
+	result &= copyBufferContent(move(string("clusterVisibilityNumberBuffer")),      input.m_vectorClusterVisibilityNumber);
+	result &= copyBufferContent(move(string("clusterVisibilityFirstIndexBuffer")),  input.m_vectorClusterVisibilityFirst);
+	result &= copyBufferContent(move(string("clusterVisibilityCompactedBuffer")),   input.m_vectorClusterVisibility);
+
+	Buffer* clusterizationFinalBuffer = bufferM->getElement(move(string("clusterizationFinalBuffer")));
+	if (clusterizationFinalBuffer == nullptr)
+	{
+		cout << "ERROR: buffer clusterizationFinalBuffer not found in LightingReferenceHelper::gatherInput" << endl;
+		return false;
+	}
+
+	clusterizationFinalBuffer->getContentCopy(input.m_vectorClusterData);
+	input.m_numCluster = glm::min(clusterTechnique->getCompactedClusterNumber(), uint(input.m_vectorClusterData.size() / sizeof(ClusterData)));
+
+	// Buffers can be bigger than the number of elements in use
+	input.m_vectorVoxelHashed.resize(glm::min(uint(input.m_vectorVoxelHashed.size()), prefixSumTechnique->getFirstIndexOccupiedElement()));
+
+	return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightingReferenceHelper::compute(const LightingReferenceInput& input, LightingReferenceResult& result)
+{
+	auto startTime = chrono::high_resolution_clock::now();
+	computeDirectIrradiance(input, result);
+	result.m_directMilliseconds = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	startTime = chrono::high_resolution_clock::now();
+	computeLightBounce(input, result);
+	result.m_bounceMilliseconds = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	startTime = chrono::high_resolution_clock::now();
+	computeGaussianFilter(input, result);
+	result.m_filterMilliseconds = chrono::duration<float, milli>(chrono::high_resolution_clock::now() - startTime).count();
+
+	const uint numFace      = uint(input.m_vectorVoxelHashed.size()) * LIGHTING_REFERENCE_NUM_FACE;
+	const float totalTime   = result.m_directMilliseconds + result.m_bounceMilliseconds + result.m_filterMilliseconds;
+	const float facesPerSec = (totalTime > 0.0f) ? (float(numFace) / (totalTime * 0.001f)) : 0.0f;
+
+	cout << "LightingReferenceHelper: " << numFace << " voxel faces, " << input.m_numCluster << " clusters, " << ParallelUtil::getNumWorkerThread() << " threads" << endl;
+	cout << "LightingReferenceHelper: direct " << result.m_directMilliseconds << "ms, bounce " << result.m_bounceMilliseconds << "ms, filter " << result.m_filterMilliseconds << "ms, " << facesPerSec << " voxel faces per second" << endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightingReferenceHelper::computeDirectIrradiance(const LightingReferenceInput& input, LightingReferenceResult& result)
+{
+	const uint numVoxel = uint(input.m_vectorVoxelHashed.size());
+
+	result.m_vectorVoxelLitFace.assign(numVoxel, 0);
+	result.m_vectorDirectIrradiance.assign(numVoxel * LIGHTING_REFERENCE_NUM_FACE, 0.0f);
+
+	ParallelUtil::parallelFor(numVoxel, [&](uint index)
+	{
+		const uvec3 coordinates = BufferVerificationHelper::unhashValue(input.m_vectorVoxelHashed[index], input.m_voxelizationWidth);
+		const vec3 center       = input.m_sceneMin + (vec3(coordinates) + vec3(0.5f)) * input.m_voxelWorldSize;
+
+		if (!MathUtil::aabbIntersectsFrustum(&input.m_arrayFrustumPlane[0], center, center))
+		{
+			return;
+		}
+
+		// The visibility test is shared by all the faces of the voxel and only done if any of them faces the emitter
+		int pathFree = -1;
+
+		forI(LIGHTING_REFERENCE_NUM_FACE)
+		{
+			const vec3 facePosition = center + m_arrayFaceNormal[i] * input.m_voxelWorldSize * 0.5f;
+			const vec3 toLight      = input.m_lightPosition - facePosition;
+			const float distance2   = glm::max(dot(toLight, toLight), 1.0e-6f);
+			const float cosine      = dot(m_arrayFaceNormal[i], toLight / sqrt(distance2));
+
+			if (cosine <= 0.0f)
+			{
+				continue;
+			}
+
+			if (pathFree == -1)
+			{
+				pathFree = isPathFree(input, coordinates, input.m_lightPosition) ? 1 : 0;
+			}
+
+			if (pathFree == 0)
+			{
+				return;
+			}
+
+			result.m_vectorVoxelLitFace[index]                                  |= uint8_t(1 << i);
+			result.m_vectorDirectIrradiance[index * LIGHTING_REFERENCE_NUM_FACE + i] = input.m_directIrradianceMultiplier * input.m_emitterRadiance * cosine / distance2;
+		}
+	});
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightingReferenceHelper::computeLightBounce(const LightingReferenceInput& input, LightingReferenceResult& result)
+{
+	const uint numVoxel            = uint(input.m_vectorVoxelHashed.size());
+	const ClusterData* pCluster    = (const ClusterData*)(input.m_vectorClusterData.data());
+	const float voxelFaceArea      = input.m_voxelWorldSize.x * input.m_voxelWorldSize.y;
+	const uint maxClusterVoxel     = uint(sizeof(pCluster->arrayVoxels) / sizeof(uint));
+
+	result.m_vectorClusterIrradiance.assign(input.m_numCluster, 0.0f);
+	result.m_vectorBounceIrradiance.assign(numVoxel * LIGHTING_REFERENCE_NUM_FACE, 0.0f);
+
+	// Cluster irradiance: mean direct irradiance of the faces of the cluster voxels oriented as the cluster main direction
+	ParallelUtil::parallelFor(input.m_numCluster, [&](uint index)
+	{
+		const ClusterData& cluster = pCluster[index];
+		const vec3 direction       = vec3(cluster.mainDirection);
+		const vec3 absDirection    = glm::abs(direction);
+		const uint axis            = (absDirection.x >= absDirection.y) ? ((absDirection.x >= absDirection.z) ? 0 : 2) : ((absDirection.y >= absDirection.z) ? 1 : 2);
+		const uint face            = 2 * axis + ((direction[axis] >= 0.0f) ? 0 : 1);
+		const uint numClusterVoxel = glm::min(uint(glm::max(cluster.centerAABB.w, 0)), maxClusterVoxel);
+
+		float irradiance = 0.0f;
+		forI(numClusterVoxel)
+		{
+			const uint voxelIndex = cluster.arrayVoxels[i];
+			if (voxelIndex < numVoxel)
+			{
+				irradiance += result.m_vectorDirectIrradiance[voxelIndex * LIGHTING_REFERENCE_NUM_FACE + face];
+			}
+		}
+
+		result.m_vectorClusterIrradiance[index] = (numClusterVoxel > 0) ? (irradiance / float(numClusterVoxel)) : 0.0f;
+	});
+
+	// Voxel face irradiance: contribution of each cluster visible from the voxel face
+	ParallelUtil::parallelFor(numVoxel, [&](uint index)
+	{
+		const uvec3 coordinates = BufferVerificationHelper::unhashValue(input.m_vectorVoxelHashed[index], input.m_voxelizationWidth);
+		const vec3 center       = input.m_sceneMin + (vec3(coordinates) + vec3(0.5f)) * input.m_voxelWorldSize;
+
+		forI(LIGHTING_REFERENCE_NUM_FACE)
+		{
+			const uint faceIndex = index * LIGHTING_REFERENCE_NUM_FACE + i;
+
+			if ((faceIndex >= uint(input.m_vectorClusterVisibilityNumber.size())) || (faceIndex >= uint(input.m_vectorClusterVisibilityFirst.size())))
+			{
+				return;
+			}
+
+			const uint numVisible   = input.m_vectorClusterVisibilityNumber[faceIndex];
+			const uint firstVisible = input.m_vectorClusterVisibilityFirst[faceIndex];
+			const vec3 facePosition = center + m_arrayFaceNormal[i] * input.m_voxelWorldSize * 0.5f;
+			float irradiance        = 0.0f;
+
+			forJ(numVisible)
+			{
+				const uint packedIndex = firstVisible + j;
+
+				if (packedIndex >= uint(input.m_vectorClusterVisibility.size()) * 2)
+				{
+					break;
+				}
+
+				// clusterVisibilityCompactedBuffer stores two 16 bit cluster indices per element
+				const uint clusterIndex = (input.m_vectorClusterVisibility[packedIndex >> 1] >> ((packedIndex & 1) * 16)) & 0xFFFF;
+
+				if (clusterIndex >= input.m_numCluster)
+				{
+					continue;
+				}
+
+				const ClusterData& cluster = pCluster[clusterIndex];
+				const vec3 clusterCenter   = input.m_sceneMin + (vec3(ivec3(cluster.centerAABB)) + vec3(0.5f)) * input.m_voxelWorldSize;
+				const vec3 toCluster       = clusterCenter - facePosition;
+				const float distance2      = glm::max(dot(toCluster, toCluster), 1.0e-6f);
+				const vec3 direction       = toCluster / sqrt(distance2);
+				const float cosineFace     = dot(m_arrayFaceNormal[i], direction);
+				const float cosineCluster  = dot(vec3(cluster.mainDirection), -direction);
+
+				if ((cosineFace <= 0.0f) || (cosineCluster <= 0.0f))
+				{
+					continue;
+				}
+
+				const float reflectance = (cluster.meanReflectance.x + cluster.meanReflectance.y + cluster.meanReflectance.z) / 3.0f;
+				const float area        = float(glm::max(cluster.centerAABB.w, 0)) * voxelFaceArea;
+				const float formFactor  = cosineFace * cosineCluster * area / (distance2 + input.m_formFactorClusterToVoxelAdded);
+				irradiance             += reflectance * result.m_vectorClusterIrradiance[clusterIndex] * formFactor / glm::pi<float>();
+			}
+
+			result.m_vectorBounceIrradiance[faceIndex] = input.m_irradianceMultiplier * irradiance;
+		}
+	});
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void LightingReferenceHelper::computeGaussianFilter(const LightingReferenceInput& input, LightingReferenceResult& result)
+{
+	const uint numVoxel   = uint(input.m_vectorVoxelHashed.size());
+	const int width       = int(input.m_voxelizationWidth);
+	const float twoSigma2 = 2.0f * LIGHTING_REFERENCE_FILTER_SIGMA * LIGHTING_REFERENCE_FILTER_SIGMA;
+
+	result.m_vectorFilteredIrradiance.assign(numVoxel * LIGHTING_REFERENCE_NUM_FACE, 0.0f);
+
+	ParallelUtil::parallelFor(numVoxel, [&](uint index)
+	{
+		const ivec3 coordinates = ivec3(BufferVerificationHelper::unhashValue(input.m_vectorVoxelHashed[index], input.m_voxelizationWidth));
+		float arraySum[LIGHTING_REFERENCE_NUM_FACE]    = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+		float arrayWeight[LIGHTING_REFERENCE_NUM_FACE] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (int z = -1; z <= 1; ++z)
+		{
+			for (int y = -1; y <= 1; ++y)
+			{
+				for (int x = -1; x <= 1; ++x)
+				{
+					const ivec3 neighbour = coordinates + ivec3(x, y, z);
+
+					if (glm::any(glm::lessThan(neighbour, ivec3(0))) || glm::any(glm::greaterThanEqual(neighbour, ivec3(width))) || !isVoxelOccupied(input, neighbour))
+					{
+						continue;
+					}
+
+					const int neighbourIndex = findVoxelIndex(input, BufferVerificationHelper::getHashedIndex(uvec3(neighbour), input.m_voxelizationWidth));
+
+					if (neighbourIndex == -1)
+					{
+						continue;
+					}
+
+					const float weight = exp(-float(x * x + y * y + z * z) / twoSigma2);
+
+					forI(LIGHTING_REFERENCE_NUM_FACE)
+					{
+						arraySum[i]    += weight * result.m_vectorBounceIrradiance[neighbourIndex * LIGHTING_REFERENCE_NUM_FACE + i];
+						arrayWeight[i] += weight;
+					}
+				}
+			}
+		}
+
+		forI(LIGHTING_REFERENCE_NUM_FACE)
+		{
+			result.m_vectorFilteredIrradiance[index * LIGHTING_REFERENCE_NUM_FACE + i] = (arrayWeight[i] > 0.0f) ? (arraySum[i] / arrayWeight[i]) : 0.0f;
+		}
+	});
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightingReferenceHelper::compareLitVoxel(const LightingReferenceResult& result, float tolerance)
+{
+	vectorUint vectorLitTestVoxel;
+	if (!copyBufferContent(move(string("litTestVoxelBuffer")), vectorLitTestVoxel))
+	{
+		return false;
+	}
+
+	const uint numVoxel = glm::min(uint(vectorLitTestVoxel.size()), uint(result.m_vectorVoxelLitFace.size()));
+	uint numDifferent   = 0;
+
+	forI(numVoxel)
+	{
+		if ((vectorLitTestVoxel[i] != 0) != (result.m_vectorVoxelLitFace[i] != 0))
+		{
+			numDifferent++;
+		}
+	}
+
+	const float ratio = (numVoxel > 0) ? (float(numDifferent) / float(numVoxel)) : 0.0f;
+	cout << "LightingReferenceHelper: " << numDifferent << " of " << numVoxel << " voxels with a different lit test result (" << ratio * 100.0f << "%)" << endl;
+
+	return (ratio <= tolerance);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightingReferenceHelper::compareIrradiance(const vectorFloat& vectorIrradiance, string&& bufferName, float tolerance, const vectorUint8* vectorVoxelMask)
+{
+	Buffer* buffer = bufferM->getElement(move(string(bufferName)));
+
+	if (buffer == nullptr)
+	{
+		cout << "ERROR: buffer " << bufferName << " not found in LightingReferenceHelper::compareIrradiance" << endl;
+		return false;
+	}
+
+	vectorUint8 vectorByte;
+	buffer->getContentCopy(vectorByte);
+	const float* pData  = (const float*)(vectorByte.data());
+	const uint numVoxel = glm::min(uint(vectorByte.size() / (LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER * sizeof(float))), uint(vectorIrradiance.size()) / LIGHTING_REFERENCE_NUM_FACE);
+
+	uint numDifferent    = 0;
+	uint numCompared     = 0;
+	float maxRelativeDif = 0.0f;
+
+	forI(numVoxel)
+	{
+		if ((vectorVoxelMask != nullptr) && ((i >= uint(vectorVoxelMask->size())) || ((*vectorVoxelMask)[i] == 0)))
+		{
+			continue;
+		}
+
+		numCompared++;
+
+		forJ(LIGHTING_REFERENCE_NUM_FACE)
+		{
+			const float gpuValue      = pData[i * LIGHT_BOUNCE_VOXEL_FLOAT_NUMBER + j * LIGHTING_REFERENCE_FLOAT_PER_FACE];
+			const float cpuValue      = vectorIrradiance[i * LIGHTING_REFERENCE_NUM_FACE + j];
+			const float relativeDif   = glm::abs(gpuValue - cpuValue) / glm::max(glm::abs(cpuValue), 1.0e-3f);
+			maxRelativeDif            = glm::max(maxRelativeDif, relativeDif);
+
+			if (relativeDif > tolerance)
+			{
+				numDifferent++;
+			}
+		}
+	}
+
+	cout << "LightingReferenceHelper: " << bufferName << " has " << numDifferent << " of " << numCompared * LIGHTING_REFERENCE_NUM_FACE << " voxel faces outside tolerance, maximum relative difference " << maxRelativeDif << endl;
+
+	return (numDifferent == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+int LightingReferenceHelper::findVoxelIndex(const LightingReferenceInput& input, uint hashed)
+{
+	// Compacted hashed positions are stored in increasing order
+	vectorUint::const_iterator it = lower_bound(input.m_vectorVoxelHashed.begin(), input.m_vectorVoxelHashed.end(), hashed);
+
+	if ((it == input.m_vectorVoxelHashed.end()) || (*it != hashed))
+	{
+		return -1;
+	}
+
+	return int(it - input.m_vectorVoxelHashed.begin());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightingReferenceHelper::isVoxelOccupied(const LightingReferenceInput& input, const ivec3& coordinates)
+{
+	const uint hashed = BufferVerificationHelper::getHashedIndex(uvec3(coordinates), input.m_voxelizationWidth);
+	const uint index  = hashed / 32;
+
+	if (index >= uint(input.m_vectorVoxelOccupied.size()))
+	{
+		return false;
+	}
+
+	return ((input.m_vectorVoxelOccupied[index] & (1u << (hashed % 32))) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LightingReferenceHelper::isPathFree(const LightingReferenceInput& input, const uvec3& coordinates, const vec3& target)
+{
+	// Voxel traversal (Amanatides and Woo) in voxelization space, from the voxel center to the target, parametrized in [0, 1]
+	const vec3 start     = vec3(coordinates) + vec3(0.5f);
+	const vec3 end       = (target - input.m_sceneMin) / input.m_voxelWorldSize;
+	const vec3 direction = end - start;
+	const int width      = int(input.m_voxelizationWidth);
+	const float infinity = numeric_limits<float>::max();
+
+	ivec3 cell = ivec3(coordinates);
+	ivec3 step;
+	vec3 tMax;
+	vec3 tDelta;
+
+	forI(3)
+	{
+		if (direction[i] > 0.0f)
+		{
+			step[i]   = 1;
+			tDelta[i] = 1.0f / direction[i];
+			tMax[i]   = (float(cell[i] + 1) - start[i]) / direction[i];
+		}
+		else if (direction[i] < 0.0f)
+		{
+			step[i]   = -1;
+			tDelta[i] = -1.0f / direction[i];
+			tMax[i]   = (float(cell[i]) - start[i]) / direction[i];
+		}
+		else
+		{
+			step[i]   = 0;
+			tDelta[i] = infinity;
+			tMax[i]   = infinity;
+		}
+	}
+
+	while (true)
+	{
+		const int axis = (tMax.x < tMax.y) ? ((tMax.x < tMax.z) ? 0 : 2) : ((tMax.y < tMax.z) ? 1 : 2);
+
+		if (tMax[axis] > 1.0f)
+		{
+			return true;
+		}
+
+		cell[axis] += step[axis];
+		tMax[axis] += tDelta[axis];
+
+		if ((cell[axis] < 0) || (cell[axis] >= width))
+		{
+			return true;
+		}
+
+		if (isVoxelOccupied(input, cell))
+		{
+			return false;
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,12 @@ limitations under the License.
 */
 
 // GLOBAL INCLUDES
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define MATHUTIL_USE_SSE 1
+#include <xmmintrin.h>
+#else
+#define MATHUTIL_USE_SSE 0
+#endif
 
 // PROJECT INCLUDES
 #include "../../include/util/mathutil.h"
@@ -50,6 +56,60 @@ void MathUtil::transformPoint(const mat4 &tMat, vec3 &vP)
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+void MathUtil::transformPointArray(const mat4 &tMat, vectorVec3 &vectorPoint, vec3& aabbMin, vec3& aabbMax)
+{
+#if MATHUTIL_USE_SSE
+	__m128 column0 = _mm_loadu_ps(&tMat[0][0]);
+	__m128 column1 = _mm_loadu_ps(&tMat[1][0]);
+	__m128 column2 = _mm_loadu_ps(&tMat[2][0]);
+	__m128 column3 = _mm_loadu_ps(&tMat[3][0]);
+	__m128 minimum = _mm_set1_ps( FLT_MAX);
+	__m128 maximum = _mm_set1_ps(-FLT_MAX);
+
+	float result[4];
+
+	forI(vectorPoint.size())
+	{
+		vec3& point = vectorPoint[i];
+
+		// (column0 * x + column1 * y) + (column2 * z + column3 * 1.0), same association as glm
+		__m128 add0 = _mm_add_ps(_mm_mul_ps(column0, _mm_set1_ps(point.x)), _mm_mul_ps(column1, _mm_set1_ps(point.y)));
+		__m128 add1 = _mm_add_ps(_mm_mul_ps(column2, _mm_set1_ps(point.z)), column3);
+		__m128 add2 = _mm_add_ps(add0, add1);
+
+		minimum = _mm_min_ps(minimum, add2);
+		maximum = _mm_max_ps(maximum, add2);
+
+		_mm_storeu_ps(result, add2);
+		point = vec3(result[0], result[1], result[2]);
+	}
+
+	_mm_storeu_ps(result, minimum);
+	aabbMin = vec3(result[0], result[1], result[2]);
+	_mm_storeu_ps(result, maximum);
+	aabbMax = vec3(result[0], result[1], result[2]);
+#else
+	const vec3 column0 = vec3(tMat[0]);
+	const vec3 column1 = vec3(tMat[1]);
+	const vec3 column2 = vec3(tMat[2]);
+	const vec3 column3 = vec3(tMat[3]);
+	aabbMin            = vec3( FLT_MAX);
+	aabbMax            = vec3(-FLT_MAX);
+
+	forI(vectorPoint.size())
+	{
+		vec3& point = vectorPoint[i];
+
+		// Same association as the SSE path and glm
+		point   = (column0 * point.x + column1 * point.y) + (column2 * point.z + column3);
+		aabbMin = glm::min(aabbMin, point);
+		aabbMax = glm::max(aabbMax, point);
+	}
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
 void MathUtil::transformXYZToMinusXZY(vectorVec3 &vecData)
 {
 	vec3 temp;
@@ -180,3 +240,40 @@ bool MathUtil::isPowerOfTwo(uint value)
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MathUtil::aabbIntersectsFrustum(const vec4* arrayPlane, const vec3& min, const vec3& max)
+{
+	vec3 positiveVertex;
+
+	forI(6)
+	{
+		// Farthest box corner along the plane normal, if it is behind the plane the whole box is
+		positiveVertex.x = (arrayPlane[i].x >= 0.0f) ? max.x : min.x;
+		positiveVertex.y = (arrayPlane[i].y >= 0.0f) ? max.y : min.y;
+		positiveVertex.z = (arrayPlane[i].z >= 0.0f) ? max.z : min.z;
+
+		if ((dot(vec3(arrayPlane[i]), positiveVertex) + arrayPlane[i].w) < 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MathUtil::sphereIntersectsFrustum(const vec4* arrayPlane, const vec3& center, float radius)
+{
+	forI(6)
+	{
+		if ((dot(vec3(arrayPlane[i]), center) + arrayPlane[i].w) < -radius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/util/parallelutil.h"
+#include "../../include/util/loopmacrodefines.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+vector<thread>              ParallelUtil::m_vectorWorkerThread;
+mutex                       ParallelUtil::m_submitMutex;
+mutex                       ParallelUtil::m_jobMutex;
+condition_variable          ParallelUtil::m_jobStart;
+condition_variable          ParallelUtil::m_jobFinish;
+const function<void(uint)>* ParallelUtil::m_jobFunction        = nullptr;
+uint                        ParallelUtil::m_jobNumElement      = 0;
+atomic<uint>                ParallelUtil::m_jobNextIndex(0);
+uint                        ParallelUtil::m_jobGeneration      = 0;
+uint                        ParallelUtil::m_jobNumActiveWorker = 0;
+bool                        ParallelUtil::m_stopWorker         = false;
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ParallelUtil::parallelFor(uint numElement, const function<void(uint)>& function)
+{
+	// Nested calls from a worker thread or concurrent calls from other threads don't wait for the pool
+	unique_lock<mutex> submitLock(m_submitMutex, try_to_lock);
+
+	if ((getNumWorkerThread() <= 1) || (numElement <= 1) || !submitLock.owns_lock())
+	{
+		forI(numElement)
+		{
+			function(i);
+		}
+
+		return;
+	}
+
+	initializeWorkerThread();
+
+	{
+		lock_guard<mutex> jobLock(m_jobMutex);
+		m_jobFunction        = &function;
+		m_jobNumElement      = numElement;
+		m_jobNextIndex       = 0;
+		m_jobNumActiveWorker = uint(m_vectorWorkerThread.size());
+		m_jobGeneration++;
+	}
+
+	m_jobStart.notify_all();
+
+	// The calling thread also processes indices
+	processJob();
+
+	unique_lock<mutex> jobLock(m_jobMutex);
+	m_jobFinish.wait(jobLock, []() { return (m_jobNumActiveWorker == 0); });
+	m_jobFunction = nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+uint ParallelUtil::getNumWorkerThread()
+{
+	static const uint numThread = glm::max(uint(thread::hardware_concurrency()), 1u);
+	return numThread;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ParallelUtil::initializeWorkerThread()
+{
+	if (m_vectorWorkerThread.size() > 0)
+	{
+		return;
+	}
+
+	uint numThread = getNumWorkerThread() - 1;
+	m_vectorWorkerThread.reserve(numThread);
+
+	forI(numThread)
+	{
+		m_vectorWorkerThread.push_back(thread(&ParallelUtil::workerThreadLoop));
+	}
+
+	atexit(&ParallelUtil::destroyWorkerThread);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ParallelUtil::workerThreadLoop()
+{
+	uint generation = 0;
+
+	while (true)
+	{
+		{
+			unique_lock<mutex> jobLock(m_jobMutex);
+			m_jobStart.wait(jobLock, [&generation]() { return m_stopWorker || (m_jobGeneration != generation); });
+
+			if (m_stopWorker)
+			{
+				return;
+			}
+
+			generation = m_jobGeneration;
+		}
+
+		processJob();
+
+		bool lastWorker;
+		{
+			lock_guard<mutex> jobLock(m_jobMutex);
+			m_jobNumActiveWorker--;
+			lastWorker = (m_jobNumActiveWorker == 0);
+		}
+
+		if (lastWorker)
+		{
+			m_jobFinish.notify_one();
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ParallelUtil::processJob()
+{
+	// Each thread takes the next index to process, so uneven costs per index are balanced among threads
+	const function<void(uint)>& function = *m_jobFunction;
+	uint index                           = m_jobNextIndex.fetch_add(1);
+
+	while (index < m_jobNumElement)
+	{
+		function(index);
+		index = m_jobNextIndex.fetch_add(1);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void ParallelUtil::destroyWorkerThread()
+{
+	{
+		lock_guard<mutex> jobLock(m_jobMutex);
+		m_stopWorker = true;
+	}
+
+	m_jobStart.notify_all();
+
+	forIT(m_vectorWorkerThread)
+	{
+		it->join();
+	}
+
+	m_vectorWorkerThread.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+/*
+Copyright 2022 Alejandro Cosin & Gustavo Patow
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// GLOBAL INCLUDES
+
+// PROJECT INCLUDES
+#include "../../include/util/voxelgreedymesher.h"
+#include "../../include/util/loopmacrodefines.h"
+#include "../../include/util/parallelutil.h"
+
+// NAMESPACE
+
+// DEFINES
+
+// STATIC MEMBER INITIALIZATION
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void VoxelGreedyMesher::buildOccupancy(const uint* pHashedPosition, uint numHashedPosition, uint voxelizationSize, vectorUint& vectorOccupancy)
+{
+	vectorOccupancy.assign((voxelizationSize * voxelizationSize * voxelizationSize + 31) / 32, 0);
+
+	forI(numHashedPosition)
+	{
+		vectorOccupancy[pHashedPosition[i] >> 5] |= (1u << (pHashedPosition[i] & 31));
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+void VoxelGreedyMesher::extractVisibleFace(const vectorUint& vectorOccupancy, uint voxelizationSize, bool mergeCoplanar, vector<VoxelFaceRectangle>& vectorRectangle)
+{
+	const int size = int(voxelizationSize);
+
+	// Hashing used in voxelHashedPositionCompactedBuffer: x * size * size + y * size + z
+	auto isOccupied = [&vectorOccupancy, size](const ivec3& voxel)
+	{
+		if (glm::any(glm::lessThan(voxel, ivec3(0))) || glm::any(glm::greaterThanEqual(voxel, ivec3(size))))
+		{
+			return false;
+		}
+
+		uint hashed = uint(voxel.x) * uint(size) * uint(size) + uint(voxel.y) * uint(size) + uint(voxel.z);
+		return ((vectorOccupancy[hashed >> 5] >> (hashed & 31)) & 1u) != 0u;
+	};
+
+	// One task per face and slice, each one with its own result vector, concatenated afterwards to keep the order deterministic
+	const uint numTask = 6 * uint(size);
+	vector<vector<VoxelFaceRectangle>> vectorTaskRectangle(numTask);
+
+	ParallelUtil::parallelFor(numTask, [&](uint task)
+	{
+		const uint face     = task / uint(size);
+		const int s         = int(task % uint(size));
+		const int d         = int(face / 2);
+		const int u         = (d + 1) % 3;
+		const int v         = (d + 2) % 3;
+		const int direction = ((face % 2) == 0) ? 1 : -1;
+
+		ivec3 normal = ivec3(0);
+		normal[d]    = direction;
+
+		// Faces of occupied voxels whose neighbour in the face direction is empty, projected in the (u, v) plane
+		vectorUint8 vectorMask(size * size);
+		ivec3 voxel;
+		voxel[d] = s;
+		for (int j = 0; j < size; ++j)
+		{
+			voxel[v] = j;
+			for (int i = 0; i < size; ++i)
+			{
+				voxel[u] = i;
+				vectorMask[j * size + i] = uint8_t(isOccupied(voxel) && !isOccupied(voxel + normal));
+			}
+		}
+
+		vector<VoxelFaceRectangle>& vectorResult = vectorTaskRectangle[task];
+
+		// Merge the faces in maximal rectangles, first growing along u and then along v
+		for (int j = 0; j < size; ++j)
+		{
+			for (int i = 0; i < size;)
+			{
+				if (vectorMask[j * size + i] == 0)
+				{
+					++i;
+					continue;
+				}
+
+				int width  = 1;
+				int height = 1;
+
+				if (mergeCoplanar)
+				{
+					while (((i + width) < size) && (vectorMask[j * size + i + width] != 0))
+					{
+						width++;
+					}
+
+					bool rowFull = true;
+					while (((j + height) < size) && rowFull)
+					{
+						for (int k = 0; k < width; ++k)
+						{
+							if (vectorMask[(j + height) * size + i + k] == 0)
+							{
+								rowFull = false;
+								break;
+							}
+						}
+
+						if (rowFull)
+						{
+							height++;
+						}
+					}
+				}
+
+				for (int l = 0; l < height; ++l)
+				{
+					memset(&vectorMask[(j + l) * size + i], 0, width);
+				}
+
+				VoxelFaceRectangle rectangle;
+				rectangle.m_voxel[d] = uint(s);
+				rectangle.m_voxel[u] = uint(i);
+				rectangle.m_voxel[v] = uint(j);
+				rectangle.m_face     = face;
+				rectangle.m_width    = uint(width);
+				rectangle.m_height   = uint(height);
+				vectorResult.push_back(rectangle);
+
+				i += width;
+			}
+		}
+	});
+
+	size_t numRectangle = 0;
+	forI(numTask)
+	{
+		numRectangle += vectorTaskRectangle[i].size();
+	}
+
+	vectorRectangle.clear();
+	vectorRectangle.reserve(numRectangle);
+
+	forI(numTask)
+	{
+		vectorRectangle.insert(vectorRectangle.end(), vectorTaskRectangle[i].begin(), vectorTaskRectangle[i].end());
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ivec3 VoxelGreedyMesher::getRectangleCorner(const VoxelFaceRectangle& rectangle, uint offsetU, uint offsetV)
+{
+	const int d = int(rectangle.m_face / 2);
+	const int u = (d + 1) % 3;
+	const int v = (d + 2) % 3;
+
+	ivec3 corner = ivec3(rectangle.m_voxel);
+	corner[d]   += ((rectangle.m_face % 2) == 0) ? 1 : 0;
+	corner[u]   += int(offsetU);
+	corner[v]   += int(offsetV);
+
+	return corner;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
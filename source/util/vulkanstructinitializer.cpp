@@ -309,8 +309,7 @@ void VulkanStructInitializer::getTextureData(Texture* texture, VkFormat format,
 		0);
 	index++;
 
-	VkCommandBuffer commandBufferTexture;
-	coreM->allocCommandBuffer(&coreM->getLogicalDevice(), coreM->getGraphicsCommandPool(), &commandBufferTexture);
+	VkCommandBuffer commandBufferTexture = coreM->acquireFrameCommandBuffer();
 	coreM->beginCommandBuffer(commandBufferTexture);
 	
 	// Transition source image to proper layout (VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
@@ -387,6 +386,7 @@ void VulkanStructInitializer::getTextureData(Texture* texture, VkFormat format,
 
 	coreM->endCommandBuffer(commandBufferTexture);
 	coreM->submitCommandBuffer(coreM->getLogicalDeviceGraphicsQueue(), &commandBufferTexture);
+	coreM->releaseFrameCommandBuffer(commandBufferTexture);
 
 	VkImageSubresource subResource{};
 	subResource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;